@@ -59,6 +59,9 @@ public:
   GEOSX_HOST_DEVICE
   localIndex numPhases() const { return m_phaseFraction.size( 2 ); }
 
+  /// Maximum number of elements processed in a single call to BatchUpdate()
+  static constexpr localIndex BATCH_SIZE = 16;
+
 protected:
 
   MultiFluidBaseUpdate( arrayView1d< real64 const > const & componentMolarWeight,
@@ -189,6 +192,33 @@ private:
                        real64 const temperature,
                        arraySlice1d< real64 const > const & composition ) const = 0;
 
+public:
+
+  /**
+   * @brief Update fluid state in a block of consecutive elements.
+   * @param firstElem index of the first element in the block
+   * @param pressure pressure in each element of the block (at most BATCH_SIZE values)
+   * @param temperature temperature
+   * @param composition global component fractions, indexed by element
+   *
+   * The default implementation calls Update() on each element and quadrature point.
+   * Models with a significant per-call setup cost should override it to amortize
+   * that cost over the block.
+   */
+  virtual void BatchUpdate( localIndex const firstElem,
+                            arraySlice1d< real64 const > const & pressure,
+                            real64 const temperature,
+                            arrayView2d< real64 const > const & composition ) const
+  {
+    for( localIndex b = 0; b < pressure.size(); ++b )
+    {
+      for( localIndex q = 0; q < numGauss(); ++q )
+      {
+        Update( firstElem + b, q, pressure[b], temperature, composition[firstElem + b] );
+      }
+    }
+  }
+
 };
 
 class MultiFluidBase : public ConstitutiveBase
@@ -223,7 +223,101 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
                                                  real64 & dTotalDensity_dTemperature,
                                                  arraySlice1d< real64, 0 > const & dTotalDensity_dGlobalCompFraction ) const
 {
-// 0. make shortcut structs to avoid long names (TODO maybe remove)
+  localIndex constexpr maxNumComp = MultiFluidBase::MAX_NUM_COMPONENTS;
+  localIndex const NC = numComponents();
+
+  // 1. Convert input mass fractions to mole fractions and keep derivatives
+
+  std::vector< double > compMoleFrac( NC );
+  stackArray2d< real64, maxNumComp * maxNumComp > dCompMoleFrac_dCompMassFrac( NC, NC );
+
+  if( m_useMass )
+  {
+    dCompMoleFrac_dCompMassFrac.resize( NC, NC );
+    dCompMoleFrac_dCompMassFrac.setValues< serialPolicy >( 0.0 );
+
+    real64 totalMolality = 0.0;
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      real64 const mwInv = 1.0 / m_componentMolarWeight[ic];
+      compMoleFrac[ic] = composition[ic] * mwInv; // this is molality (units of mole/mass)
+      dCompMoleFrac_dCompMassFrac[ic][ic] = mwInv;
+      totalMolality += compMoleFrac[ic];
+    }
+
+    real64 const totalMolalityInv = 1.0 / totalMolality;
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      compMoleFrac[ic] *= totalMolalityInv;
+
+      for( localIndex jc = 0; jc < NC; ++jc )
+      {
+        dCompMoleFrac_dCompMassFrac[ic][jc] -= compMoleFrac[ic] / m_componentMolarWeight[jc];
+        dCompMoleFrac_dCompMassFrac[ic][jc] *= totalMolalityInv;
+      }
+    }
+  }
+  else
+  {
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      compMoleFrac[ic] = composition[ic];
+    }
+  }
+
+  // 2. Trigger PVTPackage compute and post-process the results
+  computeEquilibrium( pressure,
+                      temperature,
+                      compMoleFrac,
+                      dCompMoleFrac_dCompMassFrac.toSliceConst(),
+                      phaseFraction,
+                      dPhaseFraction_dPressure,
+                      dPhaseFraction_dTemperature,
+                      dPhaseFraction_dGlobalCompFraction,
+                      phaseDensity,
+                      dPhaseDensity_dPressure,
+                      dPhaseDensity_dTemperature,
+                      dPhaseDensity_dGlobalCompFraction,
+                      phaseViscosity,
+                      dPhaseViscosity_dPressure,
+                      dPhaseViscosity_dTemperature,
+                      dPhaseViscosity_dGlobalCompFraction,
+                      phaseCompFraction,
+                      dPhaseCompFraction_dPressure,
+                      dPhaseCompFraction_dTemperature,
+                      dPhaseCompFraction_dGlobalCompFraction,
+                      totalDensity,
+                      dTotalDensity_dPressure,
+                      dTotalDensity_dTemperature,
+                      dTotalDensity_dGlobalCompFraction );
+}
+
+void MultiFluidPVTPackageWrapperUpdate::computeEquilibrium( real64 const pressure,
+                                                            real64 const temperature,
+                                                            std::vector< double > const & compMoleFrac,
+                                                            arraySlice2d< real64 const > const & dCompMoleFrac_dCompMassFrac,
+                                                            arraySlice1d< real64 > const & phaseFraction,
+                                                            arraySlice1d< real64 > const & dPhaseFraction_dPressure,
+                                                            arraySlice1d< real64 > const & dPhaseFraction_dTemperature,
+                                                            arraySlice2d< real64 > const & dPhaseFraction_dGlobalCompFraction,
+                                                            arraySlice1d< real64 > const & phaseDensity,
+                                                            arraySlice1d< real64 > const & dPhaseDensity_dPressure,
+                                                            arraySlice1d< real64 > const & dPhaseDensity_dTemperature,
+                                                            arraySlice2d< real64 > const & dPhaseDensity_dGlobalCompFraction,
+                                                            arraySlice1d< real64 > const & phaseViscosity,
+                                                            arraySlice1d< real64 > const & dPhaseViscosity_dPressure,
+                                                            arraySlice1d< real64 > const & dPhaseViscosity_dTemperature,
+                                                            arraySlice2d< real64 > const & dPhaseViscosity_dGlobalCompFraction,
+                                                            arraySlice2d< real64 > const & phaseCompFraction,
+                                                            arraySlice2d< real64 > const & dPhaseCompFraction_dPressure,
+                                                            arraySlice2d< real64 > const & dPhaseCompFraction_dTemperature,
+                                                            arraySlice3d< real64 > const & dPhaseCompFraction_dGlobalCompFraction,
+                                                            real64 & totalDensity,
+                                                            real64 & dTotalDensity_dPressure,
+                                                            real64 & dTotalDensity_dTemperature,
+                                                            arraySlice1d< real64, 0 > const & dTotalDensity_dGlobalCompFraction ) const
+{
+  // 0. make shortcut structs to avoid long names (TODO maybe remove)
   CompositionalVarContainer< 1 > phaseFrac {
     phaseFraction,
     dPhaseFraction_dPressure,
@@ -268,45 +362,6 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   localIndex const NC = numComponents();
   localIndex const NP = numPhases();
 
-  // 1. Convert input mass fractions to mole fractions and keep derivatives
-
-  std::vector< double > compMoleFrac( NC );
-  stackArray2d< real64, maxNumComp * maxNumComp > dCompMoleFrac_dCompMassFrac( NC, NC );
-
-  if( m_useMass )
-  {
-    dCompMoleFrac_dCompMassFrac.resize( NC, NC );
-    dCompMoleFrac_dCompMassFrac.setValues< serialPolicy >( 0.0 );
-
-    real64 totalMolality = 0.0;
-    for( localIndex ic = 0; ic < NC; ++ic )
-    {
-      real64 const mwInv = 1.0 / m_componentMolarWeight[ic];
-      compMoleFrac[ic] = composition[ic] * mwInv; // this is molality (units of mole/mass)
-      dCompMoleFrac_dCompMassFrac[ic][ic] = mwInv;
-      totalMolality += compMoleFrac[ic];
-    }
-
-    real64 const totalMolalityInv = 1.0 / totalMolality;
-    for( localIndex ic = 0; ic < NC; ++ic )
-    {
-      compMoleFrac[ic] *= totalMolalityInv;
-
-      for( localIndex jc = 0; jc < NC; ++jc )
-      {
-        dCompMoleFrac_dCompMassFrac[ic][jc] -= compMoleFrac[ic] / m_componentMolarWeight[jc];
-        dCompMoleFrac_dCompMassFrac[ic][jc] *= totalMolalityInv;
-      }
-    }
-  }
-  else
-  {
-    for( localIndex ic = 0; ic < NC; ++ic )
-    {
-      compMoleFrac[ic] = composition[ic];
-    }
-  }
-
   // 2. Trigger PVTPackage compute and get back phase split
   m_fluid.Update( pressure, temperature, compMoleFrac );
 
@@ -426,7 +481,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     }
 
     // 4.3. Update derivatives w.r.t. mole fractions to derivatives w.r.t mass fractions
-    array1d< real64 > work( NC );
+    stackArray1d< real64, maxNumComp > work( NC );
     for( localIndex ip = 0; ip < NP; ++ip )
     {
       applyChainRuleInPlace( NC, dCompMoleFrac_dCompMassFrac, phaseFrac.dComp[ip], work );
@@ -478,6 +533,114 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   }
 }
 
+void MultiFluidPVTPackageWrapperUpdate::BatchUpdate( localIndex const firstElem,
+                                                     arraySlice1d< real64 const > const & pressure,
+                                                     real64 const temperature,
+                                                     arrayView2d< real64 const > const & composition ) const
+{
+  localIndex constexpr maxNumComp = MultiFluidBase::MAX_NUM_COMPONENTS;
+  localIndex const NC = numComponents();
+  localIndex const numElems = pressure.size();
+
+  GEOSX_ASSERT( numElems <= BATCH_SIZE );
+
+  // 1. Convert input mass fractions to mole fractions for the whole block.
+  //    Component-major (SoA) storage makes the inner loops over elements unit-stride.
+  real64 compMoleFrac[maxNumComp][BATCH_SIZE];
+  real64 totalMolalityInv[BATCH_SIZE];
+
+  for( localIndex ic = 0; ic < NC; ++ic )
+  {
+    for( localIndex b = 0; b < numElems; ++b )
+    {
+      compMoleFrac[ic][b] = composition[firstElem + b][ic];
+    }
+  }
+
+  if( m_useMass )
+  {
+    for( localIndex b = 0; b < numElems; ++b )
+    {
+      totalMolalityInv[b] = 0.0;
+    }
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      real64 const mwInv = 1.0 / m_componentMolarWeight[ic];
+      for( localIndex b = 0; b < numElems; ++b )
+      {
+        compMoleFrac[ic][b] *= mwInv; // this is molality (units of mole/mass)
+        totalMolalityInv[b] += compMoleFrac[ic][b];
+      }
+    }
+    for( localIndex b = 0; b < numElems; ++b )
+    {
+      totalMolalityInv[b] = 1.0 / totalMolalityInv[b];
+    }
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      for( localIndex b = 0; b < numElems; ++b )
+      {
+        compMoleFrac[ic][b] *= totalMolalityInv[b];
+      }
+    }
+  }
+
+  // 2. Run the flash element by element, from the initial K-values chosen by PVTPackage;
+  //    scratch buffers are allocated once per block
+  std::vector< double > elemCompMoleFrac( NC );
+  stackArray2d< real64, maxNumComp * maxNumComp > dCompMoleFrac_dCompMassFrac( NC, NC );
+
+  for( localIndex b = 0; b < numElems; ++b )
+  {
+    localIndex const k = firstElem + b;
+
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      elemCompMoleFrac[ic] = compMoleFrac[ic][b];
+    }
+
+    if( m_useMass )
+    {
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        for( localIndex jc = 0; jc < NC; ++jc )
+        {
+          real64 const delta = ( ic == jc ) ? 1.0 : 0.0;
+          dCompMoleFrac_dCompMassFrac[ic][jc] = ( delta - elemCompMoleFrac[ic] ) * totalMolalityInv[b] / m_componentMolarWeight[jc];
+        }
+      }
+    }
+
+    for( localIndex q = 0; q < numGauss(); ++q )
+    {
+      computeEquilibrium( pressure[b],
+                          temperature,
+                          elemCompMoleFrac,
+                          dCompMoleFrac_dCompMassFrac.toSliceConst(),
+                          m_phaseFraction[k][q],
+                          m_dPhaseFraction_dPressure[k][q],
+                          m_dPhaseFraction_dTemperature[k][q],
+                          m_dPhaseFraction_dGlobalCompFraction[k][q],
+                          m_phaseDensity[k][q],
+                          m_dPhaseDensity_dPressure[k][q],
+                          m_dPhaseDensity_dTemperature[k][q],
+                          m_dPhaseDensity_dGlobalCompFraction[k][q],
+                          m_phaseViscosity[k][q],
+                          m_dPhaseViscosity_dPressure[k][q],
+                          m_dPhaseViscosity_dTemperature[k][q],
+                          m_dPhaseViscosity_dGlobalCompFraction[k][q],
+                          m_phaseCompFraction[k][q],
+                          m_dPhaseCompFraction_dPressure[k][q],
+                          m_dPhaseCompFraction_dTemperature[k][q],
+                          m_dPhaseCompFraction_dGlobalCompFraction[k][q],
+                          m_totalDensity[k][q],
+                          m_dTotalDensity_dPressure[k][q],
+                          m_dTotalDensity_dTemperature[k][q],
+                          m_dTotalDensity_dGlobalCompFraction[k][q] );
+    }
+  }
+}
+
 } //namespace constitutive
 
 } //namespace geosx
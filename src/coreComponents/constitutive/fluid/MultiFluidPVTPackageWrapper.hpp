@@ -22,6 +22,7 @@
 #include "constitutive/fluid/MultiFluidBase.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace PVTPackage
 {
@@ -170,8 +171,57 @@ public:
              m_dTotalDensity_dGlobalCompFraction[k][q] );
   }
 
+  /**
+   * @copydoc MultiFluidBaseUpdate::BatchUpdate
+   *
+   * Mass to mole fraction conversion is done for the whole block at once, and
+   * the flash scratch buffers are shared by all elements of the block.
+   * The flash itself is still run element by element: PVTPackage::MultiphaseSystem
+   * only takes the pressure, temperature and feed, so its Rachford-Rice and EOS
+   * solves can neither be batched nor warm-started from the K-values of the
+   * previous Newton iteration from here.
+   */
+  virtual void BatchUpdate( localIndex const firstElem,
+                            arraySlice1d< real64 const > const & pressure,
+                            real64 const temperature,
+                            arrayView2d< real64 const > const & composition ) const override;
+
 private:
 
+  /**
+   * @brief Run the PVTPackage flash for given mole fractions and convert results.
+   * @param pressure pressure
+   * @param temperature temperature
+   * @param compMoleFrac component mole fractions
+   * @param dCompMoleFrac_dCompMassFrac derivatives of mole fractions w.r.t. input fractions (used if m_useMass)
+   *
+   * Remaining parameters are the outputs, as in Compute().
+   */
+  void computeEquilibrium( real64 const pressure,
+                           real64 const temperature,
+                           std::vector< double > const & compMoleFrac,
+                           arraySlice2d< real64 const > const & dCompMoleFrac_dCompMassFrac,
+                           arraySlice1d< real64 > const & phaseFraction,
+                           arraySlice1d< real64 > const & dPhaseFraction_dPressure,
+                           arraySlice1d< real64 > const & dPhaseFraction_dTemperature,
+                           arraySlice2d< real64 > const & dPhaseFraction_dGlobalCompFraction,
+                           arraySlice1d< real64 > const & phaseDensity,
+                           arraySlice1d< real64 > const & dPhaseDensity_dPressure,
+                           arraySlice1d< real64 > const & dPhaseDensity_dTemperature,
+                           arraySlice2d< real64 > const & dPhaseDensity_dGlobalCompFraction,
+                           arraySlice1d< real64 > const & phaseViscosity,
+                           arraySlice1d< real64 > const & dPhaseViscosity_dPressure,
+                           arraySlice1d< real64 > const & dPhaseViscosity_dTemperature,
+                           arraySlice2d< real64 > const & dPhaseViscosity_dGlobalCompFraction,
+                           arraySlice2d< real64 > const & phaseCompFraction,
+                           arraySlice2d< real64 > const & dPhaseCompFraction_dPressure,
+                           arraySlice2d< real64 > const & dPhaseCompFraction_dTemperature,
+                           arraySlice3d< real64 > const & dPhaseCompFraction_dGlobalCompFraction,
+                           real64 & totalDensity,
+                           real64 & dTotalDensity_dPressure,
+                           real64 & dTotalDensity_dTemperature,
+                           arraySlice1d< real64 > const & dTotalDensity_dGlobalCompFraction ) const;
+
   PVTPackage::MultiphaseSystem & m_fluid;
 
   arrayView1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
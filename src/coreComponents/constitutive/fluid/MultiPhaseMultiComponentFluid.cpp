@@ -22,6 +22,7 @@
 #include "constitutive/fluid/MultiFluidUtils.hpp"
 #include "PVTFunctions/FlashModelBase.hpp"
 #include "PVTFunctions/PVTFunctionBase.hpp"
+#include "PVTFunctions/UniformPVTTable.hpp"
 
 
 namespace geosx
@@ -35,7 +36,10 @@ namespace constitutive
 {
 
 MultiPhaseMultiComponentFluid::MultiPhaseMultiComponentFluid( std::string const & name, Group * const parent ):
-  MultiFluidBase( name, parent )
+  MultiFluidBase( name, parent ),
+  m_usePVTTables( 0 ),
+  m_pvtTableTolerance( 1e-3 ),
+  m_pvtTablesCreated( false )
 {
 
   registerWrapper( viewKeyStruct::phasePVTParaFilesString, &m_phasePVTParaFiles )->
@@ -48,6 +52,31 @@ MultiPhaseMultiComponentFluid::MultiPhaseMultiComponentFluid( std::string const
     setRestartFlags( RestartFlags::NO_WRITE )->
     setDescription( "name of the filen including flash calculation function parameters" );
 
+  registerWrapper( viewKeyStruct::usePVTTablesString, &m_usePVTTables )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether the phase densities and viscosities are interpolated from tables "
+                    "built at initialization instead of evaluating the PVT functions. "
+                    "Only available for two-component fluids." );
+
+  registerWrapper( viewKeyStruct::pvtTablePressureRangeString, &m_pvtTablePressureRange )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Minimum and maximum pressure of the PVT tables" );
+
+  registerWrapper( viewKeyStruct::pvtTableTemperatureRangeString, &m_pvtTableTemperatureRange )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Minimum and maximum temperature [K] of the PVT tables" );
+
+  registerWrapper( viewKeyStruct::pvtTableNumPointsString, &m_pvtTableNumPoints )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of points of the PVT tables in pressure, temperature and phase composition" );
+
+  registerWrapper( viewKeyStruct::pvtTableToleranceString, &m_pvtTableTolerance )->
+    setApplyDefaultValue( 1e-3 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum relative deviation of the PVT tables from the PVT functions. "
+                    "If it is exceeded, the PVT functions are used instead of the tables." );
+
 }
 
 MultiPhaseMultiComponentFluid::~MultiPhaseMultiComponentFluid()
@@ -81,6 +110,13 @@ MultiPhaseMultiComponentFluid::deliverClone( string const & name,
 
   newConstitutiveRelation->m_flashModel = this->m_flashModel;
 
+  // the tables are immutable once built, the clones share them
+  newConstitutiveRelation->m_usePVTTables = this->m_usePVTTables;
+  newConstitutiveRelation->m_pvtTablesCreated = this->m_pvtTablesCreated;
+  newConstitutiveRelation->m_phaseMassDensityTables = this->m_phaseMassDensityTables;
+  newConstitutiveRelation->m_phaseMolarDensityTables = this->m_phaseMolarDensityTables;
+  newConstitutiveRelation->m_phaseViscosityTables = this->m_phaseViscosityTables;
+
   return clone;
 }
 
@@ -94,6 +130,10 @@ void MultiPhaseMultiComponentFluid::PostProcessInput()
 
   CreatePVTModels();
 
+  if( m_usePVTTables )
+  {
+    CreatePVTTables();
+  }
 }
 
 void MultiPhaseMultiComponentFluid::InitializePostSubGroups( Group * const group )
@@ -171,6 +211,76 @@ void MultiPhaseMultiComponentFluid::CreatePVTModels()
   }
 }
 
+void MultiPhaseMultiComponentFluid::CreatePVTTables()
+{
+  if( m_pvtTablesCreated )
+  {
+    return;
+  }
+  m_pvtTablesCreated = true;
+
+  GEOSX_ERROR_IF( numFluidComponents() != 2,
+                  getName() << ": PVT tables are only available for two-component fluids" );
+  GEOSX_ERROR_IF( m_pvtTablePressureRange.size() != 2,
+                  getName() << ": " << viewKeyStruct::pvtTablePressureRangeString << " must contain a minimum and a maximum" );
+  GEOSX_ERROR_IF( m_pvtTableTemperatureRange.size() != 2,
+                  getName() << ": " << viewKeyStruct::pvtTableTemperatureRangeString << " must contain a minimum and a maximum" );
+  GEOSX_ERROR_IF( m_pvtTableNumPoints.size() != 3,
+                  getName() << ": " << viewKeyStruct::pvtTableNumPointsString << " must contain three values" );
+
+  // the PVT functions take the temperature in Celsius
+  real64 constexpr TK = 273.15;
+  real64 const minCoord[UniformPVTTable::NDIM] = { m_pvtTablePressureRange[0], m_pvtTableTemperatureRange[0] - TK, 0.0 };
+  real64 const maxCoord[UniformPVTTable::NDIM] = { m_pvtTablePressureRange[1], m_pvtTableTemperatureRange[1] - TK, 1.0 };
+  localIndex const numPoints[UniformPVTTable::NDIM] = { m_pvtTableNumPoints[0], m_pvtTableNumPoints[1], m_pvtTableNumPoints[2] };
+
+  real64 maxDeviation = 0.0;
+
+  auto const makeTable = [&]( PVTFunction const & func, bool const useMass )
+  {
+    auto const evaluate = [&func, useMass]( real64 const pres, real64 const temp, real64 const comp )
+    {
+      stackArray2d< EvalVarArgs, 2 > phaseComposition( 1, 2 );
+      phaseComposition[0][0] = comp;
+      phaseComposition[0][1] = 1.0 - comp;
+
+      EvalVarArgs value;
+      func.Evaluation( pres, temp, phaseComposition[0], value, useMass );
+      return value.m_var;
+    };
+
+    std::shared_ptr< UniformPVTTable > table = std::make_shared< UniformPVTTable >( minCoord, maxCoord, numPoints );
+    table->fill( evaluate );
+    maxDeviation = std::max( maxDeviation, table->maxRelativeDeviation( evaluate ) );
+    return table;
+  };
+
+  m_phaseMassDensityTables.clear();
+  m_phaseMolarDensityTables.clear();
+  m_phaseViscosityTables.clear();
+
+  for( localIndex ip = 0; ip < numFluidPhases(); ++ip )
+  {
+    m_phaseMassDensityTables.emplace_back( makeTable( *m_phaseDensityFuns[ip], true ) );
+    m_phaseMolarDensityTables.emplace_back( makeTable( *m_phaseDensityFuns[ip], false ) );
+    m_phaseViscosityTables.emplace_back( makeTable( *m_phaseViscosityFuns[ip], false ) );
+  }
+
+  if( maxDeviation > m_pvtTableTolerance )
+  {
+    GEOSX_WARNING( getName() << ": maximum relative deviation of the PVT tables (" << maxDeviation
+                             << ") exceeds " << viewKeyStruct::pvtTableToleranceString << " (" << m_pvtTableTolerance
+                             << "), the PVT functions will be used instead" );
+    m_phaseMassDensityTables.clear();
+    m_phaseMolarDensityTables.clear();
+    m_phaseViscosityTables.clear();
+  }
+  else
+  {
+    GEOSX_LOG_RANK_0( getName() << ": PVT tables built, maximum relative deviation from the PVT functions is " << maxDeviation );
+  }
+}
+
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, MultiPhaseMultiComponentFluid, std::string const &, Group * const )
 
 void MultiPhaseMultiComponentFluidUpdate::Compute( real64 pressure,
@@ -308,11 +418,23 @@ void MultiPhaseMultiComponentFluidUpdate::Compute( real64 pressure,
   stackArray1d< EvalVarArgs, maxNumPhase > phaseDensityTemp( NP );
   stackArray1d< EvalVarArgs, maxNumPhase > phaseViscosityTemp( NP );
 
+  bool const useTables = !m_phaseViscosityTables.empty();
+
   for( localIndex ip = 0; ip < NP; ++ip )
   {
     // molarDensity or massDensity (useMass)
-    m_phaseDensityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], phaseDensityTemp[ip], m_useMass );
-    m_phaseViscosityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], phaseViscosityTemp[ip] );
+    if( useTables )
+    {
+      // tables are parameterized by the fraction of the first component in the phase
+      EvalVarArgs const & phaseComp = phaseCompFractionTemp[ip][0];
+      ( m_useMass ? m_phaseMassDensityTables : m_phaseMolarDensityTables )[ip]->evaluation( P, T, phaseComp, phaseDensityTemp[ip] );
+      m_phaseViscosityTables[ip]->evaluation( P, T, phaseComp, phaseViscosityTemp[ip] );
+    }
+    else
+    {
+      m_phaseDensityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], phaseDensityTemp[ip], m_useMass );
+      m_phaseViscosityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], phaseViscosityTemp[ip] );
+    }
   }
 
   if( m_useMass )
@@ -321,7 +443,14 @@ void MultiPhaseMultiComponentFluidUpdate::Compute( real64 pressure,
     for( localIndex ip = 0; ip < NP; ++ip )
     {
       EvalVarArgs molarPhaseDensity;
-      m_phaseDensityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], molarPhaseDensity, 0 );
+      if( useTables )
+      {
+        m_phaseMolarDensityTables[ip]->evaluation( P, T, phaseCompFractionTemp[ip][0], molarPhaseDensity );
+      }
+      else
+      {
+        m_phaseDensityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], molarPhaseDensity, 0 );
+      }
       phaseMW[ip] =  phaseDensityTemp[ip] /  molarPhaseDensity;
     }
 
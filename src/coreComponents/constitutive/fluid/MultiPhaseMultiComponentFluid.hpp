@@ -39,6 +39,7 @@ namespace PVTProps
 {
 class PVTFunction;
 class FlashModel;
+class UniformPVTTable;
 }
 
 namespace constitutive
@@ -55,6 +56,9 @@ public:
   MultiPhaseMultiComponentFluidUpdate( std::vector< std::shared_ptr< PVTProps::PVTFunction const > > const & phaseDensityFuns,
                                        std::vector< std::shared_ptr< PVTProps::PVTFunction const > > const & phaseViscosityFuns,
                                        std::shared_ptr< PVTProps::FlashModel const > const & flashModel,
+                                       std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > const & phaseMassDensityTables,
+                                       std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > const & phaseMolarDensityTables,
+                                       std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > const & phaseViscosityTables,
                                        arrayView1d< real64 const > const & componentMolarWeight,
                                        bool useMass,
                                        arrayView3d< real64 > const & phaseFraction,
@@ -101,7 +105,10 @@ public:
                             dTotalDensity_dGlobalCompFraction ),
     m_phaseDensityFuns( phaseDensityFuns ),
     m_phaseViscosityFuns( phaseViscosityFuns ),
-    m_flashModel( flashModel )
+    m_flashModel( flashModel ),
+    m_phaseMassDensityTables( phaseMassDensityTables ),
+    m_phaseMolarDensityTables( phaseMolarDensityTables ),
+    m_phaseViscosityTables( phaseViscosityTables )
   {}
 
   /// Default copy constructor
@@ -187,6 +194,11 @@ private:
   std::vector< std::shared_ptr< PVTProps::PVTFunction const > > m_phaseViscosityFuns;
   std::shared_ptr< PVTProps::FlashModel const > m_flashModel;
 
+  // tabulated phase properties, empty if the PVT functions are evaluated directly
+  std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > m_phaseMassDensityTables;
+  std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > m_phaseMolarDensityTables;
+  std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > m_phaseViscosityTables;
+
 };
 
 class MultiPhaseMultiComponentFluid : public MultiFluidBase
@@ -218,6 +230,9 @@ public:
     return KernelWrapper( m_phaseDensityFuns,
                           m_phaseViscosityFuns,
                           m_flashModel,
+                          m_phaseMassDensityTables,
+                          m_phaseMolarDensityTables,
+                          m_phaseViscosityTables,
                           m_componentMolarWeight,
                           m_useMass,
                           m_phaseFraction,
@@ -246,6 +261,11 @@ public:
   {
     static constexpr auto flashModelParaFileString = "flashModelParaFile";
     static constexpr auto phasePVTParaFilesString = "phasePVTParaFiles";
+    static constexpr auto usePVTTablesString = "usePVTTables";
+    static constexpr auto pvtTablePressureRangeString = "pvtTablePressureRange";
+    static constexpr auto pvtTableTemperatureRangeString = "pvtTableTemperatureRange";
+    static constexpr auto pvtTableNumPointsString = "pvtTableNumPoints";
+    static constexpr auto pvtTableToleranceString = "pvtTableTolerance";
   } viewKeysMultiPhaseMultiComponentFluid;
 
 
@@ -258,6 +278,13 @@ private:
 
   void CreatePVTModels();
 
+  /**
+   * @brief Tabulate the phase densities and viscosities and check the tables against the PVT functions.
+   *
+   * The tables are built once, from PostProcessInput, and shared with the clones.
+   */
+  void CreatePVTTables();
+
   // phase PVT parameter filenames
   path_array m_phasePVTParaFiles;
 
@@ -269,6 +296,29 @@ private:
 
   std::shared_ptr< PVTProps::FlashModel const > m_flashModel;
 
+  // flag to evaluate the phase properties from tables
+  integer m_usePVTTables;
+
+  // pressure range of the tables
+  array1d< real64 > m_pvtTablePressureRange;
+
+  // temperature range of the tables
+  array1d< real64 > m_pvtTableTemperatureRange;
+
+  // number of table points in pressure, temperature and phase composition
+  array1d< integer > m_pvtTableNumPoints;
+
+  // maximum relative deviation of the tables from the PVT functions
+  real64 m_pvtTableTolerance;
+
+  // number of entries corresponds to number of phases, empty if tables are not used
+  std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > m_phaseMassDensityTables;
+  std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > m_phaseMolarDensityTables;
+  std::vector< std::shared_ptr< PVTProps::UniformPVTTable const > > m_phaseViscosityTables;
+
+  // flag indicating that the tables have been built (or rejected) already
+  bool m_pvtTablesCreated;
+
 };
 
 } //namespace constitutive
@@ -0,0 +1,60 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file UniformPVTTable.cpp
+ */
+
+#include "constitutive/fluid/PVTFunctions/UniformPVTTable.hpp"
+
+namespace geosx
+{
+
+namespace PVTProps
+{
+
+UniformPVTTable::UniformPVTTable( real64 const (&minCoord)[NDIM],
+                                  real64 const (&maxCoord)[NDIM],
+                                  localIndex const (&numPoints)[NDIM] )
+{
+  localIndex stride = 1;
+  for( localIndex dim = NDIM - 1; dim >= 0; --dim )
+  {
+    GEOSX_ERROR_IF_LT_MSG( numPoints[dim], 1, "A PVT table needs at least one point in each direction" );
+    GEOSX_ERROR_IF( numPoints[dim] > 1 && !( maxCoord[dim] > minCoord[dim] ),
+                    "Invalid PVT table range [" << minCoord[dim] << ", " << maxCoord[dim] << "]" );
+
+    m_minCoord[dim] = minCoord[dim];
+    m_numPoints[dim] = numPoints[dim];
+    if( numPoints[dim] > 1 )
+    {
+      m_spacing[dim] = ( maxCoord[dim] - minCoord[dim] ) / ( numPoints[dim] - 1 );
+      m_invSpacing[dim] = 1.0 / m_spacing[dim];
+      m_strides[dim] = stride;
+    }
+    else
+    {
+      m_spacing[dim] = 0.0;
+      m_invSpacing[dim] = 0.0;
+      m_strides[dim] = 0;
+    }
+    stride *= numPoints[dim];
+  }
+
+  m_values.resize( stride );
+}
+
+} // namespace PVTProps
+
+} // namespace geosx
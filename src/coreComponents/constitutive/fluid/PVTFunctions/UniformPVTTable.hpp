@@ -0,0 +1,247 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file UniformPVTTable.hpp
+ */
+
+#ifndef GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_UNIFORMPVTTABLE_HPP_
+#define GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_UNIFORMPVTTABLE_HPP_
+
+#include "constitutive/fluid/PVTFunctions/UtilityFunctions.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace geosx
+{
+
+namespace PVTProps
+{
+
+/**
+ * @class UniformPVTTable
+ *
+ * Tabulated phase property on a uniform (pressure, temperature, phase composition) grid,
+ * where the composition coordinate is the phase fraction of the first component of a
+ * two-component fluid. The property is evaluated by trilinear interpolation, with
+ * analytic derivatives, and extrapolated linearly outside of the grid.
+ */
+class UniformPVTTable
+{
+public:
+
+  /// Number of table coordinates: pressure, temperature and phase composition
+  static constexpr localIndex NDIM = 3;
+
+  /**
+   * @brief Constructor.
+   * @param minCoord lower bounds of the coordinates
+   * @param maxCoord upper bounds of the coordinates
+   * @param numPoints number of grid points along each coordinate (at least 1)
+   */
+  UniformPVTTable( real64 const (&minCoord)[NDIM],
+                   real64 const (&maxCoord)[NDIM],
+                   localIndex const (&numPoints)[NDIM] );
+
+  /**
+   * @brief Fill the table by sampling a function at the grid points.
+   * @tparam FUNC type of the function, callable as real64( real64 pres, real64 temp, real64 comp )
+   * @param func the function to sample
+   */
+  template< typename FUNC >
+  void fill( FUNC && func );
+
+  /**
+   * @brief Compute the maximum relative deviation between the table and a function.
+   * @tparam FUNC type of the function, callable as real64( real64 pres, real64 temp, real64 comp )
+   * @param func the reference function
+   * @return the maximum relative deviation sampled at the centers of the grid cells
+   *
+   * Cell centers are where trilinear interpolation is least accurate.
+   */
+  template< typename FUNC >
+  real64 maxRelativeDeviation( FUNC && func ) const;
+
+  /**
+   * @brief Interpolate the table.
+   * @param[in] coord the (pressure, temperature, composition) coordinates
+   * @param[out] value the interpolated value
+   * @param[out] dValue the derivatives of the value with respect to each coordinate
+   */
+  inline void interpolate( real64 const (&coord)[NDIM],
+                           real64 & value,
+                           real64 (& dValue)[NDIM] ) const;
+
+  /**
+   * @brief Evaluate the table on dual numbers, as a replacement of PVTFunction::Evaluation.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] composition the phase fraction of the first component
+   * @param[out] value the property value and its derivatives
+   */
+  inline void evaluation( EvalVarArgs const & pressure,
+                          EvalVarArgs const & temperature,
+                          EvalVarArgs const & composition,
+                          EvalVarArgs & value ) const;
+
+private:
+
+  /**
+   * @brief Get the coordinate of a grid point along one direction.
+   * @param dim the direction
+   * @param i the index of the point
+   * @return the coordinate
+   */
+  real64 gridCoord( localIndex const dim, real64 const i ) const
+  { return m_minCoord[dim] + i * m_spacing[dim]; }
+
+  /// Lower bounds of the coordinates
+  real64 m_minCoord[NDIM];
+
+  /// Grid spacing along each coordinate
+  real64 m_spacing[NDIM];
+
+  /// Inverse grid spacing along each coordinate (zero for a single point)
+  real64 m_invSpacing[NDIM];
+
+  /// Number of grid points along each coordinate
+  localIndex m_numPoints[NDIM];
+
+  /// Offset between consecutive points along each coordinate (zero for a single point)
+  localIndex m_strides[NDIM];
+
+  /// Tabulated values, composition being the fastest index
+  array1d< real64 > m_values;
+};
+
+template< typename FUNC >
+void UniformPVTTable::fill( FUNC && func )
+{
+  localIndex idx = 0;
+  for( localIndex i = 0; i < m_numPoints[0]; ++i )
+  {
+    for( localIndex j = 0; j < m_numPoints[1]; ++j )
+    {
+      for( localIndex k = 0; k < m_numPoints[2]; ++k )
+      {
+        m_values[idx++] = func( gridCoord( 0, i ), gridCoord( 1, j ), gridCoord( 2, k ) );
+      }
+    }
+  }
+}
+
+template< typename FUNC >
+real64 UniformPVTTable::maxRelativeDeviation( FUNC && func ) const
+{
+  // use the centers of the cells, or the points themselves in degenerate directions
+  localIndex numSamples[NDIM];
+  real64 shift[NDIM];
+  for( localIndex dim = 0; dim < NDIM; ++dim )
+  {
+    numSamples[dim] = m_numPoints[dim] > 1 ? m_numPoints[dim] - 1 : 1;
+    shift[dim] = m_numPoints[dim] > 1 ? 0.5 : 0.0;
+  }
+
+  real64 maxDeviation = 0.0;
+  for( localIndex i = 0; i < numSamples[0]; ++i )
+  {
+    for( localIndex j = 0; j < numSamples[1]; ++j )
+    {
+      for( localIndex k = 0; k < numSamples[2]; ++k )
+      {
+        real64 const coord[NDIM] = { gridCoord( 0, i + shift[0] ),
+                                     gridCoord( 1, j + shift[1] ),
+                                     gridCoord( 2, k + shift[2] ) };
+        real64 const exact = func( coord[0], coord[1], coord[2] );
+
+        real64 value;
+        real64 dValue[NDIM];
+        interpolate( coord, value, dValue );
+
+        real64 const scale = std::max( std::fabs( exact ), std::numeric_limits< real64 >::min() );
+        maxDeviation = std::max( maxDeviation, std::fabs( value - exact ) / scale );
+      }
+    }
+  }
+  return maxDeviation;
+}
+
+inline void UniformPVTTable::interpolate( real64 const (&coord)[NDIM],
+                                          real64 & value,
+                                          real64 (& dValue)[NDIM] ) const
+{
+  // locate the cell and the local coordinates, clamping the cell to the grid for extrapolation
+  localIndex offset = 0;
+  real64 w[NDIM];
+  for( localIndex dim = 0; dim < NDIM; ++dim )
+  {
+    real64 const s = ( coord[dim] - m_minCoord[dim] ) * m_invSpacing[dim];
+    localIndex const maxCell = m_numPoints[dim] > 1 ? m_numPoints[dim] - 2 : 0;
+    localIndex const cell = std::min( std::max( static_cast< localIndex >( std::floor( s ) ), localIndex( 0 ) ), maxCell );
+    w[dim] = s - cell;
+    offset += cell * m_strides[dim];
+  }
+
+  real64 const * const v = m_values.data() + offset;
+  localIndex const sP = m_strides[0];
+  localIndex const sT = m_strides[1];
+  localIndex const sX = m_strides[2];
+
+  // interpolate along composition
+  real64 const c00 = v[0]       + w[2] * ( v[sX]           - v[0] );
+  real64 const c01 = v[sT]      + w[2] * ( v[sT + sX]      - v[sT] );
+  real64 const c10 = v[sP]      + w[2] * ( v[sP + sX]      - v[sP] );
+  real64 const c11 = v[sP + sT] + w[2] * ( v[sP + sT + sX] - v[sP + sT] );
+
+  real64 const dc00 = v[sX]           - v[0];
+  real64 const dc01 = v[sT + sX]      - v[sT];
+  real64 const dc10 = v[sP + sX]      - v[sP];
+  real64 const dc11 = v[sP + sT + sX] - v[sP + sT];
+
+  // interpolate along temperature
+  real64 const c0 = c00 + w[1] * ( c01 - c00 );
+  real64 const c1 = c10 + w[1] * ( c11 - c10 );
+  real64 const dc0 = dc00 + w[1] * ( dc01 - dc00 );
+  real64 const dc1 = dc10 + w[1] * ( dc11 - dc10 );
+
+  // interpolate along pressure
+  value = c0 + w[0] * ( c1 - c0 );
+  dValue[0] = ( c1 - c0 ) * m_invSpacing[0];
+  dValue[1] = ( ( c01 - c00 ) + w[0] * ( ( c11 - c10 ) - ( c01 - c00 ) ) ) * m_invSpacing[1];
+  dValue[2] = ( dc0 + w[0] * ( dc1 - dc0 ) ) * m_invSpacing[2];
+}
+
+inline void UniformPVTTable::evaluation( EvalVarArgs const & pressure,
+                                         EvalVarArgs const & temperature,
+                                         EvalVarArgs const & composition,
+                                         EvalVarArgs & value ) const
+{
+  real64 const coord[NDIM] = { pressure.m_var, temperature.m_var, composition.m_var };
+  real64 dValue[NDIM];
+  interpolate( coord, value.m_var, dValue );
+
+  for( localIndex i = 0; i < MAX_VAR_DIM; ++i )
+  {
+    value.m_der[i] = dValue[0] * pressure.m_der[i]
+                     + dValue[1] * temperature.m_der[i]
+                     + dValue[2] * composition.m_der[i];
+  }
+}
+
+} // namespace PVTProps
+
+} // namespace geosx
+
+#endif //GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_UNIFORMPVTTABLE_HPP_
@@ -267,6 +267,84 @@ void testNumericalDerivatives( MultiFluidBase & fluid,
   } );
 }
 
+template< int DIM >
+void checkBatchUpdateField( MultiFluidBase & fluid,
+                            MultiFluidBase & fluidBatch,
+                            string const & key,
+                            real64 const relTol )
+{
+  Array< real64, DIM > const & expected = fluid.getReference< Array< real64, DIM > >( key );
+  Array< real64, DIM > const & actual = fluidBatch.getReference< Array< real64, DIM > >( key );
+
+  ASSERT_EQ( expected.size(), actual.size() );
+  for( localIndex i = 0; i < expected.size(); ++i )
+  {
+    checkRelativeError( actual.data()[i], expected.data()[i], relTol, key );
+  }
+}
+
+void testBatchUpdate( MultiFluidBase & fluid,
+                      real64 const T,
+                      real64 const relTol )
+{
+  localIndex const batchSize = MultiFluidBaseUpdate::BATCH_SIZE;
+  localIndex const numElems = batchSize + 3;
+  localIndex const NC = fluid.numFluidComponents();
+  fluid.getParent()->resize( numElems );
+
+  // create a clone of the fluid to run batched updates on
+  std::unique_ptr< ConstitutiveBase > fluidBatchPtr = fluid.deliverClone( "fluidBatch", nullptr );
+  MultiFluidBase & fluidBatch = *fluidBatchPtr->group_cast< MultiFluidBase * >();
+
+  fluid.allocateConstitutiveData( fluid.getParent(), 1 );
+  fluidBatch.allocateConstitutiveData( fluid.getParent(), 1 );
+
+  array1d< real64 > pres( numElems );
+  array2d< real64 > comp( numElems, NC );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    pres[k] = 4e6 + 1e5 * k;
+    comp[k][0] = 0.099;
+    comp[k][1] = 0.3 - 0.01 * k;
+    comp[k][2] = 0.6 + 0.01 * k;
+    comp[k][3] = 0.001;
+  }
+
+  // reference: element-by-element updates
+  constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      fluidWrapper.Update( k, 0, pres[k], T, comp[k] );
+    }
+  } );
+
+  // batched updates, the last batch being only partially filled
+  constitutive::constitutiveUpdatePassThru( fluidBatch, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    for( localIndex firstElem = 0; firstElem < numElems; firstElem += batchSize )
+    {
+      array1d< real64 > batchPres( std::min( batchSize, numElems - firstElem ) );
+      for( localIndex b = 0; b < batchPres.size(); ++b )
+      {
+        batchPres[b] = pres[firstElem + b];
+      }
+      fluidWrapper.BatchUpdate( firstElem, batchPres.toSliceConst(), T, comp.toViewConst() );
+    }
+  } );
+
+  checkBatchUpdateField< 3 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::phaseFractionString, relTol );
+  checkBatchUpdateField< 4 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::dPhaseFraction_dGlobalCompFractionString, relTol );
+  checkBatchUpdateField< 3 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::phaseDensityString, relTol );
+  checkBatchUpdateField< 3 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::dPhaseDensity_dPressureString, relTol );
+  checkBatchUpdateField< 4 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::phaseCompFractionString, relTol );
+  checkBatchUpdateField< 5 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::dPhaseCompFraction_dGlobalCompFractionString, relTol );
+  checkBatchUpdateField< 2 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::totalDensityString, relTol );
+  checkBatchUpdateField< 3 >( fluid, fluidBatch, MultiFluidBase::viewKeyStruct::dTotalDensity_dGlobalCompFractionString, relTol );
+}
+
 MultiFluidBase * makeCompositionalFluid( string const & name, Group & parent )
 {
   auto fluid = parent.RegisterGroup< CompositionalMultiphaseFluid >( name );
@@ -356,6 +434,18 @@ TEST_F( CompositionalFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol );
 }
 
+TEST_F( CompositionalFluidTest, batchUpdateMolar )
+{
+  fluid->setMassFlag( false );
+  testBatchUpdate( *fluid, 297.15, 1e-12 );
+}
+
+TEST_F( CompositionalFluidTest, batchUpdateMass )
+{
+  fluid->setMassFlag( true );
+  testBatchUpdate( *fluid, 297.15, 1e-10 );
+}
+
 MultiFluidBase * makeLiveOilFluid( string const & name, Group * parent )
 {
   auto fluid = parent->RegisterGroup< BlackOilFluid >( name );
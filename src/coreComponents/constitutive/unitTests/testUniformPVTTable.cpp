@@ -0,0 +1,120 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "constitutive/fluid/PVTFunctions/UniformPVTTable.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::PVTProps;
+
+namespace
+{
+
+// trilinear functions are reproduced exactly by the table
+real64 trilinear( real64 const p, real64 const t, real64 const x )
+{
+  return 2.0 + 1e-7 * p - 0.5 * t + 3.0 * x + 1e-8 * p * t * x;
+}
+
+}
+
+TEST( UniformPVTTable, trilinearInterpolation )
+{
+  real64 const minCoord[3] = { 1e6, 20.0, 0.0 };
+  real64 const maxCoord[3] = { 5e7, 80.0, 1.0 };
+  localIndex const numPoints[3] = { 11, 4, 6 };
+
+  UniformPVTTable table( minCoord, maxCoord, numPoints );
+  table.fill( trilinear );
+
+  EXPECT_NEAR( table.maxRelativeDeviation( trilinear ), 0.0, 1e-12 );
+
+  // inside the grid and extrapolated outside of it
+  real64 const points[4][3] = { { 2.3e6, 31.0, 0.37 },
+                                { 4.9e7, 79.0, 0.99 },
+                                { 5e5, 10.0, -0.1 },
+                                { 6e7, 90.0, 1.2 } };
+
+  for( auto const & coord : points )
+  {
+    real64 value;
+    real64 dValue[3];
+    table.interpolate( coord, value, dValue );
+
+    real64 const p = coord[0];
+    real64 const t = coord[1];
+    real64 const x = coord[2];
+    EXPECT_NEAR( value, trilinear( p, t, x ), 1e-10 * std::fabs( trilinear( p, t, x ) ) );
+    EXPECT_NEAR( dValue[0], 1e-7 + 1e-8 * t * x, 1e-12 );
+    EXPECT_NEAR( dValue[1], -0.5 + 1e-8 * p * x, 1e-8 );
+    EXPECT_NEAR( dValue[2], 3.0 + 1e-8 * p * t, 1e-6 );
+  }
+}
+
+TEST( UniformPVTTable, singleTemperature )
+{
+  real64 const minCoord[3] = { 1e6, 50.0, 0.0 };
+  real64 const maxCoord[3] = { 5e7, 50.0, 1.0 };
+  localIndex const numPoints[3] = { 21, 1, 11 };
+
+  auto const func = []( real64 const p, real64 const t, real64 const x )
+  {
+    return std::exp( 1e-8 * p ) * ( 1.0 + x * x ) + t;
+  };
+
+  UniformPVTTable table( minCoord, maxCoord, numPoints );
+  table.fill( func );
+
+  // second-order error of linear interpolation
+  EXPECT_LT( table.maxRelativeDeviation( func ), 5e-3 );
+
+  // dual number evaluation applies the chain rule
+  EvalVarArgs pres( 2e7 );
+  pres.m_der[0] = 1.0;
+  EvalVarArgs temp( 50.0 );
+  EvalVarArgs comp( 0.4 );
+  comp.m_der[1] = 0.5;
+  comp.m_der[2] = -0.5;
+
+  EvalVarArgs value;
+  table.evaluation( pres, temp, comp, value );
+
+  real64 const coord[3] = { pres.m_var, temp.m_var, comp.m_var };
+  real64 expected;
+  real64 dExpected[3];
+  table.interpolate( coord, expected, dExpected );
+
+  EXPECT_DOUBLE_EQ( value.m_var, expected );
+  EXPECT_DOUBLE_EQ( value.m_der[0], dExpected[0] );
+  EXPECT_DOUBLE_EQ( value.m_der[1], 0.5 * dExpected[2] );
+  EXPECT_DOUBLE_EQ( value.m_der[2], -0.5 * dExpected[2] );
+  EXPECT_DOUBLE_EQ( value.m_der[3], 0.0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
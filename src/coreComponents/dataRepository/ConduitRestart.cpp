@@ -24,6 +24,14 @@
 
 // TPL includes
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_hdf5.hpp>
+
+// System includes
+#include <cstring>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
 
 namespace geosx
 {
@@ -32,12 +40,263 @@ namespace dataRepository
 
 conduit::Node rootConduitNode;
 
+namespace
+{
+
+/// The background write of the last restart tree, if any
+std::future< void > pendingTreeWrite;
+
+/// Name of the tree of a rank in an aggregated restart file
+std::string rankTreeName( int const rank )
+{
+  char buffer[ 32 ];
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 32, "rank_%07d", rank ), 32 );
+  return buffer;
+}
+
+/**
+ * @brief Gather the compacted trees of the ranks of a group on the first rank of the group.
+ * @param groupComm the communicator of the group
+ * @param tree the tree of this rank
+ * @param aggregate the node receiving a child per rank on the first rank of the group
+ */
+void gatherTrees( MPI_Comm const groupComm, conduit::Node const & tree, conduit::Node & aggregate )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const groupRank = MpiWrapper::Comm_rank( groupComm );
+  int const groupSize = MpiWrapper::Comm_size( groupComm );
+  int const rank = MpiWrapper::Comm_rank();
+
+  conduit::Node local;
+  tree.compact_to( local );
+
+  std::string const schema = local.schema().to_json();
+  std::vector< conduit::uint8 > data;
+  local.serialize( data );
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
+  GEOSX_ERROR_IF_GT_MSG( data.size(), static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                         "Restart data of rank " << rank << " is too large to be aggregated" );
+  int const sizes[ 2 ] = { LvArray::integerConversion< int >( schema.size() ), LvArray::integerConversion< int >( data.size() ) };
+  std::vector< int > allSizes( 2 * groupSize );
+  MpiWrapper::gather( sizes, 2, allSizes.data(), 2, 0, groupComm );
+
+  std::vector< int > schemaCounts( groupSize ), schemaOffsets( groupSize + 1, 0 );
+  std::vector< int > dataCounts( groupSize ), dataOffsets( groupSize + 1, 0 );
+  if( groupRank == 0 )
+  {
+    std::int64_t totalData = 0;
+    for( int r = 0; r < groupSize; ++r )
+    {
+      schemaCounts[r] = allSizes[2 * r];
+      dataCounts[r] = allSizes[2 * r + 1];
+      schemaOffsets[r + 1] = schemaOffsets[r] + schemaCounts[r];
+      totalData += dataCounts[r];
+      GEOSX_ERROR_IF_GT_MSG( totalData, std::numeric_limits< int >::max(),
+                             "Aggregated restart data is too large, reduce the number of ranks per file" );
+      dataOffsets[r + 1] = LvArray::integerConversion< int >( totalData );
+    }
+  }
+
+  std::vector< char > allSchemas( schemaOffsets.back() );
+  std::vector< char > allData( dataOffsets.back() );
+  MpiWrapper::gatherv( schema.data(), sizes[0], allSchemas.data(), schemaCounts.data(), schemaOffsets.data(), 0, groupComm );
+  MpiWrapper::gatherv( reinterpret_cast< char const * >( data.data() ), sizes[1],
+                       allData.data(), dataCounts.data(), dataOffsets.data(), 0, groupComm );
+
+  if( groupRank == 0 )
+  {
+    for( int r = 0; r < groupSize; ++r )
+    {
+      conduit::Schema const rankSchema( std::string( allSchemas.data() + schemaOffsets[r], schemaCounts[r] ) );
+      aggregate[ rankTreeName( rank + r ) ].set_data_using_schema( rankSchema, allData.data() + dataOffsets[r] );
+    }
+  }
+}
+
+/// Check whether a node holds the data of a wrapper (see Wrapper::registerToWrite)
+bool isWrapperNode( conduit::Node const & node )
+{
+  return node.has_child( "__sizedFromParent__" );
+}
+
+/// Accumulate a range of bytes into a 64-bit FNV-1a hash, a word at a time
+std::uint64_t hashBytes( void const * const data, std::size_t const numBytes, std::uint64_t hash )
 {
+  constexpr std::uint64_t prime = 1099511628211ULL;
+  unsigned char const * const bytes = static_cast< unsigned char const * >( data );
+
+  std::size_t const numWords = numBytes / sizeof( std::uint64_t );
+  for( std::size_t i = 0; i < numWords; ++i )
+  {
+    std::uint64_t word;
+    std::memcpy( &word, bytes + i * sizeof( std::uint64_t ), sizeof( std::uint64_t ) );
+    hash = ( hash ^ word ) * prime;
+  }
+  for( std::size_t i = numWords * sizeof( std::uint64_t ); i < numBytes; ++i )
+  {
+    hash = ( hash ^ bytes[i] ) * prime;
+  }
+  return hash;
+}
+
+/// Accumulate the names, types and values of the leaves of a node into a hash
+std::uint64_t hashNode( conduit::Node const & node, std::uint64_t hash )
+{
+  conduit::index_t const numChildren = node.number_of_children();
+  if( numChildren == 0 )
+  {
+    conduit::DataType const & dtype = node.dtype();
+    conduit::index_t const header[ 2 ] = { dtype.id(), dtype.number_of_elements() };
+    hash = hashBytes( header, sizeof( header ), hash );
+    if( dtype.is_compact() )
+    {
+      return hashBytes( node.data_ptr(), dtype.bytes_compact(), hash );
+    }
+    conduit::Node compact;
+    node.compact_to( compact );
+    return hashBytes( compact.data_ptr(), compact.dtype().bytes_compact(), hash );
+  }
+
+  for( conduit::index_t i = 0; i < numChildren; ++i )
+  {
+    std::string const & name = node.child( i ).name();
+    hash = hashBytes( name.data(), name.size(), hash );
+    hash = hashNode( node.child( i ), hash );
+  }
+  return hash;
+}
+
+/**
+ * @brief Reference the wrappers of a tree that changed since a base tree, and all group metadata.
+ * @param tree the tree to extract from
+ * @param baseHashes the wrapper hashes of the base tree
+ * @param delta the node receiving external references to the changed parts of @p tree
+ */
+void extractDelta( conduit::Node & tree, TreeHashes const & baseHashes, conduit::Node & delta )
+{
+  for( conduit::index_t i = 0; i < tree.number_of_children(); ++i )
+  {
+    conduit::Node & child = tree.child( i );
+    std::string const & name = child.name();
+    if( isWrapperNode( child ) )
+    {
+      TreeHashes::const_iterator const iter = baseHashes.find( child.path() );
+      if( iter == baseHashes.end() || iter->second != hashNode( child, 0 ) )
+      {
+        delta[ name ].set_external( child );
+      }
+    }
+    else if( child.number_of_children() == 0 )
+    {
+      // group metadata, e.g. its size
+      delta[ name ].set_external( child );
+    }
+    else
+    {
+      extractDelta( child, baseHashes, delta[ name ] );
+      if( delta[ name ].number_of_children() == 0 )
+      {
+        delta.remove( name );
+      }
+    }
+  }
+}
+
+/// Replace the wrappers and group metadata of a tree by those of a delta
+void mergeDelta( conduit::Node const & delta, conduit::Node & tree )
+{
+  for( conduit::index_t i = 0; i < delta.number_of_children(); ++i )
+  {
+    conduit::Node const & child = delta.child( i );
+    conduit::Node & target = tree[ child.name() ];
+    if( isWrapperNode( child ) || child.number_of_children() == 0 )
+    {
+      target.reset();
+      target.set( child );
+    }
+    else
+    {
+      mergeDelta( child, target );
+    }
+  }
+}
+
+/**
+ * @brief Write a tree to the restart files of a given root file.
+ * @param tree the tree to write
+ * @param root the root node, may already contain additional metadata
+ * @param path the path of the root file
+ * @param ranksPerFile the number of ranks written in each file
+ * @param async whether to write in the background
+ */
+void writeNode( conduit::Node & tree,
+                conduit::Node & root,
+                std::string const & path,
+                int const ranksPerFile,
+                bool const async )
+{
+  // only one tree is written at a time
+  waitForTreeWrite();
+
+  std::string const filePath = writeRootFile( root, path, ranksPerFile );
+
+  // snapshot the tree, since the data it refers to may change as soon as this function returns
+  std::shared_ptr< conduit::Node > snapshot = std::make_shared< conduit::Node >();
+  bool isWriter = true;
+  if( ranksPerFile == 1 )
+  {
+    if( !async )
+    {
+      GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+      conduit::relay::io::save( tree, filePath, "hdf5" );
+      return;
+    }
+    tree.compact_to( *snapshot );
+  }
+  else
+  {
+    int const rank = MpiWrapper::Comm_rank();
+    MPI_Comm groupComm = MpiWrapper::Comm_split( MPI_COMM_GEOSX, rank / ranksPerFile, rank );
+    isWriter = MpiWrapper::Comm_rank( groupComm ) == 0;
+    gatherTrees( groupComm, tree, *snapshot );
+    MpiWrapper::Comm_free( groupComm );
+  }
+
+  if( !isWriter )
+  {
+    return;
+  }
+
+  GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+  auto write = [snapshot, filePath]()
+  {
+    conduit::relay::io::save( *snapshot, filePath, "hdf5" );
+  };
+
+  if( async )
+  {
+    pendingTreeWrite = std::async( std::launch::async, write );
+  }
+  else
+  {
+    write();
+  }
+}
+
+}
+
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, int const ranksPerFile )
+{
+  GEOSX_ERROR_IF_LT( ranksPerFile, 1 );
+
   std::string rootDirName, rootFileName;
   splitPath( rootPath, rootDirName, rootFileName );
 
+  int const numRanks = MpiWrapper::Comm_size();
+  int const numFiles = ( numRanks + ranksPerFile - 1 ) / ranksPerFile;
+  char const * const filePattern = ranksPerFile == 1 ? "/rank_%07d.hdf5" : "/file_%07d.hdf5";
+
   if( MpiWrapper::Comm_rank() == 0 )
   {
     makeDirsForPath( rootPath );
@@ -45,33 +304,53 @@ std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
     root[ "protocol/name" ] = "hdf5";
     root[ "protocol/version" ] = CONDUIT_VERSION;
 
-    root[ "number_of_files" ] = MpiWrapper::Comm_size();
-    root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+    root[ "number_of_files" ] = numFiles;
+    root[ "file_pattern" ] = rootFileName + filePattern;
 
-    root[ "number_of_trees" ] = 1;
-    root[ "tree_pattern" ] = "/";
+    if( ranksPerFile == 1 )
+    {
+      root[ "number_of_trees" ] = 1;
+      root[ "tree_pattern" ] = "/";
+    }
+    else
+    {
+      root[ "number_of_trees" ] = numRanks;
+      root[ "tree_pattern" ] = "rank_%07d/";
+      root[ "ranks_per_file" ] = ranksPerFile;
+    }
 
     conduit::relay::io::save( root, rootPath + ".root", "hdf5" );
   }
 
   MpiWrapper::Barrier( MPI_COMM_GEOSX );
 
-  std::vector< char > buffer( rootPath.size() + 64 );
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), "%s/rank_%07d.hdf5", rootPath.data(), MpiWrapper::Comm_rank() ), 1024 );
+  std::string const rankFilePattern = rootPath + filePattern;
+  std::vector< char > buffer( rankFilePattern.size() + 64 );
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), rankFilePattern.data(), MpiWrapper::Comm_rank() / ranksPerFile ), 1024 );
   return buffer.data();
 }
 
 
-std::string readRootNode( std::string const & rootPath )
+std::string readRootNode( std::string const & rootPath, std::string & treePath, std::string & basePath )
 {
   std::string rankFilePattern;
+  int ranksPerFile = 1;
   if( MpiWrapper::Comm_rank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
-    int const nFiles = node.fetch_child( "number_of_files" ).value();
-    GEOSX_ERROR_IF_NE( nFiles, MpiWrapper::Comm_size() );
+    if( node.has_child( "ranks_per_file" ) )
+    {
+      ranksPerFile = node.fetch_child( "ranks_per_file" ).value();
+      int const nTrees = node.fetch_child( "number_of_trees" ).value();
+      GEOSX_ERROR_IF_NE( nTrees, MpiWrapper::Comm_size() );
+    }
+    else
+    {
+      int const nFiles = node.fetch_child( "number_of_files" ).value();
+      GEOSX_ERROR_IF_NE( nFiles, MpiWrapper::Comm_size() );
+    }
 
     std::string const filePattern = node.fetch_child( "file_pattern" ).as_string();
 
@@ -80,33 +359,123 @@ std::string readRootNode( std::string const & rootPath )
 
     rankFilePattern = rootDirName + "/" + filePattern;
     GEOSX_LOG_RANK_VAR( rankFilePattern );
+
+    if( node.has_child( "base_restart" ) )
+    {
+      basePath = rootDirName + "/" + node.fetch_child( "base_restart" ).as_string();
+    }
   }
 
   MpiWrapper::Broadcast( rankFilePattern, 0 );
+  MpiWrapper::Broadcast( ranksPerFile, 0 );
+  MpiWrapper::Broadcast( basePath, 0 );
+
+  int const rank = MpiWrapper::Comm_rank();
+  treePath = ranksPerFile == 1 ? std::string() : rankTreeName( rank );
 
   char buffer[ 1024 ];
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::Comm_rank() ), 1024 );
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), rank / ranksPerFile ), 1024 );
   return buffer;
 }
 
 /* Write out a restart file. */
-void writeTree( std::string const & path )
+void writeTree( std::string const & path, int const ranksPerFile, bool const async )
+{
+  GEOSX_MARK_FUNCTION;
+
+  conduit::Node root;
+  writeNode( rootConduitNode, root, path, ranksPerFile, async );
+}
+
+
+TreeHashes hashTree()
+{
+  GEOSX_MARK_FUNCTION;
+
+  TreeHashes hashes;
+  std::function< void( conduit::Node const & ) > hashWrappers = [&]( conduit::Node const & node )
+  {
+    for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+    {
+      conduit::Node const & child = node.child( i );
+      if( isWrapperNode( child ) )
+      {
+        hashes[ child.path() ] = hashNode( child, 0 );
+      }
+      else
+      {
+        hashWrappers( child );
+      }
+    }
+  };
+  hashWrappers( rootConduitNode );
+  return hashes;
+}
+
+
+void writeDeltaTree( std::string const & path,
+                     std::string const & basePath,
+                     TreeHashes const & baseHashes,
+                     int const ranksPerFile,
+                     bool const async )
 {
   GEOSX_MARK_FUNCTION;
 
+  conduit::Node delta;
+  extractDelta( rootConduitNode, baseHashes, delta );
+
+  // the base is looked up next to the delta when loading
+  std::string baseDirName, baseFileName;
+  splitPath( basePath, baseDirName, baseFileName );
+
   conduit::Node root;
-  std::string const filePathForRank = writeRootFile( root, path );
-  GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
-  conduit::relay::io::save( rootConduitNode, filePathForRank, "hdf5" );
+  root[ "base_restart" ] = baseFileName;
+  writeNode( delta, root, path, ranksPerFile, async );
+}
+
+
+void waitForTreeWrite()
+{
+  if( pendingTreeWrite.valid() )
+  {
+    GEOSX_MARK_FUNCTION;
+    // rethrows any error of the background write
+    pendingTreeWrite.get();
+  }
 }
 
 
 void loadTree( std::string const & path )
 {
   GEOSX_MARK_FUNCTION;
-  std::string const filePathForRank = readRootNode( path );
+
+  waitForTreeWrite();
+
+  std::string treePath, basePath;
+  std::string const filePathForRank = readRootNode( path, treePath, basePath );
+
+  // a delta restart is applied on top of its base
+  conduit::Node delta;
+  conduit::Node & tree = basePath.empty() ? rootConduitNode : delta;
+  if( !basePath.empty() )
+  {
+    loadTree( basePath );
+  }
+
   GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
-  conduit::relay::io::load( filePathForRank, "hdf5", rootConduitNode );
+  if( treePath.empty() )
+  {
+    conduit::relay::io::load( filePathForRank, "hdf5", tree );
+  }
+  else
+  {
+    conduit::relay::io::hdf5_read( filePathForRank, treePath, tree );
+  }
+
+  if( !basePath.empty() )
+  {
+    mergeDelta( delta, rootConduitNode );
+  }
 }
 
 } /* end namespace dataRepository */
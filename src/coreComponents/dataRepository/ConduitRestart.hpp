@@ -27,6 +27,8 @@
 #include <conduit.hpp>
 
 // System includes
+#include <cstdint>
+#include <map>
 #include <string>
 
 /// @cond DO_NOT_DOCUMENT
@@ -88,9 +90,21 @@ using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::rem
 
 extern conduit::Node rootConduitNode;
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath );
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, int const ranksPerFile = 1 );
 
-void writeTree( std::string const & path );
+void writeTree( std::string const & path, int const ranksPerFile = 1, bool const async = false );
+
+void waitForTreeWrite();
+
+using TreeHashes = std::map< std::string, std::uint64_t >;
+
+TreeHashes hashTree();
+
+void writeDeltaTree( std::string const & path,
+                     std::string const & basePath,
+                     TreeHashes const & baseHashes,
+                     int const ranksPerFile = 1,
+                     bool const async = false );
 
 void loadTree( std::string const & path );
 
@@ -93,6 +93,15 @@ public:
     return std::numeric_limits< integer >::max();
   }
 
+  /**
+   * @brief Check whether the timestep request of this target is the same on all ranks.
+   * @return @p true if GetTimestepRequest() only depends on globally reduced quantities
+   * @note The event manager reduces the timestep across ranks unless all the targets opt in by
+   *       overriding this method, after checking that their request does not use rank-local data.
+   */
+  virtual bool IsTimestepRequestRankInvariant() const
+  { return false; }
+
 
   /**
    * @brief Set the timestep behavior for a target.
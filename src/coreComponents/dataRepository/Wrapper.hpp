@@ -474,6 +474,10 @@ public:
   virtual localIndex elementByteSize() const override
   { return wrapperHelpers::byteSizeOfElement< T >(); }
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual localIndex indexSliceByteSize() const override
+  { return sizedFromParent() == 1 ? wrapperHelpers::indexSliceByteSize( reference() ) : 0; }
+
   /**
    * @name Methods that delegate to the wrapped type
    *
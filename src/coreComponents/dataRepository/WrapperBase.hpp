@@ -102,6 +102,13 @@ public:
    */
   virtual localIndex elementByteSize() const = 0;
 
+  /**
+   * @brief @return the number of bytes of the contiguous block of memory holding the values of a single index,
+   *        or 0 if the values of an index are not stored contiguously as trivially copyable data.
+   * @note Only objects sized from their parent are considered, others are never packed by index.
+   */
+  virtual localIndex indexSliceByteSize() const = 0;
+
   /**
    * @brief Calls T::resize( num_dims, dims )
    * @param[in] num_dims number of dimensions in T
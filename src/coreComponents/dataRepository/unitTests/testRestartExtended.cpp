@@ -20,6 +20,7 @@
 #include "dataRepository/Wrapper.hpp"
 
 // TPL includes
+#include <conduit_relay.hpp>
 #include <gtest/gtest.h>
 
 
@@ -473,6 +474,94 @@ TEST( testRestartExtended, testRestartExtended )
   delete root;
 }
 
+
+TEST( testRestartExtended, AsyncAggregatedWrite )
+{
+  std::string const path = "test_restart_async_aggregated";
+  int const sfp = 1;
+
+  array1d< real64 > data( 50 );
+  for( localIndex i = 0; i < data.size(); ++i )
+  {
+    data[i] = i * 0.5;
+  }
+
+  Group * root = new Group( std::string( "data" ), nullptr );
+  createArrayView( root, "values", sfp, data );
+
+  /* Write with aggregation in the background, then modify the data: the snapshot must not change */
+  root->prepareToWrite();
+  writeTree( path, 2, true );
+  root->finishWriting();
+  root->getReference< array1d< real64 > >( "values" ).setValues< serialPolicy >( -1.0 );
+  waitForTreeWrite();
+
+  delete root;
+  rootConduitNode.reset();
+
+  loadTree( path );
+  root = new Group( std::string( "data" ), nullptr );
+  Wrapper< array1d< real64 > > * values = root->registerWrapper< array1d< real64 > >( "values" );
+  root->loadFromConduit();
+
+  checkArrayView( values, sfp, data );
+
+  delete root;
+}
+
+TEST( testRestartExtended, DeltaWrite )
+{
+  std::string const basePath = "test_restart_delta_base";
+  std::string const deltaPath = "test_restart_delta";
+  int const sfp = 1;
+
+  array1d< real64 > fixedData( 50 );
+  array1d< real64 > varyingData( 50 );
+  for( localIndex i = 0; i < fixedData.size(); ++i )
+  {
+    fixedData[i] = i * 0.5;
+    varyingData[i] = i * 2.0;
+  }
+
+  Group * root = new Group( std::string( "data" ), nullptr );
+  createArrayView( root, "fixed", sfp, fixedData );
+  createArrayView( root, "varying", sfp, varyingData );
+
+  /* Write a full tree, then a delta after modifying one of the wrappers */
+  root->prepareToWrite();
+  writeTree( basePath );
+  TreeHashes const baseHashes = hashTree();
+  root->finishWriting();
+
+  varyingData.setValues< serialPolicy >( -1.0 );
+  root->getReference< array1d< real64 > >( "varying" ).setValues< serialPolicy >( -1.0 );
+
+  root->prepareToWrite();
+  writeDeltaTree( deltaPath, basePath, baseHashes );
+  root->finishWriting();
+
+  delete root;
+  rootConduitNode.reset();
+
+  /* Only the modified wrapper is in the delta */
+  conduit::Node deltaCheck;
+  conduit::relay::io::load( deltaPath + "/rank_0000000.hdf5", "hdf5", deltaCheck );
+  EXPECT_FALSE( deltaCheck.has_path( "data/fixed" ) );
+  EXPECT_TRUE( deltaCheck.has_path( "data/varying" ) );
+
+  /* Loading the delta restores both wrappers */
+  loadTree( deltaPath );
+  root = new Group( std::string( "data" ), nullptr );
+  Wrapper< array1d< real64 > > * fixed = root->registerWrapper< array1d< real64 > >( "fixed" );
+  Wrapper< array1d< real64 > > * varying = root->registerWrapper< array1d< real64 > >( "varying" );
+  root->loadFromConduit();
+
+  checkArrayView( fixed, sfp, fixedData );
+  checkArrayView( varying, sfp, varyingData );
+
+  delete root;
+}
+
 } /* end namespace dataRepository */
 } /* end namespace geosx */
 
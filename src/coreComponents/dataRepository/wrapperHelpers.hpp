@@ -186,6 +186,32 @@ byteSize( T const & value )
 { return size( value ) * byteSizeOfElement< T >(); }
 
 
+template< typename T, int NDIM, typename PERMUTATION >
+inline std::enable_if_t< bufferOps::can_memcpy< T >, localIndex >
+indexSliceByteSize( Array< T, NDIM, PERMUTATION > const & var )
+{
+  // The slice of an index is a contiguous block of memory only for the row-major layout.
+  localIndex expectedStride = 1;
+  for( int dim = NDIM - 1; dim >= 0; --dim )
+  {
+    if( var.strides()[ dim ] != expectedStride )
+    {
+      return 0;
+    }
+    if( dim > 0 )
+    {
+      expectedStride *= var.size( dim );
+    }
+  }
+  return expectedStride * LvArray::integerConversion< localIndex >( sizeof( T ) );
+}
+
+template< typename T >
+inline localIndex
+indexSliceByteSize( T const & GEOSX_UNUSED_PARAM( value ) )
+{ return 0; }
+
+
 template< typename T >
 inline localIndex
 numElementsFromByteSize( localIndex const byteSize )
@@ -144,6 +144,7 @@ void ChomboCoupler::read( bool usePressures )
         reference_pos( i, j ) = m_referencePositionCopy( i, j );
       }
     }
+    nodes->referencePositionModified();
   }
 
   int rank;
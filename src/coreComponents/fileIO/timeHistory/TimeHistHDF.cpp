@@ -2,13 +2,31 @@
 
 #include "managers/Outputs/TimeHistoryOutput.hpp"
 
+#include "dataRepository/ConduitRestart.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 
 #include <hdf5.h>
 
+#include <algorithm>
+#include <future>
+
 namespace geosx
 {
 
+namespace
+{
+
+/// The background write of the states buffered by a time history, at most one is in flight at any time
+std::future< void > pendingHistoryWrite;
+
+/// The targeted size of the chunks of the datasets in persistent files, in bytes
+constexpr hsize_t targetChunkSize = 1 << 20;
+
+/// The largest number of states in a chunk of the datasets in persistent files
+constexpr hsize_t maxChunkStates = 1024;
+
+}
+
 /**
  * @brief Get the HDF data type for the specified type
  * @tparam T the type to get info for
@@ -38,6 +56,8 @@ inline hid_t GetHDFDataType< long long >() { return H5T_NATIVE_LLONG; }
  */
 inline hid_t GetHDFDataType( std::type_index const & type )
 {
+  // the native types are resolved by the HDF5 library
+  waitForHDFWrites();
   if( type == std::type_index( typeid(char)) )
   {
     return GetHDFDataType< char >();
@@ -83,6 +103,16 @@ inline hid_t GetHDFArrayDataType( std::type_index const & type, hsize_t const ra
   return H5Tarray_create( GetHDFDataType( type ), rank, dims );
 }
 
+void waitForHDFWrites()
+{
+  if( pendingHistoryWrite.valid() )
+  {
+    // rethrows any error of the background write
+    pendingHistoryWrite.get();
+  }
+  dataRepository::waitForTreeWrite();
+}
+
 HDFFile::HDFFile( string const & fnm, bool deleteExisting, bool parallelAccess, MPI_Comm comm ):
   m_filename( ),
   m_fileId( 0 ),
@@ -90,6 +120,8 @@ HDFFile::HDFFile( string const & fnm, bool deleteExisting, bool parallelAccess,
   m_mpioFapl( parallelAccess ),
   m_comm( comm )
 {
+  // no other HDF5 call may run while the file is opened
+  waitForHDFWrites();
   int rnk = MpiWrapper::Comm_rank( comm );
 #ifdef GEOSX_USE_MPI
   if( m_mpioFapl )
@@ -134,6 +166,7 @@ HDFFile::HDFFile( string const & fnm, bool deleteExisting, bool parallelAccess,
 
 HDFFile::~HDFFile()
 {
+  waitForHDFWrites();
   if( m_mpioFapl )
   {
     H5Pclose( m_faplId );
@@ -164,7 +197,11 @@ HDFHistIO::HDFHistIO( string const & filename,
   m_dims( rank ),
   m_name( name ),
   m_comm( comm ),
-  m_subcomm( MPI_COMM_NULL )
+  m_subcomm( MPI_COMM_NULL ),
+  m_file(),
+  m_dataset( 0 ),
+  m_asyncWrite( false ),
+  m_writeBuffer( 0 )
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
   {
@@ -174,6 +211,17 @@ HDFHistIO::HDFHistIO( string const & filename,
   m_dataBuffer.resize( initAlloc * m_typeSize * m_typeCount );
 }
 
+HDFHistIO::~HDFHistIO()
+{
+  close( );
+}
+
+void HDFHistIO::setPersistentFile( std::shared_ptr< HDFFile > file, bool asyncWrite )
+{
+  m_file = std::move( file );
+  m_asyncWrite = asyncWrite;
+}
+
 void HDFHistIO::init( bool exists_okay )
 {
   globalIndex localIdxCount = LvArray::integerConversion< globalIndex >( m_dims[0] );
@@ -209,53 +257,136 @@ void HDFHistIO::init( bool exists_okay )
     }
   }
 
+  if( m_file )
+  {
+    // all ranks open the dataset in the persistent file, the chunk size is the same on all ranks
+    if( m_globalIdxCount > 0 )
+    {
+      waitForHDFWrites();
+      m_dataset = openDataset( *m_file, minIdxCount, exists_okay );
+    }
+    return;
+  }
+
   m_subcomm = MpiWrapper::Comm_split( m_comm, color, key );
   // create a dataset in the file if needed, don't erase file
   if( m_subcomm != MPI_COMM_NULL )
   {
-    std::vector< hsize_t > historyFileDims( m_rank+1 );
-    historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
+    HDFFile target( m_filename, false, true, m_subcomm );
+    H5Dclose( openDataset( target, minIdxCount, exists_okay ) );
+  }
+}
 
-    std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+hid_t HDFHistIO::openDataset( HDFTarget & target, hsize_t minIdxCount, bool exists_okay )
+{
+  std::vector< hsize_t > historyFileDims( m_rank+1 );
+  historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
+
+  std::vector< hsize_t > dimChunks( m_rank+1 );
+  dimChunks[0] = 1;
 
+  for( hsize_t dd = 1; dd < m_rank+1; ++dd )
+  {
+    // a process with chunk size 0 is considered incorrect by hdf5, hence the subcomm
+    dimChunks[dd] = m_dims[dd-1];
+    historyFileDims[dd] = m_dims[dd-1];
+  }
+  dimChunks[1] = minIdxCount;
+  historyFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
+
+  if( m_file )
+  {
+    // the dataset is accessed often: group several states in each chunk to reduce the number of chunk accesses
+    hsize_t chunkStateSize = m_typeSize;
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
-      // a process with chunk size 0 is considered incorrect by hdf5, hence the subcomm
-      dimChunks[dd] = m_dims[dd-1];
-      historyFileDims[dd] = m_dims[dd-1];
+      chunkStateSize *= dimChunks[dd];
     }
-    dimChunks[1] = minIdxCount;
-    historyFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
+    dimChunks[0] = std::max( hsize_t( 1 ), std::min( maxChunkStates, targetChunkSize / chunkStateSize ) );
+  }
 
-    HDFFile target( m_filename, false, true, m_subcomm );
+  bool inTarget = target.CheckInTarget( m_name );
+  GEOSX_ERROR_IF( inTarget && !exists_okay, "Dataset (" + m_name + ") already exists in output file: " + m_filename );
+  if( inTarget )
+  {
+    // todo: check that the extent of the filespace is compatible with the data
+    return H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+  }
 
-    bool inTarget = target.CheckInTarget( m_name );
-    if( !inTarget )
-    {
-      hid_t dcplId = 0;
-      std::vector< hsize_t > maxFileDims( historyFileDims );
-      // chunking is required to create an extensible dataset
-      dcplId = H5Pcreate( H5P_DATASET_CREATE );
-      H5Pset_chunk( dcplId, m_rank+1, &dimChunks[0] );
-      maxFileDims[0] = H5S_UNLIMITED;
-      hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
-      hid_t dataset = H5Dcreate( target, m_name.c_str(), m_hdfType, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
-      H5Dclose( dataset );
-      H5Sclose( space );
-    }
-    else if( exists_okay )
-    {
-      // todo:
-      // hid_t dataset = H5Dopen(target, m_name.c_str( ), H5P_DEFAULT);
-      // check that the extent of the filespace is compatible with the data
-    }
-    GEOSX_ERROR_IF( inTarget && !exists_okay, "Dataset (" + m_name + ") already exists in output file: " + m_filename );
+  std::vector< hsize_t > maxFileDims( historyFileDims );
+  // chunking is required to create an extensible dataset
+  hid_t dcplId = H5Pcreate( H5P_DATASET_CREATE );
+  H5Pset_chunk( dcplId, m_rank+1, &dimChunks[0] );
+  maxFileDims[0] = H5S_UNLIMITED;
+  hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
+  hid_t dataset = H5Dcreate( target, m_name.c_str(), m_hdfType, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
+  H5Sclose( space );
+  H5Pclose( dcplId );
+  return dataset;
+}
+
+void HDFHistIO::writeStates( hid_t dataset, buffer_unit_type const * data, localIndex writeHead, localIndex count )
+{
+  hid_t filespace = H5Dget_space( dataset );
+
+  std::vector< hsize_t > fileOffset( m_rank+1 );
+  fileOffset[0] = LvArray::integerConversion< hsize_t >( writeHead );
+  fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
+
+  std::vector< hsize_t > bufferedCounts( m_rank+1 );
+  bufferedCounts[0] = LvArray::integerConversion< hsize_t >( count );
+  for( hsize_t dd = 1; dd < m_rank+1; ++dd )
+  {
+    bufferedCounts[dd] = m_dims[dd-1];
   }
+  hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
+
+  hid_t fileHyperslab = filespace;
+  H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
+
+  H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, data );
+
+  H5Sclose( memspace );
+  H5Sclose( filespace );
 }
 
 void HDFHistIO::write( )
 {
+  // the previous write must be complete before its buffer is reused, or before any other HDF5 call
+  waitForHDFWrites();
+  if( m_file )
+  {
+    // all ranks buffer the same number of states, so the dataset is resized collectively without reducing the count
+    if( m_globalIdxCount > 0 && m_bufferedCount > 0 )
+    {
+      resizeFileIfNeeded( m_bufferedCount );
+
+      localIndex const writeHead = m_writeHead;
+      localIndex const count = m_bufferedCount;
+      m_writeHead += count;
+      // ranks without local data only take part in the collective operations
+      if( m_typeCount > 0 )
+      {
+        // keep collecting into the other buffer while the buffered states are written
+        std::swap( m_dataBuffer, m_writeBuffer );
+        auto writeBuffered = [this, writeHead, count]()
+        {
+          writeStates( m_dataset, &m_writeBuffer[0], writeHead, count );
+        };
+        if( m_asyncWrite )
+        {
+          pendingHistoryWrite = std::async( std::launch::async, writeBuffered );
+        }
+        else
+        {
+          writeBuffered();
+        }
+      }
+    }
+    emptyBuffer( );
+    return;
+  }
+
   // don't need to write if nothing is buffered, this should only happen if the output event occurs before the collection event
   if( m_subcomm != MPI_COMM_NULL )
   {
@@ -268,22 +399,6 @@ void HDFHistIO::write( )
       HDFFile target( m_filename, false, true, m_subcomm );
 
       hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-      hid_t filespace = H5Dget_space( dataset );
-
-      std::vector< hsize_t > fileOffset( m_rank+1 );
-      fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
-      fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
-
-      std::vector< hsize_t > bufferedCounts( m_rank+1 );
-      bufferedCounts[0] = LvArray::integerConversion< hsize_t >( maxBuffered );
-      for( hsize_t dd = 1; dd < m_rank+1; ++dd )
-      {
-        bufferedCounts[dd] = m_dims[dd-1];
-      }
-      hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
-
-      hid_t fileHyperslab = filespace;
-      H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
 
       buffer_unit_type * dataBuffer = nullptr;
       // if local rank is writting nothing, m_dataBuffer is never alloc'd so don't try to access it
@@ -291,10 +406,8 @@ void HDFHistIO::write( )
       {
         dataBuffer = &m_dataBuffer[0];
       }
-      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
+      writeStates( dataset, dataBuffer, m_writeHead, maxBuffered );
 
-      H5Sclose( memspace );
-      H5Sclose( filespace );
       H5Dclose( dataset );
 
       m_writeHead += maxBuffered;
@@ -305,9 +418,9 @@ void HDFHistIO::write( )
 
 void HDFHistIO::compressInFile( )
 {
-  if( m_subcomm != MPI_COMM_NULL )
+  waitForHDFWrites();
+  if( m_subcomm != MPI_COMM_NULL || ( m_file && m_globalIdxCount > 0 ) )
   {
-    HDFFile target( m_filename, false, true, m_subcomm );
     std::vector< hsize_t > maxFileDims( m_rank+1 );
     maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
     maxFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
@@ -315,31 +428,55 @@ void HDFHistIO::compressInFile( )
     {
       maxFileDims[dd] = m_dims[dd-1];
     }
-    hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-    H5Dset_extent( dataset, &maxFileDims[0] );
-    H5Dclose( dataset );
+    if( m_file )
+    {
+      H5Dset_extent( m_dataset, &maxFileDims[0] );
+    }
+    else
+    {
+      HDFFile target( m_filename, false, true, m_subcomm );
+      hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+      H5Dset_extent( dataset, &maxFileDims[0] );
+      H5Dclose( dataset );
+    }
     m_writeLimit = m_writeHead;
   }
 }
 
+void HDFHistIO::close( )
+{
+  waitForHDFWrites();
+  if( m_file && m_globalIdxCount > 0 )
+  {
+    H5Dclose( m_dataset );
+  }
+  m_dataset = 0;
+  m_file.reset();
+}
+
 inline void HDFHistIO::resizeFileIfNeeded( localIndex buffered_count )
 {
-  if( m_subcomm != MPI_COMM_NULL )
+  if( ( m_subcomm != MPI_COMM_NULL || m_file ) && m_writeHead + buffered_count > m_writeLimit )
   {
-    HDFFile target( m_filename, false, true, m_subcomm );
-    if( m_writeHead + buffered_count > m_writeLimit )
+    waitForHDFWrites();
+    while( m_writeHead + buffered_count > m_writeLimit )
     {
-      while( m_writeHead + buffered_count > m_writeLimit )
-      {
-        m_writeLimit *= m_overallocMultiple;
-      }
-      std::vector< hsize_t > maxFileDims( m_rank+1 );
-      maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
-      maxFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
-      for( hsize_t dd = 2; dd < m_rank+1; ++dd )
-      {
-        maxFileDims[dd] = m_dims[dd-1];
-      }
+      m_writeLimit *= m_overallocMultiple;
+    }
+    std::vector< hsize_t > maxFileDims( m_rank+1 );
+    maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
+    maxFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
+    for( hsize_t dd = 2; dd < m_rank+1; ++dd )
+    {
+      maxFileDims[dd] = m_dims[dd-1];
+    }
+    if( m_file )
+    {
+      H5Dset_extent( m_dataset, &maxFileDims[0] );
+    }
+    else
+    {
+      HDFFile target( m_filename, false, true, m_subcomm );
       hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
       H5Dset_extent( dataset, &maxFileDims[0] );
       H5Dclose( dataset );
@@ -28,11 +28,19 @@
 #include "managers/TimeHistory/HistoryIO.hpp"
 #include <hdf5.h>
 
+#include <memory>
 #include <string>
 
 namespace geosx
 {
 
+/**
+ * @brief Wait for the HDF5 files written from background threads, if any.
+ * @details The HDF5 library is not thread-safe: this must be called before any HDF5 call that may run
+ *          while a time history or a restart tree is written in the background.
+ */
+void waitForHDFWrites();
+
 /**
  * @class HDFTarget
  * @brief An abstract class representing an HDF output target.
@@ -156,7 +164,17 @@ public:
   { }
 
   /// Destructor
-  virtual ~HDFHistIO() { }
+  virtual ~HDFHistIO() override;
+
+  /**
+   * @brief Access a file kept open by the caller instead of opening the file at every access.
+   * @param file The file, opened for parallel access on the communicator of this object.
+   * @param asyncWrite Whether to write the buffered states from a background thread.
+   * @note Must be called before init(). The dataset is then kept open until close() and every rank of the
+   *       communicator takes part in the collective operations on it, so all ranks must buffer the same
+   *       number of states, even those without data. The buffered count is then not reduced before writing.
+   */
+  void setPersistentFile( std::shared_ptr< HDFFile > file, bool asyncWrite );
 
   /// @copydoc geosx::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
@@ -167,6 +185,9 @@ public:
   /// @copydoc geosx::BufferedHistoryIO::compressInFile
   virtual void compressInFile( ) override;
 
+  /// @copydoc geosx::BufferedHistoryIO::close
+  virtual void close( ) override;
+
   /**
    * @brief Resize the dataspace in the target file if needed to perform the current write of buffered states.
    * @param bufferedCount The number of buffered states to use to determine if the file needs to be resized.
@@ -177,6 +198,24 @@ protected:
   virtual void resizeBuffer( ) override;
 
 private:
+  /**
+   * @brief Create the dataset in the target if needed.
+   * @param target The target to create the dataset in.
+   * @param minIdxCount The smallest nonzero index count over the ranks, used to chunk the dataset.
+   * @param existsOkay Whether it is acceptable for the dataset to already exist.
+   * @return The open dataset.
+   */
+  hid_t openDataset( HDFTarget & target, hsize_t minIdxCount, bool existsOkay );
+
+  /**
+   * @brief Write states to the dataset in the file.
+   * @param dataset The open dataset.
+   * @param data The states to write.
+   * @param writeHead The index of the first state in the file.
+   * @param count The number of states to write.
+   */
+  void writeStates( hid_t dataset, buffer_unit_type const * data, localIndex writeHead, localIndex count );
+
   // file io params
   /// The filename to write to
   string m_filename;
@@ -208,6 +247,15 @@ private:
   /// The communicator with only members of the m_comm comm which have nonzero ammounts of local data (required for chunking output ->
   /// growing the data size in the file)
   MPI_Comm m_subcomm;
+  // persistent file access
+  /// The file kept open between accesses, if any
+  std::shared_ptr< HDFFile > m_file;
+  /// The dataset kept open between accesses, if any
+  hid_t m_dataset;
+  /// Whether to write the buffered states from a background thread
+  bool m_asyncWrite;
+  /// The states being written from a background thread
+  buffer_type m_writeBuffer;
 };
 
 
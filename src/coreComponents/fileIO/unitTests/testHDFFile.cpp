@@ -108,6 +108,50 @@ TEST( testHDFIO, IdxArrayHistory )
   }
 }
 
+TEST( testHDFIO, PersistentHistory )
+{
+  string filename( "persistent_history" );
+  HistoryMetadata spec( "Persistent History", 1, std::type_index( typeid(real64)));
+
+  {
+    std::shared_ptr< HDFFile > file = std::make_shared< HDFFile >( filename, true, true, MPI_COMM_GEOSX );
+    HDFHistIO io( filename, spec );
+    io.setPersistentFile( file, false );
+    io.init( false );
+    // several writes, growing the dataset beyond its initial allocation
+    for( localIndex widx = 0; widx < 10; ++widx )
+    {
+      for( localIndex tidx = 0; tidx < 3; ++tidx )
+      {
+        real64 const val = 3 * widx + tidx;
+        buffer_unit_type * buffer = io.getBufferHead( );
+        memcpy( buffer, &val, sizeof(real64));
+      }
+      io.write( );
+    }
+    io.compressInFile( );
+    io.close( );
+  }
+
+  // read and check the data using hdf api
+  hid_t file = H5Fopen( ( filename + ".hdf5" ).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  hid_t dataset = H5Dopen( file, "Persistent History", H5P_DEFAULT );
+  hid_t filespace = H5Dget_space( dataset );
+  hsize_t dims[2] = { 0, 0 };
+  H5Sget_simple_extent_dims( filespace, dims, nullptr );
+  ASSERT_EQ( dims[0], 30 );
+  ASSERT_EQ( dims[1], 1 );
+  std::vector< real64 > values( 30 );
+  H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data() );
+  for( localIndex ii = 0; ii < 30; ++ii )
+  {
+    EXPECT_EQ( values[ii], ii );
+  }
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+  H5Fclose( file );
+}
+
 int main( int ac, char * av[] )
 {
   ::testing::InitGoogleTest( &ac, av );
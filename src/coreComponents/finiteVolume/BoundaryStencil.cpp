@@ -35,6 +35,8 @@ void BoundaryStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF_NE_MSG( numPts, 2, "Number of points in boundary stencil should be 2" );
 
+  connectionsModified();
+
   localIndex const oldSize = m_elementRegionIndices.size( 0 );
   localIndex const newSize = oldSize + 1;
   m_elementRegionIndices.resize( newSize, numPts );
@@ -44,6 +44,8 @@ void CellElementStencilMPFA::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF( numPts >= MAX_STENCIL_SIZE, "Maximum stencil size exceeded" );
 
+  connectionsModified();
+
   m_elementRegionIndices.appendArray( elementRegionIndices, elementRegionIndices + numPts );
   m_elementSubRegionIndices.appendArray( elementSubRegionIndices, elementSubRegionIndices + numPts );
   m_elementIndices.appendArray( elementIndices, elementIndices + numPts );
@@ -20,6 +20,9 @@
 #include "CellElementStencilTPFA.hpp"
 #include "codingUtilities/Utilities.hpp"
 
+#include <numeric>
+#include <tuple>
+
 namespace geosx
 {
 
@@ -37,6 +40,8 @@ void CellElementStencilTPFA::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF_NE_MSG( numPts, 2, "Number of cells in TPFA stencil should be 2" );
 
+  connectionsModified();
+
   localIndex const oldSize = m_elementRegionIndices.size( 0 );
   localIndex const newSize = oldSize + 1;
   m_elementRegionIndices.resize( newSize, numPts );
@@ -54,4 +59,50 @@ void CellElementStencilTPFA::add( localIndex const numPts,
   m_connectorIndices[connectorIndex] = oldSize;
 }
 
+void CellElementStencilTPFA::sortConnections()
+{
+  localIndex const numConnections = size();
+
+  std::vector< localIndex > order( numConnections );
+  std::iota( order.begin(), order.end(), 0 );
+
+  auto const cellKey = [&]( localIndex const iconn, localIndex const k )
+  {
+    return std::make_tuple( m_elementRegionIndices( iconn, k ),
+                            m_elementSubRegionIndices( iconn, k ),
+                            m_elementIndices( iconn, k ) );
+  };
+
+  std::stable_sort( order.begin(), order.end(), [&]( localIndex const a, localIndex const b )
+  {
+    return std::make_tuple( cellKey( a, 0 ), cellKey( a, 1 ) ) < std::make_tuple( cellKey( b, 0 ), cellKey( b, 1 ) );
+  } );
+
+  array2d< localIndex > const elementRegionIndices( m_elementRegionIndices );
+  array2d< localIndex > const elementSubRegionIndices( m_elementSubRegionIndices );
+  array2d< localIndex > const elementIndices( m_elementIndices );
+  array2d< real64 > const weights( m_weights );
+
+  std::vector< localIndex > newIndex( numConnections );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    localIndex const oldIndex = order[iconn];
+    newIndex[oldIndex] = iconn;
+    for( localIndex k = 0; k < MAX_STENCIL_SIZE; ++k )
+    {
+      m_elementRegionIndices( iconn, k ) = elementRegionIndices( oldIndex, k );
+      m_elementSubRegionIndices( iconn, k ) = elementSubRegionIndices( oldIndex, k );
+      m_elementIndices( iconn, k ) = elementIndices( oldIndex, k );
+      m_weights( iconn, k ) = weights( oldIndex, k );
+    }
+  }
+
+  for( auto & entry : m_connectorIndices )
+  {
+    entry.second = newIndex[entry.second];
+  }
+
+  connectionsModified();
+}
+
 } /* namespace geosx */
@@ -97,6 +97,16 @@ public:
     return MAX_STENCIL_SIZE;
   }
 
+  /**
+   * @brief Sort the stencil entries by the (region, subregion, index) of their cells.
+   *
+   * Entries are ordered first by their first cell, then by their second cell, so that
+   * consecutive connections read and write neighboring rows of the element-based arrays
+   * and of the linear system. The connector index map is updated accordingly and any
+   * previously computed coloring is invalidated.
+   */
+  void sortConnections();
+
 };
 
 } /* namespace geosx */
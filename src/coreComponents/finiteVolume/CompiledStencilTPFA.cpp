@@ -0,0 +1,120 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CompiledStencilTPFA.cpp
+ */
+
+#include "CompiledStencilTPFA.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "linearAlgebra/DofManager.hpp"
+
+namespace geosx
+{
+
+CompiledStencilTPFA::CompiledStencilTPFA():
+  m_dofNumbers(),
+  m_localRows(),
+  m_interiorConnections(),
+  m_boundaryConnections(),
+  m_stencil( nullptr ),
+  m_stencilVersion( -1 ),
+  m_dofManager( nullptr ),
+  m_numberingVersion( -1 )
+{}
+
+void CompiledStencilTPFA::compile( CellElementStencilTPFA const & stencil,
+                                   ElementViewAccessor< arrayView1d< globalIndex const > > const & dofNumber,
+                                   ElementViewAccessor< arrayView1d< integer const > > const & ghostRank,
+                                   DofManager const & dofManager )
+{
+  GEOSX_MARK_FUNCTION;
+
+  globalIndex const rankOffset = dofManager.rankOffset();
+
+  localIndex const numConnections = stencil.size();
+
+  arrayView2d< localIndex const > const & seri = stencil.getElementRegionIndices();
+  arrayView2d< localIndex const > const & sesri = stencil.getElementSubRegionIndices();
+  arrayView2d< localIndex const > const & sei = stencil.getElementIndices();
+
+  m_dofNumbers.resize( numConnections, NUM_POINT_IN_FLUX );
+  m_localRows.resize( numConnections, NUM_POINT_IN_FLUX );
+  m_interiorConnections.clear();
+  m_boundaryConnections.clear();
+
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    bool isInterior = true;
+    for( localIndex k = 0; k < NUM_POINT_IN_FLUX; ++k )
+    {
+      localIndex const er = seri( iconn, k );
+      localIndex const esr = sesri( iconn, k );
+      localIndex const ei = sei( iconn, k );
+
+      globalIndex const dof = dofNumber[er][esr][ei];
+      m_dofNumbers( iconn, k ) = dof;
+      m_localRows( iconn, k ) = ghostRank[er][esr][ei] < 0 ? LvArray::integerConversion< localIndex >( dof - rankOffset ) : -1;
+      isInterior = isInterior && m_localRows( iconn, k ) >= 0;
+    }
+
+    if( isInterior )
+    {
+      m_interiorConnections.emplace_back( iconn );
+    }
+    else
+    {
+      m_boundaryConnections.emplace_back( iconn );
+    }
+  }
+
+  m_stencil = &stencil;
+  m_stencilVersion = stencil.version();
+  m_dofManager = &dofManager;
+  m_numberingVersion = dofManager.numberingVersion();
+}
+
+void CompiledStencilTPFA::update( CellElementStencilTPFA const & stencil,
+                                  ElementViewAccessor< arrayView1d< globalIndex const > > const & dofNumber,
+                                  ElementViewAccessor< arrayView1d< integer const > > const & ghostRank,
+                                  DofManager const & dofManager )
+{
+  if( !isCompiledFrom( stencil ) || &dofManager != m_dofManager || dofManager.numberingVersion() != m_numberingVersion )
+  {
+    compile( stencil, dofNumber, ghostRank, dofManager );
+  }
+}
+
+void CompiledStencilTPFA::clear()
+{
+  m_dofNumbers.clear();
+  m_localRows.clear();
+  m_interiorConnections.clear();
+  m_boundaryConnections.clear();
+  m_stencil = nullptr;
+  m_stencilVersion = -1;
+  m_dofManager = nullptr;
+  m_numberingVersion = -1;
+}
+
+void CompiledStencilTPFA::setName( string const & name )
+{
+  m_dofNumbers.setName( name + "/dofNumbers" );
+  m_localRows.setName( name + "/localRows" );
+  m_interiorConnections.setName( name + "/interiorConnections" );
+  m_boundaryConnections.setName( name + "/boundaryConnections" );
+}
+
+} /* namespace geosx */
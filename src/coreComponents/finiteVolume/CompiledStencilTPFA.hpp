@@ -0,0 +1,165 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CompiledStencilTPFA.hpp
+ */
+
+#ifndef GEOSX_FINITEVOLUME_COMPILEDSTENCILTPFA_HPP_
+#define GEOSX_FINITEVOLUME_COMPILEDSTENCILTPFA_HPP_
+
+#include "CellElementStencilTPFA.hpp"
+#include "mesh/ElementRegionManager.hpp"
+
+namespace geosx
+{
+
+class DofManager;
+
+/**
+ * @class CompiledStencilTPFA
+ *
+ * Flattened form of a CellElementStencilTPFA in which the DoF numbers and the local
+ * rows of the cells of each connection have been resolved once, so that flux kernels
+ * load them directly instead of going through the (region, subregion, index) indirection.
+ * The compiled data must be rebuilt whenever the stencil or the DoF numbering change.
+ */
+class CompiledStencilTPFA
+{
+public:
+
+  /// Number of cells in each connection
+  static constexpr localIndex NUM_POINT_IN_FLUX = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
+
+  /// Subsets of connections that can be assembled separately
+  enum class Connections : integer
+  {
+    All,      ///< all connections
+    Interior, ///< connections between locally owned cells only
+    Boundary  ///< connections involving at least one ghost cell
+  };
+
+  /// Alias for the element-based accessors used to compile the stencil
+  template< typename VIEWTYPE >
+  using ElementViewAccessor = ElementRegionManager::ElementViewAccessor< VIEWTYPE >;
+
+  /**
+   * @brief Default constructor.
+   */
+  CompiledStencilTPFA();
+
+  /**
+   * @brief Resolve the DoF numbers and local rows of all connections of a stencil.
+   * @param[in] stencil the stencil to compile
+   * @param[in] dofNumber the DoF numbers of the cells
+   * @param[in] ghostRank the ghost ranks of the cells
+   * @param[in] dofManager the DoF manager that numbered @p dofNumber
+   */
+  void compile( CellElementStencilTPFA const & stencil,
+                ElementViewAccessor< arrayView1d< globalIndex const > > const & dofNumber,
+                ElementViewAccessor< arrayView1d< integer const > > const & ghostRank,
+                DofManager const & dofManager );
+
+  /**
+   * @brief Compile a stencil unless the current data has already been built from its current
+   *        connections with the current numbering of the same DoF manager.
+   * @param[in] stencil the stencil to compile
+   * @param[in] dofNumber the DoF numbers of the cells
+   * @param[in] ghostRank the ghost ranks of the cells
+   * @param[in] dofManager the DoF manager that numbered @p dofNumber
+   */
+  void update( CellElementStencilTPFA const & stencil,
+               ElementViewAccessor< arrayView1d< globalIndex const > > const & dofNumber,
+               ElementViewAccessor< arrayView1d< integer const > > const & ghostRank,
+               DofManager const & dofManager );
+
+  /**
+   * @brief Discard the compiled data.
+   */
+  void clear();
+
+  /**
+   * @brief Check whether the compiled data corresponds to the current connections of a stencil.
+   * @tparam STENCIL_TYPE type of the stencil
+   * @param[in] stencil the stencil
+   * @return true if the data was compiled from @p stencil and its connections have not been modified since
+   */
+  template< typename STENCIL_TYPE >
+  bool isCompiledFrom( STENCIL_TYPE const & stencil ) const
+  {
+    return std::is_same< STENCIL_TYPE, CellElementStencilTPFA >::value
+           && static_cast< void const * >( &stencil ) == m_stencil
+           && stencil.version() == m_stencilVersion;
+  }
+
+  /**
+   * @brief Const access to the DoF numbers of the cells of each connection.
+   * @return A view to const
+   */
+  arrayView2d< globalIndex const > const & getDofNumbers() const { return m_dofNumbers.toViewConst(); }
+
+  /**
+   * @brief Const access to the local rows of the cells of each connection.
+   * @return A view to const; the row is negative for cells that are not locally owned
+   */
+  arrayView2d< localIndex const > const & getLocalRows() const { return m_localRows.toViewConst(); }
+
+  /**
+   * @brief Const access to the connections between locally owned cells only.
+   * @return A view to const
+   */
+  arrayView1d< localIndex const > const & getInteriorConnections() const { return m_interiorConnections.toViewConst(); }
+
+  /**
+   * @brief Const access to the connections involving at least one ghost cell.
+   * @return A view to const
+   */
+  arrayView1d< localIndex const > const & getBoundaryConnections() const { return m_boundaryConnections.toViewConst(); }
+
+  /**
+   * @brief Set the name used in data movement logging callbacks.
+   * @param name the name prefix for the compiled stencil's data arrays
+   */
+  void setName( string const & name );
+
+private:
+
+  /// The DoF numbers of the cells of each connection
+  array2d< globalIndex > m_dofNumbers;
+
+  /// The local rows of the cells of each connection (-1 for ghost cells)
+  array2d< localIndex > m_localRows;
+
+  /// The connections between locally owned cells only
+  array1d< localIndex > m_interiorConnections;
+
+  /// The connections involving at least one ghost cell
+  array1d< localIndex > m_boundaryConnections;
+
+  /// The stencil from which the data was compiled
+  void const * m_stencil;
+
+  /// The version of the stencil connections from which the data was compiled
+  localIndex m_stencilVersion;
+
+  /// The DoF manager whose numbering was used
+  DofManager const * m_dofManager;
+
+  /// The version of the DoF numbering that was used
+  localIndex m_numberingVersion;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_FINITEVOLUME_COMPILEDSTENCILTPFA_HPP_ */
@@ -40,6 +40,8 @@ void FaceElementStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF( numPts >= MAX_STENCIL_SIZE, "Maximum stencil size exceeded" );
 
+  connectionsModified();
+
   typename decltype( m_connectorIndices )::iterator iter = m_connectorIndices.find( connectorIndex );
   if( iter==m_connectorIndices.end() )
   {
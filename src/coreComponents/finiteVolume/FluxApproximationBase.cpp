@@ -29,7 +29,8 @@ using namespace dataRepository;
 
 FluxApproximationBase::FluxApproximationBase( string const & name, Group * const parent )
   : Group( name, parent ),
-  m_lengthScale( 1.0 )
+  m_lengthScale( 1.0 ),
+  m_computeColoring( false )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -207,6 +207,17 @@ public:
    */
   string_array & targetRegions()       { return m_targetRegions; }
 
+  /**
+   * @brief Request the coloring of the cell stencil connections, used by the colored flux assembly.
+   */
+  void requestColoring() { m_computeColoring = true; }
+
+  /**
+   * @brief Whether the cell stencil connections are colored.
+   * @return @p true if a solver requested the coloring
+   */
+  bool isColoringRequested() const { return m_computeColoring; }
+
 protected:
 
   virtual void RegisterDataOnMesh( Group * const meshBodies ) override;
@@ -264,6 +275,9 @@ protected:
   /// length scale of the mesh body
   real64 m_lengthScale;
 
+  /// whether to color the cell stencil connections
+  bool m_computeColoring;
+
 };
 
 template< typename TYPE >
@@ -40,7 +40,9 @@ public:
     m_elementSubRegionIndices(),
     m_elementIndices(),
     m_weights(),
-    m_connectorIndices()
+    m_connectorIndices(),
+    m_colorOffsets(),
+    m_coloredConnections()
   {}
 
   /**
@@ -105,6 +107,53 @@ public:
    */
   virtual localIndex size() const = 0;
 
+  /**
+   * @brief Compute a coloring of the stencil connections such that no two connections
+   *   of the same color share a cell.
+   * @return true if a valid coloring was found, false otherwise
+   *
+   * Connections are colored greedily in their storage order and then grouped by color,
+   * so that kernels may process all connections of one color concurrently and scatter
+   * their contributions into the rows of the shared cells without atomics.
+   * If the coloring fails (too many colors are needed), the stencil is left uncolored.
+   */
+  bool computeColoring();
+
+  /**
+   * @brief Check whether a valid connection coloring is available.
+   * @return true if the coloring is up to date with the stencil contents
+   */
+  bool isColored() const
+  { return m_colorOffsets.size() > 1 && m_coloredConnections.size() == size(); }
+
+  /**
+   * @brief Give the number of connection colors.
+   * @return the number of colors, or zero if the stencil is not colored
+   */
+  localIndex numColors() const
+  { return isColored() ? m_colorOffsets.size() - 1 : 0; }
+
+  /**
+   * @brief Const access to the color offsets.
+   * @return A view to const; connections of color @p c are stored in the range
+   *   [ offsets[c], offsets[c+1] ) of getColoredConnections()
+   */
+  arrayView1d< localIndex const > const & getColorOffsets() const { return m_colorOffsets.toViewConst(); }
+
+  /**
+   * @brief Const access to the connection indices grouped by color.
+   * @return A view to const
+   */
+  arrayView1d< localIndex const > const & getColoredConnections() const { return m_coloredConnections.toViewConst(); }
+
+  /**
+   * @brief Give the version of the stencil connections.
+   * @return a counter incremented whenever connections are added or reordered
+   *
+   * Can be used to detect that data derived from the connections has to be rebuilt.
+   */
+  localIndex version() const { return m_version; }
+
   /**
    * @brief Set the name used in data movement logging callbacks.
    * @param name the name prefix for the stencil's data arrays
@@ -151,6 +200,33 @@ protected:
   /// The map that provides the stencil index given the index of the underlying connector object.
   map< localIndex, localIndex > m_connectorIndices;
 
+  /// The offsets of each color in m_coloredConnections
+  array1d< localIndex > m_colorOffsets;
+
+  /// The connection indices sorted by color
+  array1d< localIndex > m_coloredConnections;
+
+  /// The version of the connections
+  localIndex m_version = 0;
+
+  /**
+   * @brief Invalidate the connection coloring.
+   */
+  void clearColoring()
+  {
+    m_colorOffsets.clear();
+    m_coloredConnections.clear();
+  }
+
+  /**
+   * @brief Record a modification of the connections, invalidating the data derived from them.
+   */
+  void connectionsModified()
+  {
+    ++m_version;
+    clearColoring();
+  }
+
 };
 
 
@@ -178,6 +254,103 @@ bool StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::zero( localIndex const connector
   } );
 }
 
+template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
+bool StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::computeColoring()
+{
+  // each cell keeps a bit mask of the colors already used by its connections
+  using ColorMask = std::uint64_t;
+  localIndex constexpr maxColors = 8 * sizeof( ColorMask );
+
+  LEAFCLASS const & leaf = static_cast< LEAFCLASS const & >( *this );
+  localIndex const numConnections = leaf.size();
+
+  clearColoring();
+
+  // assign a contiguous range of cell keys to each ( region, subRegion ) pair
+  map< std::pair< localIndex, localIndex >, localIndex > subRegionOffsets;
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    for( localIndex k = 0; k < leaf.stencilSize( iconn ); ++k )
+    {
+      localIndex & numCells = subRegionOffsets[ { m_elementRegionIndices[iconn][k], m_elementSubRegionIndices[iconn][k] } ];
+      numCells = std::max( numCells, m_elementIndices[iconn][k] + 1 );
+    }
+  }
+
+  localIndex numCells = 0;
+  for( auto & entry : subRegionOffsets )
+  {
+    localIndex const subRegionSize = entry.second;
+    entry.second = numCells;
+    numCells += subRegionSize;
+  }
+
+  // greedy coloring of the connections
+  std::vector< ColorMask > cellColors( numCells, 0 );
+  array1d< localIndex > connectionColor( numConnections );
+  localIndex numColors = 0;
+
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    localIndex const numPoints = leaf.stencilSize( iconn );
+
+    ColorMask usedColors = 0;
+    for( localIndex k = 0; k < numPoints; ++k )
+    {
+      localIndex const cell = subRegionOffsets.at( { m_elementRegionIndices[iconn][k], m_elementSubRegionIndices[iconn][k] } )
+                              + m_elementIndices[iconn][k];
+      usedColors |= cellColors[cell];
+    }
+
+    localIndex color = 0;
+    while( color < maxColors && ( ( usedColors >> color ) & 1 ) )
+    {
+      ++color;
+    }
+
+    if( color == maxColors )
+    {
+      GEOSX_WARNING( "Stencil coloring requires more than " << maxColors << " colors, falling back to atomic assembly" );
+      return false;
+    }
+
+    for( localIndex k = 0; k < numPoints; ++k )
+    {
+      localIndex const cell = subRegionOffsets.at( { m_elementRegionIndices[iconn][k], m_elementSubRegionIndices[iconn][k] } )
+                              + m_elementIndices[iconn][k];
+      cellColors[cell] |= ColorMask( 1 ) << color;
+    }
+
+    connectionColor[iconn] = color;
+    numColors = std::max( numColors, color + 1 );
+  }
+
+  // group the connections by color, preserving storage order within a color
+  m_colorOffsets.resize( numColors + 1 );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    ++m_colorOffsets[connectionColor[iconn] + 1];
+  }
+  for( localIndex color = 0; color < numColors; ++color )
+  {
+    m_colorOffsets[color + 1] += m_colorOffsets[color];
+  }
+
+  array1d< localIndex > colorPosition( numColors );
+  for( localIndex color = 0; color < numColors; ++color )
+  {
+    colorPosition[color] = m_colorOffsets[color];
+  }
+
+  m_coloredConnections.resize( numConnections );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    m_coloredConnections[colorPosition[connectionColor[iconn]]++] = iconn;
+  }
+
+  return true;
+}
+
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
 void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::setName( string const & name )
 {
@@ -185,6 +358,8 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::setName( string const & name )
   m_elementSubRegionIndices.setName( name + "/elementSubRegionIndices" );
   m_elementIndices.setName( name + "/elementIndices" );
   m_weights.setName( name + "/weights" );
+  m_colorOffsets.setName( name + "/colorOffsets" );
+  m_coloredConnections.setName( name + "/coloredConnections" );
 }
 
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
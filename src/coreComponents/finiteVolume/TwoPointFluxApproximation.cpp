@@ -189,6 +189,15 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
                  stencilWeights.data(),
                  kf );
   } );
+
+  // order the connections by cell for better locality in flux kernels
+  stencil.sortConnections();
+
+  // color the connections for atomic-free assembly, if requested by a solver
+  if( m_computeColoring )
+  {
+    stencil.computeColoring();
+  }
 }
 
 void TwoPointFluxApproximation::registerFractureStencil( Group & stencilGroup ) const
@@ -596,6 +605,12 @@ void TwoPointFluxApproximation::addToFractureStencil( MeshLevel & mesh,
       }
     } );
   }
+
+  // stencil contents have changed, recompute the connection coloring; the fracture connections are never assembled by color
+  if( m_computeColoring )
+  {
+    cellStencil.computeColoring();
+  }
 }
 
 void TwoPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & mesh,
@@ -744,6 +759,12 @@ void TwoPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & mesh,
       connectorIndex++;
     }
   }
+
+  // stencil contents have changed, recompute the connection coloring; the fracture connections are never assembled by color
+  if( m_computeColoring )
+  {
+    cellStencil.computeColoring();
+  }
 }
 
 void TwoPointFluxApproximation::registerBoundaryStencil( Group & stencilGroup, string const & setName ) const
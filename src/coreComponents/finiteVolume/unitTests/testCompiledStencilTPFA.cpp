@@ -0,0 +1,158 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "finiteVolume/CompiledStencilTPFA.hpp"
+#include "linearAlgebra/DofManager.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+/**
+ * @brief Build a TPFA stencil over a 1D chain of cells, adding the connections in reverse order.
+ */
+void makeReversedChainStencil( localIndex const numCells,
+                               CellElementStencilTPFA & stencil )
+{
+  real64 const weights[2] = { 1.0, -1.0 };
+  for( localIndex iconn = numCells - 2; iconn >= 0; --iconn )
+  {
+    localIndex const er[2] = { 0, 0 };
+    localIndex const esr[2] = { 0, 0 };
+    localIndex const ei[2] = { iconn, iconn + 1 };
+    stencil.add( 2, er, esr, ei, weights, iconn );
+  }
+}
+
+TEST( testCompiledStencilTPFA, sortConnections )
+{
+  localIndex const numCells = 20;
+
+  CellElementStencilTPFA stencil;
+  makeReversedChainStencil( numCells, stencil );
+  EXPECT_TRUE( stencil.computeColoring() );
+
+  stencil.sortConnections();
+  EXPECT_FALSE( stencil.isColored() );
+  ASSERT_EQ( stencil.size(), numCells - 1 );
+
+  CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    EXPECT_EQ( sei[iconn][0], iconn );
+    EXPECT_EQ( sei[iconn][1], iconn + 1 );
+  }
+
+  // the connector map follows the new order
+  EXPECT_TRUE( stencil.zero( 5 ) );
+  CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    EXPECT_EQ( weights[iconn][0], iconn == 5 ? 0.0 : 1.0 );
+  }
+}
+
+TEST( testCompiledStencilTPFA, compile )
+{
+  localIndex const numCells = 20;
+  localIndex const numOwned = 15;
+  // a DoF manager without fields has a zero rank offset
+  DofManager dofManager( "test" );
+  globalIndex const rankOffset = dofManager.rankOffset();
+
+  CellElementStencilTPFA stencil;
+  makeReversedChainStencil( numCells, stencil );
+
+  array1d< globalIndex > dofs( numCells );
+  array1d< integer > ghost( numCells );
+  for( localIndex ei = 0; ei < numCells; ++ei )
+  {
+    dofs[ei] = ei < numOwned ? rankOffset + ei : 1000 + ei;
+    ghost[ei] = ei < numOwned ? -1 : 1;
+  }
+
+  CompiledStencilTPFA::ElementViewAccessor< arrayView1d< globalIndex const > > dofNumber;
+  CompiledStencilTPFA::ElementViewAccessor< arrayView1d< integer const > > ghostRank;
+  dofNumber.resize( 1 );
+  dofNumber[0].resize( 1 );
+  dofNumber[0][0] = dofs.toViewConst();
+  ghostRank.resize( 1 );
+  ghostRank[0].resize( 1 );
+  ghostRank[0][0] = ghost.toViewConst();
+
+  CompiledStencilTPFA compiled;
+  EXPECT_FALSE( compiled.isCompiledFrom( stencil ) );
+
+  compiled.update( stencil, dofNumber, ghostRank, dofManager );
+  ASSERT_TRUE( compiled.isCompiledFrom( stencil ) );
+
+  CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+  arrayView2d< globalIndex const > const & compiledDofs = compiled.getDofNumbers();
+  arrayView2d< localIndex const > const & compiledRows = compiled.getLocalRows();
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    for( localIndex i = 0; i < 2; ++i )
+    {
+      localIndex const ei = sei[iconn][i];
+      EXPECT_EQ( compiledDofs[iconn][i], dofs[ei] );
+      EXPECT_EQ( compiledRows[iconn][i], ei < numOwned ? ei : -1 );
+    }
+  }
+
+  // connections between owned cells are interior, the others are boundary
+  arrayView1d< localIndex const > const & interior = compiled.getInteriorConnections();
+  arrayView1d< localIndex const > const & boundary = compiled.getBoundaryConnections();
+  ASSERT_EQ( interior.size(), numOwned - 1 );
+  ASSERT_EQ( boundary.size(), numCells - numOwned );
+  for( localIndex k = 0; k < interior.size(); ++k )
+  {
+    EXPECT_LT( sei[interior[k]][1], numOwned );
+  }
+  for( localIndex k = 0; k < boundary.size(); ++k )
+  {
+    EXPECT_GE( sei[boundary[k]][1], numOwned );
+  }
+
+  // reordering the connections invalidates the compiled data, even though the size is unchanged
+  stencil.sortConnections();
+  EXPECT_FALSE( compiled.isCompiledFrom( stencil ) );
+  compiled.update( stencil, dofNumber, ghostRank, dofManager );
+  EXPECT_TRUE( compiled.isCompiledFrom( stencil ) );
+
+  // growing the stencil invalidates the compiled data
+  localIndex const er[2] = { 0, 0 };
+  localIndex const esr[2] = { 0, 0 };
+  localIndex const ei[2] = { 0, 2 };
+  real64 const weights[2] = { 1.0, -1.0 };
+  stencil.add( 2, er, esr, ei, weights, stencil.size() );
+  EXPECT_FALSE( compiled.isCompiledFrom( stencil ) );
+
+  compiled.clear();
+  EXPECT_FALSE( compiled.isCompiledFrom( stencil ) );
+}
+
+int main( int argc, char * argv[] )
+{
+  geosx::basicSetup( argc, argv );
+
+  int result = 0;
+  testing::InitGoogleTest( &argc, argv );
+  result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+  return result;
+}
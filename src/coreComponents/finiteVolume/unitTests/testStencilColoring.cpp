@@ -0,0 +1,138 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "finiteVolume/CellElementStencilTPFA.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <set>
+
+using namespace geosx;
+
+/**
+ * @brief Build a TPFA stencil over a structured nx x ny x nz grid split into two subregions along z.
+ */
+void makeStructuredStencil( localIndex const nx,
+                            localIndex const ny,
+                            localIndex const nz,
+                            CellElementStencilTPFA & stencil )
+{
+  localIndex const nzHalf = nz / 2;
+  auto cell = [&]( localIndex const i, localIndex const j, localIndex const k,
+                   localIndex & er, localIndex & esr, localIndex & ei )
+  {
+    er = 0;
+    esr = k < nzHalf ? 0 : 1;
+    ei = ( ( k < nzHalf ? k : k - nzHalf ) * ny + j ) * nx + i;
+  };
+
+  localIndex const offsets[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+  real64 const weights[2] = { 1.0, -1.0 };
+  localIndex connectorIndex = 0;
+
+  for( localIndex k = 0; k < nz; ++k )
+  {
+    for( localIndex j = 0; j < ny; ++j )
+    {
+      for( localIndex i = 0; i < nx; ++i )
+      {
+        for( localIndex dir = 0; dir < 3; ++dir )
+        {
+          localIndex const i1 = i + offsets[dir][0];
+          localIndex const j1 = j + offsets[dir][1];
+          localIndex const k1 = k + offsets[dir][2];
+          if( i1 >= nx || j1 >= ny || k1 >= nz )
+          {
+            continue;
+          }
+
+          localIndex er[2], esr[2], ei[2];
+          cell( i, j, k, er[0], esr[0], ei[0] );
+          cell( i1, j1, k1, er[1], esr[1], ei[1] );
+          stencil.add( 2, er, esr, ei, weights, connectorIndex++ );
+        }
+      }
+    }
+  }
+}
+
+TEST( testStencilColoring, structuredTPFA )
+{
+  CellElementStencilTPFA stencil;
+  makeStructuredStencil( 10, 7, 6, stencil );
+
+  EXPECT_FALSE( stencil.isColored() );
+  EXPECT_TRUE( stencil.computeColoring() );
+  EXPECT_TRUE( stencil.isColored() );
+
+  // a structured hexahedral grid is colored with at most 2 * 6 - 1 colors by the greedy algorithm
+  EXPECT_LE( stencil.numColors(), 11 );
+
+  arrayView1d< localIndex const > const & colorOffsets = stencil.getColorOffsets();
+  arrayView1d< localIndex const > const & coloredConnections = stencil.getColoredConnections();
+  CellElementStencilTPFA::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+  CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+  ASSERT_EQ( colorOffsets[stencil.numColors()], stencil.size() );
+
+  // every connection appears exactly once
+  array1d< integer > count( stencil.size() );
+  for( localIndex k = 0; k < coloredConnections.size(); ++k )
+  {
+    ++count[coloredConnections[k]];
+  }
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    EXPECT_EQ( count[iconn], 1 );
+  }
+
+  // no two connections of the same color share a cell
+  for( localIndex color = 0; color < stencil.numColors(); ++color )
+  {
+    std::set< std::pair< localIndex, localIndex > > cells;
+    for( localIndex k = colorOffsets[color]; k < colorOffsets[color + 1]; ++k )
+    {
+      localIndex const iconn = coloredConnections[k];
+      for( localIndex i = 0; i < 2; ++i )
+      {
+        EXPECT_TRUE( cells.insert( { sesri[iconn][i], sei[iconn][i] } ).second );
+      }
+    }
+  }
+
+  // adding a connection invalidates the coloring
+  localIndex const er[2] = { 0, 0 };
+  localIndex const esr[2] = { 0, 0 };
+  localIndex const ei[2] = { 0, 2 };
+  real64 const weights[2] = { 1.0, -1.0 };
+  stencil.add( 2, er, esr, ei, weights, stencil.size() );
+  EXPECT_FALSE( stencil.isColored() );
+  EXPECT_EQ( stencil.numColors(), 0 );
+}
+
+int main( int argc, char * argv[] )
+{
+  geosx::basicSetup( argc, argv );
+
+  int result = 0;
+  testing::InitGoogleTest( &argc, argv );
+  result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+  return result;
+}
@@ -38,7 +38,8 @@ DofManager::DofManager( string name )
   : m_name( std::move( name ) ),
   m_domain( nullptr ),
   m_mesh( nullptr ),
-  m_reordered( false )
+  m_reordered( false ),
+  m_numberingVersion( -1 )
 {
   initializeDataStructure();
 }
@@ -1749,6 +1750,8 @@ void DofManager::reorderByRank()
     SynchronizeFields( fieldToSync, m_mesh,
                        m_domain->getNeighbors() );
 
+  ++m_numberingVersion;
+
   m_reordered = true;
 }
 
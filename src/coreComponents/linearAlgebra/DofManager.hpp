@@ -304,6 +304,16 @@ public:
    */
   void reorderByRank();
 
+  /**
+   * @brief Return the version of the current DoF numbering.
+   *
+   * @return a counter incremented by every call to reorderByRank() on this DofManager,
+   *         or -1 if the DoFs have not been numbered yet
+   *
+   * Can be used to detect that data derived from the DoF index arrays has to be rebuilt.
+   */
+  localIndex numberingVersion() const { return m_reordered ? m_numberingVersion : -1; }
+
   /**
    * @brief Check if string key is already being used
    *
@@ -802,6 +812,9 @@ private:
 
   /// Flag indicating that DOFs have been reordered rank-wise.
   bool m_reordered;
+
+  /// Version of the DoF numbering, kept across clear() so that each numbering gets a new value
+  localIndex m_numberingVersion;
 };
 
 } /* namespace geosx */
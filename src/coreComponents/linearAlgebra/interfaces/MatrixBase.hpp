@@ -248,6 +248,65 @@ protected:
     close();
   }
 
+  /**
+   * @brief Create parallel matrix from a local CRS matrix made of dense square blocks.
+   * @param localMatrix The input local matrix.
+   * @param blockSize The number of consecutive rows (and columns) forming a block.
+   * @param comm The MPI communicator to use.
+   *
+   * Packages with block-sparse storage store a single column index per block and operate on whole
+   * blocks. The block structure is only a hint: the default implementation ignores it.
+   */
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       localIndex const blockSize,
+                       MPI_Comm const & comm )
+  {
+    GEOSX_UNUSED_VAR( blockSize );
+    create( localMatrix, comm );
+  }
+
+  /**
+   * @brief Update the values of an assembled matrix from a local CRS matrix with the same sparsity pattern.
+   * @param localMatrix The input local matrix.
+   * @return @p true if the values have been updated, @p false if the row partitioning or the sparsity
+   *         pattern of @p localMatrix differs from the one of this matrix on any rank.
+   *
+   * @note This is a collective call that returns the same value on all ranks.
+   *       When it returns @p false, the values of the matrix are unspecified and it must be re-created.
+   */
+  virtual bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) = 0;
+
+  /**
+   * @brief Create parallel matrix from a local CRS matrix, or only update its values if possible.
+   * @param localMatrix The input local matrix.
+   * @param comm The MPI communicator to use.
+   *
+   * Rebuilding the parallel matrix (row and column maps, ghost column communication) is avoided
+   * when the matrix has already been assembled with the same sparsity pattern, which is typically
+   * the case across the nonlinear iterations of a time step.
+   */
+  void createOrUpdate( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       MPI_Comm const & comm )
+  {
+    createOrUpdate( localMatrix, 1, comm );
+  }
+
+  /**
+   * @brief Create parallel matrix from a local CRS matrix made of dense square blocks, or only update its values if possible.
+   * @param localMatrix The input local matrix.
+   * @param blockSize The number of consecutive rows (and columns) forming a block.
+   * @param comm The MPI communicator to use.
+   */
+  void createOrUpdate( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       localIndex const blockSize,
+                       MPI_Comm const & comm )
+  {
+    if( !ready() || !updateValues( localMatrix ) )
+    {
+      create( localMatrix, blockSize, comm );
+    }
+  }
+
   ///@}
 
   /**
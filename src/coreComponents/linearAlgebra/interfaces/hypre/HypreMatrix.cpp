@@ -204,6 +204,93 @@ void HypreMatrix::createWithLocalSize( localIndex const localRows,
               m_ij_mat );
 }
 
+namespace
+{
+
+// Find the position of a column in a row of a ParCSR block, starting from the position following the previous match.
+// Entries are usually found in order, except for the diagonal entry that hypre moves to the front of the diagonal block.
+template< typename GLOBAL_COL >
+HYPRE_Int findColumn( HYPRE_Int const rowBegin,
+                      HYPRE_Int const rowEnd,
+                      HYPRE_Int & next,
+                      HYPRE_BigInt const col,
+                      GLOBAL_COL && globalCol )
+{
+  if( next >= rowEnd || globalCol( next ) != col )
+  {
+    next = rowBegin;
+    while( next < rowEnd && globalCol( next ) != col )
+    {
+      ++next;
+    }
+    if( next == rowEnd )
+    {
+      return -1;
+    }
+  }
+  return next++;
+}
+
+}
+
+bool HypreMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  hypre_CSRMatrix * const diag = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+  HYPRE_Int const * const diagI = hypre_CSRMatrixI( diag );
+  HYPRE_Int const * const diagJ = hypre_CSRMatrixJ( diag );
+  HYPRE_Real * const diagData = hypre_CSRMatrixData( diag );
+
+  hypre_CSRMatrix * const offd = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+  HYPRE_Int const * const offdI = hypre_CSRMatrixI( offd );
+  HYPRE_Int const * const offdJ = hypre_CSRMatrixJ( offd );
+  HYPRE_Real * const offdData = hypre_CSRMatrixData( offd );
+  HYPRE_BigInt const * const colMapOffd = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+
+  HYPRE_BigInt const firstColDiag = hypre_ParCSRMatrixFirstColDiag( m_parcsr_mat );
+  HYPRE_BigInt const lastColDiag = hypre_ParCSRMatrixLastColDiag( m_parcsr_mat );
+
+  // Write the values directly into the diagonal and off-diagonal blocks, checking that every
+  // entry exists; since the columns of a row are unique, equal row lengths then imply equal patterns
+  bool samePattern = localMatrix.numRows() == hypre_CSRMatrixNumRows( diag );
+  for( localIndex localRow = 0; samePattern && localRow < localMatrix.numRows(); ++localRow )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+    arraySlice1d< real64 const > const vals = localMatrix.getEntries( localRow );
+    HYPRE_Int const i = LvArray::integerConversion< HYPRE_Int >( localRow );
+
+    if( localMatrix.numNonZeros( localRow ) != diagI[i + 1] - diagI[i] + offdI[i + 1] - offdI[i] )
+    {
+      samePattern = false;
+      break;
+    }
+
+    HYPRE_Int nextDiag = diagI[i];
+    HYPRE_Int nextOffd = offdI[i];
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      HYPRE_BigInt const col = cols[k];
+      bool const inDiag = col >= firstColDiag && col <= lastColDiag;
+      HYPRE_Int const pos = inDiag
+                          ? findColumn( diagI[i], diagI[i + 1], nextDiag, col,
+                                        [&]( HYPRE_Int const j ){ return firstColDiag + diagJ[j]; } )
+                          : findColumn( offdI[i], offdI[i + 1], nextOffd, col,
+                                        [&]( HYPRE_Int const j ){ return colMapOffd[offdJ[j]]; } );
+      if( pos < 0 )
+      {
+        samePattern = false;
+        break;
+      }
+      ( inDiag ? diagData : offdData )[pos] = vals[k];
+    }
+  }
+
+  return MpiWrapper::Min( static_cast< int >( samePattern ), getComm() ) > 0;
+}
+
 void HypreMatrix::set( real64 const value )
 {
   GEOSX_LAI_ASSERT( ready() );
@@ -97,6 +97,7 @@ public:
   using MatrixBase::createWithLocalSize;
   using MatrixBase::createWithGlobalSize;
   using MatrixBase::create;
+  using MatrixBase::createOrUpdate;
   using MatrixBase::closed;
   using MatrixBase::assembled;
   using MatrixBase::insertable;
@@ -114,6 +115,8 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -193,6 +193,12 @@ void HyprePreconditioner::createAMG()
     GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetStrongThreshold( m_precond, m_parameters.amg.threshold ) );
   }
 
+  // Coarsen each unknown of the point blocks separately (hypre assumes interleaved unknowns)
+  if( m_parameters.usePointBlocks && m_parameters.dofsPerNode > 1 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetNumFunctions( m_precond, toHYPRE_Int( m_parameters.dofsPerNode ) ) );
+  }
+
   m_functions->setup = HYPRE_BoomerAMGSetup;
   m_functions->apply = HYPRE_BoomerAMGSolve;
   m_functions->destroy = HYPRE_BoomerAMGDestroy;
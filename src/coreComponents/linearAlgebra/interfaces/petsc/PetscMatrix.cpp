@@ -29,6 +29,9 @@
 #include <petscvec.h>
 #include <petscmat.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace geosx
 {
 
@@ -93,6 +96,111 @@ void PetscMatrix::createWithGlobalSize( globalIndex const globalRows,
   GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE ) );
 }
 
+void PetscMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          localIndex const blockSize,
+                          MPI_Comm const & comm )
+{
+  if( blockSize <= 1 )
+  {
+    create( localMatrix, comm );
+    return;
+  }
+
+  GEOSX_LAI_ASSERT( closed() );
+  GEOSX_LAI_ASSERT_EQ( localMatrix.numRows() % blockSize, 0 );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  localIndex const numLocalRows = localMatrix.numRows();
+  localIndex const numBlockRows = numLocalRows / blockSize;
+  globalIndex const firstBlockRow = MpiWrapper::PrefixSum< globalIndex >( numLocalRows ) / blockSize;
+
+  // Count the distinct column blocks of each block row, in the diagonal and off-diagonal parts
+  array1d< PetscInt > diagBlocks( numBlockRows );
+  array1d< PetscInt > offdiagBlocks( numBlockRows );
+  std::vector< globalIndex > colBlocks;
+  for( localIndex blockRow = 0; blockRow < numBlockRows; ++blockRow )
+  {
+    colBlocks.clear();
+    for( localIndex localRow = blockRow * blockSize; localRow < ( blockRow + 1 ) * blockSize; ++localRow )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        colBlocks.push_back( cols[k] / blockSize );
+      }
+    }
+    std::sort( colBlocks.begin(), colBlocks.end() );
+    colBlocks.erase( std::unique( colBlocks.begin(), colBlocks.end() ), colBlocks.end() );
+    for( globalIndex const colBlock : colBlocks )
+    {
+      bool const isDiag = colBlock >= firstBlockRow && colBlock < firstBlockRow + numBlockRows;
+      ++( isDiag ? diagBlocks : offdiagBlocks )[blockRow];
+    }
+  }
+
+  reset();
+
+  // set up matrix, with a single column index per nonzero block
+  PetscInt const bs = LvArray::integerConversion< PetscInt >( blockSize );
+  GEOSX_LAI_CHECK_ERROR( MatCreate( comm, &m_mat ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetType( m_mat, MATBAIJ ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetSizes( m_mat, numLocalRows, numLocalRows, PETSC_DETERMINE, PETSC_DETERMINE ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetBlockSize( m_mat, bs ) );
+  GEOSX_LAI_CHECK_ERROR( MatXAIJSetPreallocation( m_mat, bs, diagBlocks.data(), offdiagBlocks.data(), nullptr, nullptr ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetUp( m_mat ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE ) );
+
+  globalIndex const rankOffset = ilower();
+
+  open();
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    insert( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
+  }
+  close();
+}
+
+bool PetscMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  // Compare the patterns first: rows cannot be queried once values have been set,
+  // and setting a value outside of the pattern is an error
+  bool samePattern = localMatrix.numRows() == numLocalRows();
+  globalIndex const rankOffset = ilower();
+  for( localIndex localRow = 0; samePattern && localRow < localMatrix.numRows(); ++localRow )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+    PetscInt const row = LvArray::integerConversion< PetscInt >( rankOffset + localRow );
+    PetscInt numEntries;
+    PetscInt const * inds;
+    GEOSX_LAI_CHECK_ERROR( MatGetRow( m_mat, row, &numEntries, &inds, nullptr ) );
+    samePattern = numEntries == cols.size() && std::equal( inds, inds + numEntries, toPetscInt( cols.dataIfContiguous() ) );
+    GEOSX_LAI_CHECK_ERROR( MatRestoreRow( m_mat, row, &numEntries, &inds, nullptr ) );
+  }
+
+  if( MpiWrapper::Min( static_cast< int >( samePattern ), getComm() ) == 0 )
+  {
+    return false;
+  }
+
+  for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+    arraySlice1d< real64 const > const vals = localMatrix.getEntries( localRow );
+    PetscInt const row = LvArray::integerConversion< PetscInt >( rankOffset + localRow );
+    GEOSX_LAI_CHECK_ERROR( MatSetValues( m_mat, 1, &row, cols.size(), toPetscInt( cols.dataIfContiguous() ),
+                                         vals.dataIfContiguous(), INSERT_VALUES ) );
+  }
+  GEOSX_LAI_CHECK_ERROR( MatAssemblyBegin( m_mat, MAT_FINAL_ASSEMBLY ) );
+  GEOSX_LAI_CHECK_ERROR( MatAssemblyEnd( m_mat, MAT_FINAL_ASSEMBLY ) );
+
+  return true;
+}
+
 bool PetscMatrix::created() const
 {
   return m_mat != nullptr;
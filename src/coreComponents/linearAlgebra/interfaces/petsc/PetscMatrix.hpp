@@ -86,6 +86,7 @@ public:
   using MatrixBase::createWithLocalSize;
   using MatrixBase::createWithGlobalSize;
   using MatrixBase::create;
+  using MatrixBase::createOrUpdate;
   using MatrixBase::closed;
   using MatrixBase::assembled;
   using MatrixBase::insertable;
@@ -103,6 +104,12 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       localIndex const blockSize,
+                       MPI_Comm const & comm ) override;
+
+  virtual bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) override;
+
   virtual bool created() const override;
 
   virtual void reset() override;
@@ -20,6 +20,7 @@
 
 #include "codingUtilities/Utilities.hpp"
 #include "linearAlgebra/interfaces/trilinos/EpetraUtils.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 #include <Epetra_Map.h>
 #include <Epetra_FECrsGraph.h>
@@ -107,6 +108,29 @@ void EpetraMatrix::createWithLocalSize( localIndex const localRows,
                                                      false );
 }
 
+bool EpetraMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  // ReplaceGlobalValues returns a positive code if an entry is not in the pattern;
+  // since the columns of a row are unique, equal row lengths then imply equal patterns
+  bool samePattern = localMatrix.numRows() == numLocalRows();
+  globalIndex const rankOffset = ilower();
+  for( localIndex localRow = 0; samePattern && localRow < localMatrix.numRows(); ++localRow )
+  {
+    int const numEntries = LvArray::integerConversion< int >( localMatrix.numNonZeros( localRow ) );
+    samePattern = m_matrix->NumMyEntries( LvArray::integerConversion< int >( localRow ) ) == numEntries &&
+                  m_matrix->ReplaceGlobalValues( rankOffset + localRow,
+                                                 numEntries,
+                                                 localMatrix.getEntries( localRow ).dataIfContiguous(),
+                                                 toEpetraLongLong( localMatrix.getColumns( localRow ).dataIfContiguous() ) ) == 0;
+  }
+
+  return MpiWrapper::Min( static_cast< int >( samePattern ), getComm() ) > 0;
+}
+
 bool EpetraMatrix::created() const
 {
   return bool(m_matrix);
@@ -31,9 +31,11 @@ GMRESsolver< VECTOR >::GMRESsolver( LinearOperator< Vector > const & A,
                                     real64 tolerance,
                                     localIndex maxIterations,
                                     integer verbosity,
-                                    localIndex maxRestart )
+                                    localIndex maxRestart,
+                                    bool singleReduction )
   : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
   m_maxRestart( maxRestart ),
+  m_singleReduction( singleReduction ),
   m_kspace( m_maxRestart + 1 ),
   m_kspaceInitialized( false )
 {
@@ -46,6 +48,10 @@ GMRESsolver< VECTOR >::~GMRESsolver() = default;
 namespace
 {
 
+/// Ratio of the new vector norm squared to its pre-orthogonalization value, below which
+/// the Pythagorean norm estimate (and classical Gram-Schmidt orthogonality) is deemed unreliable
+constexpr real64 singleReductionCancellationTol = 1e-2;
+
 void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
 {
   if( isZero( y ) )
@@ -127,6 +133,11 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
   array1d< real64 > s( m_maxRestart + 1 );
   array1d< real64 > g( m_maxRestart + 1 );
 
+  // Storage for fused reductions (single-reduction mode)
+  array1d< real64 > localDots( m_maxRestart + 2 );
+  array1d< real64 > globalDots( m_maxRestart + 2 );
+  MPI_Comm const comm = LocalDotHelper< VECTOR >::comm( b );
+
   m_result.status = LinearSolverResult::Status::NotConverged;
   m_residualNorms.resize( m_maxIterations + 1 );
 
@@ -159,13 +170,49 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
       m_operator.apply( z, w );
 
       // Orthogonalization
-      for( localIndex i = 0; i <= j; ++i )
+      if( m_singleReduction )
       {
-        H( i, j ) = w.dot( m_kspace[i] );
-        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        real64 wnorm2 = 0.0;
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) = 0.0;
+        }
+        for( integer pass = 0; pass < 2; ++pass )
+        {
+          for( localIndex i = 0; i <= j; ++i )
+          {
+            localDots[i] = LocalDotHelper< VECTOR >::dot( w, m_kspace[i] );
+          }
+          localDots[j+1] = LocalDotHelper< VECTOR >::dot( w, w );
+          MpiWrapper::allReduce( localDots.data(), globalDots.data(), LvArray::integerConversion< int >( j + 2 ), MPI_SUM, comm );
+
+          real64 projNorm2 = 0.0;
+          for( localIndex i = 0; i <= j; ++i )
+          {
+            H( i, j ) += globalDots[i];
+            w.axpby( -globalDots[i], m_kspace[i], 1.0 );
+            projNorm2 += globalDots[i] * globalDots[i];
+          }
+          wnorm2 = globalDots[j+1] - projNorm2;
+          if( wnorm2 > singleReductionCancellationTol * globalDots[j+1] )
+          {
+            break;
+          }
+        }
+
+        // Fall back to an explicit norm if cancellation persists
+        H( j+1, j ) = wnorm2 > singleReductionCancellationTol * globalDots[j+1] ? std::sqrt( wnorm2 ) : w.norm2();
       }
+      else
+      {
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) = w.dot( m_kspace[i] );
+          w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        }
 
-      H( j+1, j ) = w.norm2();
+        H( j+1, j ) = w.norm2();
+      }
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j + 1, j ) );
       m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
@@ -28,6 +28,13 @@ namespace geosx
  * @brief This class implements Generalized Minimized RESidual method
  *        (right-preconditioned) for monolithic and block linear operators.
  * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * By default, the new Krylov vector is orthogonalized with modified Gram-Schmidt,
+ * which requires j+2 global reductions at iteration j. In single-reduction mode,
+ * classical Gram-Schmidt is used instead, with all projections and the norm of the
+ * new vector computed in one reduction (the norm is recovered via the Pythagorean
+ * identity, with a second pass when cancellation makes it unreliable).
+ *
  * @note  The notation is consistent with "Iterative Methods for
  *        Linear and Non-Linear Equations" from C.T. Kelley (1995)
  *        and "Iterative Methods for Sparse Linear Systems"
@@ -57,13 +64,15 @@ public:
    * @param[in] maxIterations maximum number of Krylov iterations
    * @param[in] verbosity     solver verbosity level
    * @param[in] maxRestart    number of iterations until restart
+   * @param[in] singleReduction use single-reduction classical Gram-Schmidt orthogonalization
    */
   GMRESsolver( LinearOperator< Vector > const & matrix,
                LinearOperator< Vector > const & precond,
                real64 const tolerance,
                localIndex const maxIterations,
                integer const verbosity = 0,
-               localIndex const maxRestart = 100 );
+               localIndex const maxRestart = 100,
+               bool const singleReduction = false );
 
   /**
    * @brief Virtual destructor.
@@ -86,7 +95,7 @@ public:
 
   virtual string methodName() const override final
   {
-    return "GMRES";
+    return m_singleReduction ? "SR-GMRES" : "GMRES";
   };
 
   ///@}
@@ -110,6 +119,9 @@ protected:
   /// Number of iterations needed to restart GMRES
   localIndex m_maxRestart;
 
+  /// Flag indicating whether to orthogonalize with a single global reduction per iteration
+  bool m_singleReduction;
+
   /// Storage for Krylov subspace vectors
   array1d< VectorTemp > m_kspace;
 
@@ -123,6 +123,24 @@ public:
     return m_residualNorms;
   }
 
+  /**
+   * @brief Set the relative residual norm reduction tolerance for subsequent solves.
+   * @param tolerance the new tolerance
+   */
+  void setTolerance( real64 const tolerance )
+  {
+    m_tolerance = tolerance;
+  }
+
+  /**
+   * @brief Set the maximum number of iterations for subsequent solves.
+   * @param maxIterations the new maximum number of iterations
+   */
+  void setMaxIterations( localIndex const maxIterations )
+  {
+    m_maxIterations = maxIterations;
+  }
+
   /**
    * @brief Get log level.
    * @return integer value of the log level
@@ -19,6 +19,8 @@
 #define GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 /// Tolerance for division by zero in Krylov solvers
 #define GEOSX_KRYLOV_MIN_DIV ::geosx::NumericTraits< real64 >::eps
@@ -39,4 +41,75 @@
   } while( false )
 #endif
 
+namespace geosx
+{
+
+/**
+ * @brief Helper for computing rank-local contributions to dot products.
+ * @tparam VECTOR type of vector
+ *
+ * Used by communication-reducing Krylov methods to combine several
+ * dot products into a single (possibly non-blocking) global reduction.
+ */
+template< typename VECTOR >
+struct LocalDotHelper
+{
+  /**
+   * @brief Compute the rank-local part of a dot product.
+   * @param x first vector
+   * @param y second vector
+   * @return the local dot product
+   */
+  static real64 dot( VECTOR const & x, VECTOR const & y )
+  {
+    GEOSX_LAI_ASSERT_EQ( x.localSize(), y.localSize() );
+    real64 const * const xv = x.extractLocalVector();
+    real64 const * const yv = y.extractLocalVector();
+    real64 sum = 0.0;
+    for( localIndex i = 0; i < x.localSize(); ++i )
+    {
+      sum += xv[i] * yv[i];
+    }
+    return sum;
+  }
+
+  /**
+   * @brief Get the communicator for global reductions.
+   * @param x the vector
+   * @return the communicator
+   */
+  static MPI_Comm comm( VECTOR const & x )
+  {
+    return x.getComm();
+  }
+};
+
+/**
+ * @brief Specialization of LocalDotHelper for block vectors.
+ * @tparam VECTOR type of vector in each block
+ */
+template< typename VECTOR >
+struct LocalDotHelper< BlockVectorView< VECTOR > >
+{
+  /// @copydoc LocalDotHelper::dot
+  static real64 dot( BlockVectorView< VECTOR > const & x, BlockVectorView< VECTOR > const & y )
+  {
+    GEOSX_LAI_ASSERT_EQ( x.blockSize(), y.blockSize() );
+    real64 sum = 0.0;
+    for( localIndex i = 0; i < x.blockSize(); ++i )
+    {
+      sum += LocalDotHelper< VECTOR >::dot( x.block( i ), y.block( i ) );
+    }
+    return sum;
+  }
+
+  /// @copydoc LocalDotHelper::comm
+  static MPI_Comm comm( BlockVectorView< VECTOR > const & x )
+  {
+    return x.block( 0 ).getComm();
+  }
+};
+
+} // namespace geosx
+
 #endif //GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
@@ -0,0 +1,163 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipeCGsolver.cpp
+ */
+
+#include "PipeCGsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+PipeCGsolver< VECTOR >::PipeCGsolver( LinearOperator< Vector > const & A,
+                                      LinearOperator< Vector > const & M,
+                                      real64 const tolerance,
+                                      localIndex const maxIterations,
+                                      integer const verbosity )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity )
+{}
+
+template< typename VECTOR >
+PipeCGsolver< VECTOR >::~PipeCGsolver() = default;
+
+template< typename VECTOR >
+void PipeCGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  using DotHelper = LocalDotHelper< VECTOR >;
+
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Compute initial r = b - Ax, u = Mr, w = Au
+  VectorTemp r = createTempVector( b );
+  m_operator.residual( x, b, r );
+
+  VectorTemp u = createTempVector( x );
+  m_precond.apply( r, u );
+
+  VectorTemp w = createTempVector( b );
+  m_operator.apply( u, w );
+
+  // Preconditioned and unpreconditioned images of w
+  VectorTemp m = createTempVector( x );
+  VectorTemp n = createTempVector( b );
+
+  // Auxiliary recurrences: p (search direction), s = Ap, q = Ms, z = Aq
+  VectorTemp p = createTempVector( x );
+  VectorTemp s = createTempVector( b );
+  VectorTemp q = createTempVector( x );
+  VectorTemp z = createTempVector( b );
+  p.zero();
+  s.zero();
+  q.zero();
+  z.zero();
+
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_result.numIterations = 0;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  MPI_Comm const comm = DotHelper::comm( b );
+
+  localIndex k;
+  real64 rnorm = 0.0;
+
+  for( k = 0; k <= m_maxIterations; ++k )
+  {
+    // Start the single global reduction of this iteration: (r,r), (r,u), (w,u)
+    real64 const localDots[3] = { DotHelper::dot( r, r ), DotHelper::dot( r, u ), DotHelper::dot( w, u ) };
+    real64 globalDots[3];
+    MPI_Request request;
+    MpiWrapper::iAllReduce( localDots, globalDots, 3, MPI_SUM, comm, &request );
+
+    // Overlap the reduction with m = Mw, n = Am
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+
+    rnorm = std::sqrt( globalDots[0] );
+    logProgress( k, rnorm );
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm < absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    real64 const gamma = globalDots[1];
+    real64 const delta = globalDots[2];
+
+    // Compute beta and alpha
+    real64 const beta = k > 0 ? gamma / gamma_old : 0.0;
+    real64 const denom = k > 0 ? delta - beta * gamma / alpha_old : delta;
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom );
+    real64 const alpha = gamma / denom;
+
+    // Update recurrences
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update solution and residuals
+    x.axpby( alpha, p, 1.0 );
+    r.axpby( -alpha, s, 1.0 );
+    u.axpby( -alpha, q, 1.0 );
+    w.axpby( -alpha, z, 1.0 );
+
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipeCGsolver< TrilinosInterface::ParallelVector >;
+template class PipeCGsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipeCGsolver< HypreInterface::ParallelVector >;
+template class PipeCGsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipeCGsolver< PetscInterface::ParallelVector >;
+template class PipeCGsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} //namespace geosx
@@ -57,6 +57,20 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_PipeCG()
+{
+  LinearSolverParameters parameters = params_CG();
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::pipecg;
+  return parameters;
+}
+
+LinearSolverParameters params_SRGMRES()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::srgmres;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -99,6 +113,33 @@ protected:
     real64 const relTol = cond_est * params.krylov.relTolerance;
     EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), relTol );
   }
+
+  void compare( LinearSolverParameters const & paramsRef,
+                LinearSolverParameters const & paramsNew )
+  {
+    sol_true.rand();
+    matrix.apply( sol_true, rhs_true );
+
+    using Vector = typename OPERATOR::Vector;
+    std::unique_ptr< KrylovSolver< Vector > > const solverRef = KrylovSolver< Vector >::Create( paramsRef, matrix, precond );
+    std::unique_ptr< KrylovSolver< Vector > > const solverNew = KrylovSolver< Vector >::Create( paramsNew, matrix, precond );
+
+    sol_comp.zero();
+    solverRef->solve( rhs_true, sol_comp );
+    LinearSolverResult const resultRef = solverRef->result();
+
+    sol_comp.zero();
+    solverNew->solve( rhs_true, sol_comp );
+    LinearSolverResult const resultNew = solverNew->result();
+
+    GEOSX_LOG_RANK_0( solverRef->methodName() << ": " << resultRef.numIterations << " iterations, " << resultRef.solveTime << " s; " <<
+                      solverNew->methodName() << ": " << resultNew.numIterations << " iterations, " << resultNew.solveTime << " s" );
+
+    // Communication-reducing variants are mathematically equivalent in exact arithmetic,
+    // so they should converge in a comparable number of iterations
+    EXPECT_TRUE( resultNew.success() );
+    EXPECT_LE( resultNew.numIterations, resultRef.numIterations * 11 / 10 + 2 );
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -155,10 +196,34 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, PipeCG )
+{
+  this->test( params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SRGMRES )
+{
+  this->test( params_SRGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipeCGvsCG )
+{
+  this->compare( params_CG(), params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SRGMRESvsGMRES )
+{
+  this->compare( params_GMRES(), params_SRGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipeCG,
+                             SRGMRES,
+                             PipeCGvsCG,
+                             SRGMRESvsGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -245,10 +310,34 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, PipeCG )
+{
+  this->test( params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, SRGMRES )
+{
+  this->test( params_SRGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipeCGvsCG )
+{
+  this->compare( params_CG(), params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, SRGMRESvsGMRES )
+{
+  this->compare( params_GMRES(), params_SRGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipeCG,
+                             SRGMRES,
+                             PipeCGvsCG,
+                             SRGMRESvsGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
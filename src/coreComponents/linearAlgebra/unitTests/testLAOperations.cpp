@@ -485,10 +485,144 @@ TYPED_TEST_P( LAOperationsTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( LAOperationsTest, MatrixCreateOrUpdate )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  // Local rows of a 1D Laplace operator, optionally without the upper diagonal
+  localIndex const numLocalRows = 10;
+  globalIndex const rankOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalRows );
+  globalIndex const numGlobalRows = MpiWrapper::Sum( globalIndex( numLocalRows ) );
+
+  CRSMatrix< real64, globalIndex > localMatrix;
+  auto setPattern = [&]( bool const withUpperDiagonal )
+  {
+    SparsityPattern< globalIndex > pattern( numLocalRows, numGlobalRows, 3 );
+    for( localIndex i = 0; i < numLocalRows; ++i )
+    {
+      globalIndex const row = rankOffset + i;
+      pattern.insertNonZero( i, row );
+      if( row > 0 )
+      {
+        pattern.insertNonZero( i, row - 1 );
+      }
+      if( withUpperDiagonal && row + 1 < numGlobalRows )
+      {
+        pattern.insertNonZero( i, row + 1 );
+      }
+    }
+    localMatrix.assimilate< serialPolicy >( std::move( pattern ) );
+  };
+  auto setValues = [&]( real64 const scale )
+  {
+    for( localIndex i = 0; i < localMatrix.numRows(); ++i )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( i );
+      arraySlice1d< real64 > const vals = localMatrix.getEntries( i );
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        vals[k] = ( cols[k] == rankOffset + i ? 2.0 : -1.0 ) * scale;
+      }
+    }
+  };
+
+  setPattern( true );
+  setValues( 1.0 );
+
+  Matrix A;
+  A.createOrUpdate( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Same pattern: the values are updated in place
+  setValues( 2.0 );
+  EXPECT_TRUE( A.updateValues( localMatrix.toViewConst() ) );
+  EXPECT_DOUBLE_EQ( A.normInf(), 8.0 );
+  EXPECT_DOUBLE_EQ( A.getDiagValue( rankOffset ), 4.0 );
+
+  // Different pattern: the matrix is re-created
+  setPattern( false );
+  setValues( 1.0 );
+  EXPECT_FALSE( A.updateValues( localMatrix.toViewConst() ) );
+  A.createOrUpdate( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_EQ( A.numGlobalNonzeros(), 2 * numGlobalRows - 1 );
+  EXPECT_DOUBLE_EQ( A.normInf(), 3.0 );
+}
+
+TYPED_TEST_P( LAOperationsTest, MatrixCreateWithBlocks )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  // Local rows of a 1D block Laplace operator with dense 3x3 blocks
+  localIndex const blockSize = 3;
+  localIndex const numLocalBlocks = 4;
+  localIndex const numLocalRows = numLocalBlocks * blockSize;
+  globalIndex const rankOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalRows );
+  globalIndex const numGlobalRows = MpiWrapper::Sum( globalIndex( numLocalRows ) );
+
+  SparsityPattern< globalIndex > pattern( numLocalRows, numGlobalRows, 3 * blockSize );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    globalIndex const blockRow = ( rankOffset + i ) / blockSize;
+    for( globalIndex blockCol = std::max( blockRow - 1, globalIndex( 0 ) ); blockCol <= blockRow + 1; ++blockCol )
+    {
+      for( localIndex c = 0; c < blockSize && blockCol * blockSize < numGlobalRows; ++c )
+      {
+        pattern.insertNonZero( i, blockCol * blockSize + c );
+      }
+    }
+  }
+  CRSMatrix< real64, globalIndex > localMatrix;
+  localMatrix.assimilate< serialPolicy >( std::move( pattern ) );
+  for( localIndex i = 0; i < localMatrix.numRows(); ++i )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( i );
+    arraySlice1d< real64 > const vals = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      vals[k] = cols[k] == rankOffset + i ? 8.0 : -1.0;
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  Matrix B;
+  B.createOrUpdate( localMatrix.toViewConst(), blockSize, MPI_COMM_GEOSX );
+
+  EXPECT_EQ( B.numGlobalRows(), numGlobalRows );
+  EXPECT_EQ( B.numGlobalNonzeros(), A.numGlobalNonzeros() );
+  EXPECT_DOUBLE_EQ( B.normInf(), A.normInf() );
+
+  // Both storages yield the same products
+  Vector x, yA, yB;
+  x.createWithLocalSize( numLocalRows, MPI_COMM_GEOSX );
+  yA.createWithLocalSize( numLocalRows, MPI_COMM_GEOSX );
+  yB.createWithLocalSize( numLocalRows, MPI_COMM_GEOSX );
+  x.rand();
+  A.apply( x, yA );
+  B.apply( x, yB );
+  yB.axpy( -1.0, yA );
+  EXPECT_LT( yB.normInf(), 1e-12 * yA.normInf() );
+
+  // The values of the block matrix are updated in place
+  for( localIndex i = 0; i < localMatrix.numRows(); ++i )
+  {
+    arraySlice1d< real64 > const vals = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < vals.size(); ++k )
+    {
+      vals[k] *= 2.0;
+    }
+  }
+  EXPECT_TRUE( B.updateValues( localMatrix.toViewConst() ) );
+  EXPECT_DOUBLE_EQ( B.normInf(), 2.0 * A.normInf() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( LAOperationsTest,
                              VectorFunctions,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             MatrixCreateOrUpdate,
+                             MatrixCreateWithBlocks );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, LAOperationsTest, TrilinosInterface, );
@@ -0,0 +1,142 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testPreconditionerReusePolicy.cpp
+ */
+
+#include <gtest/gtest.h>
+
+#include "managers/initialization.hpp"
+#include "linearAlgebra/utilities/PreconditionerReusePolicy.hpp"
+
+using namespace geosx;
+
+namespace
+{
+
+LinearSolverParameters::PrecondReuse reuseParams( integer const rebuildInterval,
+                                                  real64 const iterGrowthTol )
+{
+  LinearSolverParameters::PrecondReuse params;
+  params.rebuildInterval = rebuildInterval;
+  params.iterGrowthTol = iterGrowthTol;
+  return params;
+}
+
+}
+
+TEST( PreconditionerReusePolicy, defaultRebuildsEverySolve )
+{
+  LinearSolverParameters::PrecondReuse const params;
+  PreconditionerReusePolicy policy;
+
+  for( integer solve = 0; solve < 3; ++solve )
+  {
+    EXPECT_FALSE( policy.canReuse( params, true ) );
+    policy.recordSetup();
+    policy.recordSolve( params, 10 );
+    EXPECT_EQ( policy.age(), 0 );
+  }
+}
+
+TEST( PreconditionerReusePolicy, firstSolveRequiresSetup )
+{
+  LinearSolverParameters::PrecondReuse const params = reuseParams( 4, 0.5 );
+  PreconditionerReusePolicy policy;
+  EXPECT_FALSE( policy.canReuse( params, true ) );
+}
+
+TEST( PreconditionerReusePolicy, rebuildInterval )
+{
+  LinearSolverParameters::PrecondReuse const params = reuseParams( 3, 0.5 );
+  PreconditionerReusePolicy policy;
+
+  // one setup serves three solves
+  for( integer cycle = 0; cycle < 2; ++cycle )
+  {
+    EXPECT_FALSE( policy.canReuse( params, true ) );
+    policy.recordSetup();
+    policy.recordSolve( params, 10 );
+
+    for( integer age = 1; age < params.rebuildInterval; ++age )
+    {
+      ASSERT_TRUE( policy.canReuse( params, true ) );
+      policy.recordReuse();
+      policy.recordSolve( params, 10 );
+      EXPECT_EQ( policy.age(), age );
+    }
+  }
+}
+
+TEST( PreconditionerReusePolicy, incompatiblePreconditioner )
+{
+  LinearSolverParameters::PrecondReuse const params = reuseParams( 5, 0.5 );
+  PreconditionerReusePolicy policy;
+
+  policy.recordSetup();
+  policy.recordSolve( params, 10 );
+  EXPECT_TRUE( policy.canReuse( params, true ) );
+  EXPECT_FALSE( policy.canReuse( params, false ) );
+}
+
+TEST( PreconditionerReusePolicy, iterationGrowthForcesRebuild )
+{
+  LinearSolverParameters::PrecondReuse const params = reuseParams( 10, 0.5 );
+  PreconditionerReusePolicy policy;
+
+  policy.recordSetup();
+  policy.recordSolve( params, 10 );
+
+  // within the tolerance of the first solve after setup
+  ASSERT_TRUE( policy.canReuse( params, true ) );
+  policy.recordReuse();
+  policy.recordSolve( params, 15 );
+  EXPECT_TRUE( policy.canReuse( params, true ) );
+
+  // beyond the tolerance
+  policy.recordReuse();
+  policy.recordSolve( params, 16 );
+  EXPECT_FALSE( policy.canReuse( params, true ) );
+
+  // the next setup resets the reference iteration count
+  policy.recordSetup();
+  policy.recordSolve( params, 20 );
+  ASSERT_TRUE( policy.canReuse( params, true ) );
+  policy.recordReuse();
+  policy.recordSolve( params, 25 );
+  EXPECT_TRUE( policy.canReuse( params, true ) );
+}
+
+TEST( PreconditionerReusePolicy, requestRebuild )
+{
+  LinearSolverParameters::PrecondReuse const params = reuseParams( 10, 0.5 );
+  PreconditionerReusePolicy policy;
+
+  policy.recordSetup();
+  policy.recordSolve( params, 10 );
+  policy.requestRebuild();
+  EXPECT_FALSE( policy.canReuse( params, true ) );
+  policy.recordSetup();
+  EXPECT_TRUE( policy.canReuse( params, true ) );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
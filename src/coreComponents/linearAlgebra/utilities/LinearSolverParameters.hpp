@@ -42,6 +42,8 @@ struct LinearSolverParameters
     gmres,         ///< GMRES
     fgmres,        ///< Flexible GMRES
     bicgstab,      ///< BiCGStab
+    pipecg,        ///< Pipelined CG (single non-blocking reduction per iteration, always run by the native solvers)
+    srgmres,       ///< Single-reduction GMRES (always run by the native solvers)
     preconditioner ///< Preconditioner only
   };
 
@@ -66,6 +68,8 @@ struct LinearSolverParameters
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
   integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
   bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
+  integer reuseMatrixPattern = true; ///< Only update the values of the parallel matrix when its sparsity pattern is unchanged
+  integer usePointBlocks = false;    ///< Exploit the dofsPerNode point-block structure (block storage and AMG coarsening, where supported)
 
   SolverType solverType = SolverType::direct;                        ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
@@ -78,6 +82,7 @@ struct LinearSolverParameters
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    integer adaptiveMaxIterations = 0; ///< Max iterations of a solve whose adaptive tolerance is weaker than relTolerance (0 for maxIterations)
   }
   krylov;                             ///< Krylov-method parameter struct
 
@@ -128,6 +133,14 @@ struct LinearSolverParameters
     integer overlap = 0;   ///< Ghost overlap
   }
   dd;                      ///< Domain decomposition parameter struct
+
+  /// Preconditioner reuse parameters (a reused preconditioner is applied through the native Krylov solvers)
+  struct PrecondReuse
+  {
+    integer rebuildInterval = 1;     ///< Max number of solves served by one full setup (1 = rebuild every solve)
+    real64 iterGrowthTol = 0.5;      ///< Rebuild if iterations exceed those of the first solve after setup by this fraction
+  }
+  precondReuse;                      ///< Preconditioner reuse parameter struct
 };
 
 ENUM_STRINGS( LinearSolverParameters::SolverType,
@@ -136,6 +149,8 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
+              "pipecg",
+              "srgmres",
               "preconditioner" )
 
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
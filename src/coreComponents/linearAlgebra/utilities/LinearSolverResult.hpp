@@ -60,6 +60,9 @@ struct LinearSolverResult
   /// Solve time (in seconds) exclusive of setup costs
   real64 solveTime = 0.0;
 
+  /// Number of solves the preconditioner has been reused for since its last full setup (0 if set up for this solve)
+  integer precondAge = 0;
+
   /**
    * @brief Check whether the last solve was successful.
    * @return @p true if last solve was successful, @p false otherwise
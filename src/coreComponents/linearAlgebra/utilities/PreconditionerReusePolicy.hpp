@@ -0,0 +1,120 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PreconditionerReusePolicy.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_UTILITIES_PRECONDITIONERREUSEPOLICY_HPP_
+#define GEOSX_LINEARALGEBRA_UTILITIES_PRECONDITIONERREUSEPOLICY_HPP_
+
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Bookkeeping of a preconditioner shared by successive linear solves.
+ *
+ * Decides whether the current preconditioner may serve the next solve, according to
+ * LinearSolverParameters::PrecondReuse: a full setup serves at most @p rebuildInterval
+ * solves, and a rebuild is forced once the iteration count grows beyond @p iterGrowthTol
+ * relative to the first solve after the setup.
+ */
+class PreconditionerReusePolicy
+{
+public:
+
+  /**
+   * @brief Check whether the current preconditioner may be reused for the next solve.
+   * @param params the reuse parameters
+   * @param compatible whether the preconditioner is set up and applicable to the next system
+   * @return @p true if the preconditioner can be reused, @p false if a full setup is needed
+   */
+  bool canReuse( LinearSolverParameters::PrecondReuse const & params,
+                 bool const compatible ) const
+  {
+    return params.rebuildInterval > 1 &&
+           compatible &&
+           !m_rebuildRequested &&
+           m_age + 1 < params.rebuildInterval;
+  }
+
+  /**
+   * @brief Record a full setup of the preconditioner.
+   */
+  void recordSetup()
+  {
+    m_age = 0;
+    m_rebuildRequested = false;
+  }
+
+  /**
+   * @brief Record that the preconditioner is reused for the next solve.
+   */
+  void recordReuse()
+  {
+    ++m_age;
+  }
+
+  /**
+   * @brief Record the outcome of a solve and request a rebuild if the iteration count degraded.
+   * @param params the reuse parameters
+   * @param numIterations number of iterations of the solve
+   */
+  void recordSolve( LinearSolverParameters::PrecondReuse const & params,
+                    integer const numIterations )
+  {
+    if( m_age == 0 )
+    {
+      m_baseIterations = numIterations;
+    }
+    else if( numIterations > ( 1.0 + params.iterGrowthTol ) * m_baseIterations )
+    {
+      m_rebuildRequested = true;
+    }
+  }
+
+  /**
+   * @brief Force a full setup for the next solve.
+   */
+  void requestRebuild()
+  {
+    m_rebuildRequested = true;
+  }
+
+  /**
+   * @brief Get the number of solves the preconditioner has been reused for since its last full setup.
+   * @return the preconditioner age
+   */
+  integer age() const
+  {
+    return m_age;
+  }
+
+private:
+
+  /// Number of solves served by the current preconditioner since its last full setup
+  integer m_age = 0;
+
+  /// Iteration count of the first solve after the last full setup
+  integer m_baseIterations = 0;
+
+  /// Flag indicating that the next solve must perform a full setup
+  bool m_rebuildRequested = true;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_UTILITIES_PRECONDITIONERREUSEPOLICY_HPP_
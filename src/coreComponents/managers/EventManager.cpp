@@ -20,8 +20,12 @@
 
 #include "mpiCommunications/CommunicationTools.hpp"
 #include "managers/Events/EventBase.hpp"
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 
+#include <cmath>
+#include <queue>
+
 namespace geosx
 {
 
@@ -115,6 +119,31 @@ void EventManager::Run( dataRepository::Group * domain )
     subEvent.SetProgressIndicator( eventCounters );
   } );
 
+  // The dt reduction across ranks is only needed if some event or target makes a rank-local request
+  bool dtRequestIsRankInvariant = true;
+  this->forSubGroups< EventBase >( [&]( EventBase const & subEvent )
+  {
+    dtRequestIsRankInvariant = dtRequestIsRankInvariant && subEvent.IsTimestepRequestRankInvariant();
+  } );
+  GEOSX_LOG_LEVEL_RANK_0( 1, "Timestep requests are " << ( dtRequestIsRankInvariant ? "" : "not " ) << "rank-invariant" );
+
+  // Calendar of the events whose timing is known in advance, sorted by their next wake-up time or cycle.
+  // These events are only checked during the cycles where they may prepare for or start an execution.
+  localIndex const numEvents = this->numSubGroups();
+  using TimeEntry = std::pair< real64, localIndex >;
+  using CycleEntry = std::pair< integer, localIndex >;
+  std::priority_queue< TimeEntry, std::vector< TimeEntry >, std::greater< TimeEntry > > timeCalendar;
+  std::priority_queue< CycleEntry, std::vector< CycleEntry >, std::greater< CycleEntry > > cycleCalendar;
+  array1d< integer > eventIsDue( numEvents );
+  eventIsDue.setValues< serialPolicy >( 1 );
+
+  // Overhead of the event loop itself (excluding the execution of the targets) for logLevel >= 1
+  bool const timeEventOverhead = this->getLogLevel() >= 1;
+  array1d< real64 > eventOverheadTime( numEvents );
+  array1d< localIndex > numSkippedChecks( numEvents );
+  real64 dtReductionTime = 0.0;
+  Stopwatch watch;
+
   // Inform user if it appears this is a mid-loop restart
   if((m_currentSubEvent > 0))
   {
@@ -135,18 +164,51 @@ void EventManager::Run( dataRepository::Group * domain )
       for(; m_currentSubEvent<this->numSubGroups(); ++m_currentSubEvent )
       {
         EventBase * subEvent = static_cast< EventBase * >( this->GetSubGroups()[m_currentSubEvent] );
+        if( timeEventOverhead )
+        {
+          watch.zero();
+        }
         m_dt = std::min( subEvent->GetTimestepRequest( m_time ), m_dt );
+        if( timeEventOverhead )
+        {
+          eventOverheadTime[m_currentSubEvent] += watch.elapsedTime();
+        }
       }
       m_currentSubEvent = 0;
 
 #ifdef GEOSX_USE_MPI
       // Find the min dt across processes
-      real64 dt_global;
-      MPI_Allreduce( &m_dt, &dt_global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_GEOSX );
-      m_dt = dt_global;
+      if( !dtRequestIsRankInvariant )
+      {
+        if( timeEventOverhead )
+        {
+          watch.zero();
+        }
+        real64 dt_global;
+        MPI_Allreduce( &m_dt, &dt_global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_GEOSX );
+        m_dt = dt_global;
+        if( timeEventOverhead )
+        {
+          dtReductionTime += watch.elapsedTime();
+        }
+      }
 #endif
     }
 
+    // Wake up the scheduled events that may prepare for execution (forecast == 1) during this cycle.
+    // Note: one extra cycle and a relative tolerance cover the round-off errors of the event forecasts.
+    while( !timeCalendar.empty() &&
+           timeCalendar.top().first - m_time <= 3.0 * m_dt + 1e-12 * std::fabs( timeCalendar.top().first ) )
+    {
+      eventIsDue[timeCalendar.top().second] = 1;
+      timeCalendar.pop();
+    }
+    while( !cycleCalendar.empty() && cycleCalendar.top().first <= m_cycle + 1 )
+    {
+      eventIsDue[cycleCalendar.top().second] = 1;
+      cycleCalendar.pop();
+    }
+
     GEOSX_LOG_RANK_0( "Time: " << m_time << "s, dt:" << m_dt << "s, Cycle: " << m_cycle );
 
     // Execute
@@ -154,13 +216,31 @@ void EventManager::Run( dataRepository::Group * domain )
     {
       EventBase * subEvent = static_cast< EventBase * >( this->GetSubGroups()[m_currentSubEvent] );
 
+      if( timeEventOverhead )
+      {
+        watch.zero();
+      }
+
       // Calculate the event and sub-event forecasts
-      subEvent->CheckEvents( m_time, m_dt, m_cycle, domain );
+      if( eventIsDue[m_currentSubEvent] )
+      {
+        subEvent->CheckEvents( m_time, m_dt, m_cycle, domain );
+      }
+      else
+      {
+        subEvent->SkipCheckEvents();
+        ++numSkippedChecks[m_currentSubEvent];
+      }
+
+      if( timeEventOverhead )
+      {
+        eventOverheadTime[m_currentSubEvent] += watch.elapsedTime();
+      }
 
       // Print debug information for logLevel >= 1
       GEOSX_LOG_LEVEL_RANK_0( 1,
                               "     Event: " << m_currentSubEvent << " (" << subEvent->getName() << "), dt_request=" << subEvent->GetCurrentEventDtRequest() << ", forecast=" <<
-                              subEvent->getForecast() );
+                              ( eventIsDue[m_currentSubEvent] ? std::to_string( subEvent->getForecast() ) : "scheduled" ) );
 
       // Execute, signal events
       if( subEvent->hasToPrepareForExec() )
@@ -172,6 +252,22 @@ void EventManager::Run( dataRepository::Group * domain )
         subEvent->Execute( m_time, m_dt, m_cycle, 0, 0, domain );
       }
 
+      // Add the event to the calendar once its state is up to date
+      real64 wakeTime = 0.0;
+      integer wakeCycle = 0;
+      if( eventIsDue[m_currentSubEvent] && subEvent->GetNextWakeUp( m_time, wakeTime, wakeCycle ) )
+      {
+        eventIsDue[m_currentSubEvent] = 0;
+        if( wakeTime < std::numeric_limits< real64 >::max() )
+        {
+          timeCalendar.emplace( wakeTime, m_currentSubEvent );
+        }
+        else if( wakeCycle < std::numeric_limits< integer >::max() )
+        {
+          cycleCalendar.emplace( wakeCycle, m_currentSubEvent );
+        }
+      }
+
       // Check the exit flag
       // Note: Currently, this is only being used by the HaltEvent
       //       If it starts being used elsewhere it may need to be synchronized
@@ -184,6 +280,18 @@ void EventManager::Run( dataRepository::Group * domain )
     m_currentSubEvent = 0;
   }
 
+  // Report the overhead of the event loop on rank 0
+  if( timeEventOverhead )
+  {
+    GEOSX_LOG_RANK_0( "Event loop overhead (excluding the execution of the targets):" );
+    for( localIndex i = 0; i < numEvents; ++i )
+    {
+      GEOSX_LOG_RANK_0( "     Event: " << i << " (" << this->GetSubGroups()[i]->getName() << "), overhead=" << eventOverheadTime[i]
+                                      << "s, skipped checks=" << numSkippedChecks[i] );
+    }
+    GEOSX_LOG_RANK_0( "     Timestep reduction: " << dtReductionTime << "s" );
+  }
+
   // Cleanup
   GEOSX_LOG_RANK_0( "Cleaning up events" );
 
@@ -72,6 +72,11 @@ public:
    *   - Execute an event (forecast == 0)
    *   - Determine dt for the next cycle
    *   - Advance time, cycle, etc.
+   *
+   * The events whose timing is known in advance (see EventBase::GetNextWakeUp) are kept in a calendar
+   * and are not checked until they may prepare for execution. The dt reduction across ranks is skipped
+   * if all the events and targets make rank-invariant requests. For logLevel >= 1, the overhead of the
+   * event loop is reported for each event at the end of the run.
    * @param[in] domain the current DomainPartition on which the Event will be ran
    */
   void Run( dataRepository::Group * domain );
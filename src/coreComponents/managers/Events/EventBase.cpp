@@ -312,6 +312,48 @@ real64 EventBase::GetTimestepRequest( real64 const time )
 }
 
 
+bool EventBase::IsTimestepRequestRankInvariant() const
+{
+  // The event-type requests and forecasts only depend on the time, the cycle, or globally reduced values
+  bool isRankInvariant = ( m_target == nullptr ) || m_target->IsTimestepRequestRankInvariant();
+
+  this->forSubGroups< EventBase >( [&]( EventBase const & subEvent )
+  {
+    isRankInvariant = isRankInvariant && subEvent.IsTimestepRequestRankInvariant();
+  } );
+
+  return isRankInvariant;
+}
+
+
+bool EventBase::GetNextWakeUp( real64 const time,
+                               real64 & wakeTime,
+                               integer & wakeCycle ) const
+{
+  wakeTime = std::numeric_limits< real64 >::max();
+  wakeCycle = std::numeric_limits< integer >::max();
+
+  if( this->numSubGroups() > 0 )
+  {
+    return false;
+  }
+
+  if( time >= m_endTime )
+  {
+    // The event window is closed for good
+    return true;
+  }
+  else if( time < m_beginTime )
+  {
+    // Until the window opens, the forecast is based on the begin time
+    wakeTime = m_beginTime;
+    return true;
+  }
+
+  return GetEventTypeWakeUp( wakeTime, wakeCycle );
+}
+
+
 integer EventBase::GetExitFlag()
 {
   this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
@@ -131,6 +131,45 @@ public:
                             integer const cycle,
                             dataRepository::Group * domain );
 
+  /**
+   * @brief Set the event as idle for the current cycle without estimating its timing.
+   * @note This is used by the event manager for the events that cannot prepare for or
+   *       start an execution before their next wake-up (see GetNextWakeUp()).
+   */
+  void SkipCheckEvents()
+  { setIdle(); }
+
+  /**
+   * @brief Get the time or cycle before which the event is known to stay idle.
+   * @param[in] time The current simulation time.
+   * @param[out] wakeTime The time of the next possible execution, or the max real64 value.
+   * @param[out] wakeCycle The cycle of the next possible execution, or the max integer value.
+   * @return @p false if the timing of the event cannot be known in advance.
+   *
+   * The event does not need to be checked as long as the current time is more than
+   * two time increments before @p wakeTime and the current cycle more than one cycle
+   * before @p wakeCycle. If both values are the max values, the event will never execute again.
+   * Events with sub-events are never scheduled, since the state of the sub-events
+   * contributes to the timestep request.
+   */
+  bool GetNextWakeUp( real64 const time,
+                      real64 & wakeTime,
+                      integer & wakeCycle ) const;
+
+  /**
+   * @brief Get the event-specific time or cycle of the next possible execution.
+   * @param[out] wakeTime The time of the next possible execution, or unchanged if the event is not time-based.
+   * @param[out] wakeCycle The cycle of the next possible execution, or unchanged if the event is not cycle-based.
+   * @return @p false if the timing of the event cannot be known in advance.
+   */
+  virtual bool GetEventTypeWakeUp( real64 & wakeTime,
+                                   integer & wakeCycle ) const
+  {
+    GEOSX_UNUSED_VAR( wakeTime );
+    GEOSX_UNUSED_VAR( wakeCycle );
+    return false;
+  }
+
   /**
    * @brief Perform the calculations to estimate the timing of the event.
    * @param time The current simulation time.
@@ -150,6 +189,12 @@ public:
    */
   virtual real64 GetTimestepRequest( real64 const time ) override;
 
+  /**
+   * @brief Check whether the timestep requests of the event, its target and its sub-events are the same on all ranks.
+   * @return @p true if the timestep request does not need to be reduced across ranks.
+   */
+  virtual bool IsTimestepRequestRankInvariant() const override;
+
   /**
    * @brief Get event-specifit dt requests.
    * @param time The current simulation time.
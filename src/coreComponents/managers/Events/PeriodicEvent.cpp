@@ -209,6 +209,20 @@ real64 PeriodicEvent::GetEventTypeDtRequest( real64 const time )
   return requestedDt;
 }
 
+bool PeriodicEvent::GetEventTypeWakeUp( real64 & wakeTime,
+                                        integer & wakeCycle ) const
+{
+  if( m_timeFrequency >= 0.0 )
+  {
+    wakeTime = m_lastTime + m_timeFrequency;
+  }
+  else
+  {
+    wakeCycle = m_lastCycle + m_cycleFrequency;
+  }
+  return true;
+}
+
 void PeriodicEvent::Cleanup( real64 const time_n,
                              integer const cycleNumber,
                              integer const GEOSX_UNUSED_PARAM( eventCounter ),
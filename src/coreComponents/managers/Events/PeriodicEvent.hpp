@@ -93,6 +93,14 @@ public:
    */
   virtual real64 GetEventTypeDtRequest( real64 const time ) override;
 
+  /**
+   * @copydoc EventBase::GetEventTypeWakeUp()
+   * @note The next execution cannot occur before the last one plus the time or cycle frequency.
+   *       The optional function is only evaluated once the event is due, so it does not prevent scheduling.
+   */
+  virtual bool GetEventTypeWakeUp( real64 & wakeTime,
+                                   integer & wakeCycle ) const override;
+
   /**
    * @copydoc ExecutableGroup::Cleanup()
    */
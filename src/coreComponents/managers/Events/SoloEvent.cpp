@@ -107,5 +107,23 @@ real64 SoloEvent::GetEventTypeDtRequest( real64 const time )
 
 
 
+bool SoloEvent::GetEventTypeWakeUp( real64 & wakeTime,
+                                    integer & wakeCycle ) const
+{
+  // Note: if m_lastCycle is set, then the event has already executed
+  if( m_lastCycle < 0 )
+  {
+    if( m_targetTime >= 0.0 )
+    {
+      wakeTime = m_targetTime;
+    }
+    else
+    {
+      wakeCycle = m_targetCycle;
+    }
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( EventBase, SoloEvent, std::string const &, Group * const )
 } /* namespace geosx */
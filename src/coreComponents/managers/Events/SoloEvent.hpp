@@ -59,6 +59,13 @@ public:
    */
   virtual real64 GetEventTypeDtRequest( real64 const time ) override;
 
+  /**
+   * @copydoc EventBase::GetEventTypeWakeUp()
+   * @note Once executed, the event never wakes up again.
+   */
+  virtual bool GetEventTypeWakeUp( real64 & wakeTime,
+                                   integer & wakeCycle ) const override;
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
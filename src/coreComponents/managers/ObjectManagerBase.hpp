@@ -358,12 +358,13 @@ public:
   /**
    * @brief Extract map from object and assign global indices.
    * @param obj The instance.
-   * @param map The map.
+   * @param map The map, with one fixed-width row per object holding the sorted global indices
+   *            of its @p obj objects padded with -1, or only -1 for objects that are not identified.
    *
    * Dummy version, needs to be specialised by derived classes.
    */
   virtual void ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManagerBase const * const obj,
-                                                                std::vector< std::vector< globalIndex > > & map )
+                                                                array2d< globalIndex > & map )
   {
     GEOSX_UNUSED_VAR( obj );
     GEOSX_UNUSED_VAR( map );
@@ -23,6 +23,7 @@
 #include "managers/DomainPartition.hpp"
 #include "mesh/MeshLevel.hpp"
 #include "dataRepository/ConduitRestart.hpp"
+#include "fileIO/timeHistory/TimeHistHDF.hpp"
 
 // TPL includes
 #include <conduit.hpp>
@@ -145,6 +146,7 @@ void BlueprintOutput::Execute( real64 const time,
   GEOSX_ASSERT_MSG( conduit::blueprint::mesh::index::verify( index, info ), info.to_json() );
 
   /// Write out the root index file, then write out the mesh.
+  waitForHDFWrites();
   char buffer[ 128 ];
   GEOSX_ERROR_IF_GE( snprintf( buffer, 128, "blueprintFiles/cycle_%07d", cycle ), 128 );
   std::string const filePathForRank = dataRepository::writeRootFile( fileRoot, buffer );
@@ -20,6 +20,7 @@
 #include "mesh/MeshLevel.hpp"
 #include "managers/DomainPartition.hpp"
 #include "fileIO/coupling/ChomboCoupler.hpp"
+#include "fileIO/timeHistory/TimeHistHDF.hpp"
 #include <string>
 #include <fstream>
 #include <chrono>
@@ -75,6 +76,9 @@ void ChomboIO::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
                         real64 const GEOSX_UNUSED_PARAM( eventProgress ),
                         dataRepository::Group * const domain )
 {
+  // the coupler accesses HDF5 files, which may be written in the background
+  waitForHDFWrites();
+
   if( m_coupler == nullptr )
   {
     GEOSX_ERROR_IF( m_waitForInput && m_inputPath == "/INVALID_INPUT_PATH", "Waiting for input but no input path was specified." );
@@ -48,6 +48,13 @@ public:
   /// Method for setting up output directories.
   virtual void SetupDirectoryStructure();
 
+  /**
+   * @copydoc ExecutableGroup::IsTimestepRequestRankInvariant()
+   * @note The outputs do not request a timestep.
+   */
+  virtual bool IsTimestepRequestRankInvariant() const override
+  { return true; }
+
   // Catalog interface
   /// @cond DO_NOT_DOCUMENT
   using CatalogInterface = dataRepository::CatalogInterface< OutputBase, std::string const &, Group * const >;
@@ -18,6 +18,7 @@
 
 #include "RestartOutput.hpp"
 #include "fileIO/silo/SiloFile.hpp"
+#include "fileIO/timeHistory/TimeHistHDF.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/Functions/FunctionManager.hpp"
 #include "managers/ProblemManager.hpp"
@@ -31,8 +32,37 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( std::string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_asyncWrite( 0 ),
+  m_ranksPerFile( 1 ),
+  m_incrementalInterval( 0 ),
+  m_numDeltasSinceBase( 0 )
+{
+  registerWrapper( viewKeyStruct::asyncWriteString, &m_asyncWrite )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to write the restart files from a background thread while the simulation continues. "
+                    "The restart tree is copied to a staging buffer first. "
+                    "HDF5 must be thread-safe if other HDF5 outputs run concurrently." );
+
+  registerWrapper( viewKeyStruct::ranksPerFileString, &m_ranksPerFile )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of ranks whose data is gathered and written by a single rank into one restart file." );
+
+  registerWrapper( viewKeyStruct::incrementalIntervalString, &m_incrementalInterval )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of incremental restart files written between two full restart files. "
+                    "An incremental restart file only contains the data that changed since the last full restart file, "
+                    "which must be kept alongside it to restart. Set to 0 to always write full restart files." );
+}
+
+void RestartOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_LT_MSG( m_ranksPerFile, 1, getName() << ": " << viewKeyStruct::ranksPerFileString << " must be positive" );
+  GEOSX_ERROR_IF_LT_MSG( m_incrementalInterval, 0, getName() << ": " << viewKeyStruct::incrementalIntervalString << " must be non-negative" );
+}
 
 RestartOutput::~RestartOutput()
 {}
@@ -54,10 +84,28 @@ void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   char fileName[200] = {0};
   sprintf( fileName, "%s_%s_%09d", problemManager->getProblemName().c_str(), "restart", cycleNumber );
 
+  // the time histories written in the background also use the HDF5 library
+  waitForHDFWrites();
+
   problemManager->prepareToWrite();
   FunctionManager::Instance().prepareToWrite();
   FieldSpecificationManager::get().prepareToWrite();
-  writeTree( fileName );
+  if( m_incrementalInterval > 0 && !m_basePath.empty() && m_numDeltasSinceBase < m_incrementalInterval )
+  {
+    writeDeltaTree( fileName, m_basePath, m_baseHashes, m_ranksPerFile, m_asyncWrite );
+    ++m_numDeltasSinceBase;
+  }
+  else
+  {
+    writeTree( fileName, m_ranksPerFile, m_asyncWrite );
+    if( m_incrementalInterval > 0 )
+    {
+      // hashed while the tree still refers to the data just written
+      m_baseHashes = hashTree();
+      m_basePath = fileName;
+      m_numDeltasSinceBase = 0;
+    }
+  }
   problemManager->finishWriting();
   FunctionManager::Instance().finishWriting();
   FieldSpecificationManager::get().finishWriting();
@@ -20,6 +20,7 @@
 #define GEOSX_MANAGERS_OUTPUTS_RESTARTOUTPUT_HPP_
 
 #include "OutputBase.hpp"
+#include "dataRepository/ConduitRestart.hpp"
 
 
 namespace geosx
@@ -69,14 +70,42 @@ public:
                         dataRepository::Group * domain ) override
   {
     Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    dataRepository::waitForTreeWrite();
   }
 
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
+    static constexpr auto asyncWriteString = "asyncWrite";
+    static constexpr auto ranksPerFileString = "ranksPerFile";
+    static constexpr auto incrementalIntervalString = "incrementalInterval";
   } viewKeys;
   /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+
+  /// Flag to write the restart files from a background thread
+  integer m_asyncWrite;
+
+  /// Number of ranks aggregated in each restart file
+  integer m_ranksPerFile;
+
+  /// Number of restart files between two full restart files, 0 to always write full files
+  integer m_incrementalInterval;
+
+  /// Number of restart files written since the last full restart file
+  integer m_numDeltasSinceBase;
+
+  /// Path of the last full restart file
+  std::string m_basePath;
+
+  /// Hashes of the wrappers written in the last full restart file
+  dataRepository::TreeHashes m_baseHashes;
 };
 
 
@@ -20,6 +20,7 @@
 
 #include "common/TimingMacros.hpp"
 #include "fileIO/silo/SiloFile.hpp"
+#include "fileIO/timeHistory/TimeHistHDF.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/Functions/FunctionManager.hpp"
 
@@ -84,6 +85,9 @@ void SiloOutput::Execute( real64 const time_n,
 {
   GEOSX_MARK_FUNCTION;
 
+  // silo writes through the HDF5 library, which may be in use by background writes
+  waitForHDFWrites();
+
   DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
   SiloFile silo;
 
@@ -8,7 +8,10 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
-  m_io( )
+  m_io( ),
+  m_keepFileOpen( 0 ),
+  m_asyncWrite( 0 ),
+  m_file( )
 {
   registerWrapper( viewKeys::timeHistoryOutputTarget, &m_collectorPaths )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -30,6 +33,36 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ )->
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::keepFileOpen, &m_keepFileOpen )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to keep the time history file and datasets open between writes, until the end of the simulation. "
+                    "The datasets are then chunked over several history records." );
+
+  registerWrapper( viewKeys::asyncWrite, &m_asyncWrite )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to write the time history file from background threads while the simulation continues, "
+                    "requires keepFileOpen. HDF5 must be thread-safe if other HDF5 outputs run concurrently." );
+}
+
+void TimeHistoryOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF( m_asyncWrite && !m_keepFileOpen,
+                  getName() << ": " << viewKeys::asyncWrite << " requires " << viewKeys::keepFileOpen );
+}
+
+std::unique_ptr< HDFHistIO > TimeHistoryOutput::makeHistIO( HistoryMetadata const & metadata,
+                                                            localIndex writeHead,
+                                                            localIndex initAlloc,
+                                                            MPI_Comm comm )
+{
+  std::unique_ptr< HDFHistIO > io = std::make_unique< HDFHistIO >( m_filename, metadata, writeHead, initAlloc, 2, comm );
+  if( m_file )
+  {
+    io->setPersistentFile( m_file, m_asyncWrite );
+  }
+  return io;
 }
 
 void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryCollection * collector )
@@ -39,12 +72,20 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
   for( localIndex ii = 0; ii < collector->getCollectionCount( ); ++ii )
   {
     HistoryMetadata metadata = collector->getMetadata( pm, ii );
-    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, metadata, m_recordCount ) );
+    m_io.emplace_back( makeHistIO( metadata, m_recordCount, 2 ) );
     collector->registerBufferCall( ii, [this, ii]() { return m_io[ii]->getBufferHead( ); } );
     m_io.back()->init( !freshInit );
   }
   int rnk = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
-  if( rnk == 0 )
+  if( m_file )
+  {
+    // all ranks take part in the collective operations on the time dataset of the persistent file
+    HistoryMetadata timeMetadata( "Time", rnk == 0 ? 1 : 0, std::type_index( typeid(real64) ) );
+    m_io.emplace_back( makeHistIO( timeMetadata, m_recordCount, 2 ) );
+    collector->registerTimeBufferCall( [this]() { return m_io.back()->getBufferHead( ); } );
+    m_io.back()->init( !freshInit );
+  }
+  else if( rnk == 0 )
   {
     HistoryMetadata timeMetadata = collector->getTimeMetadata( );
     m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, timeMetadata, m_recordCount, 2, 2, MPI_COMM_SELF ) );
@@ -64,7 +105,7 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
       {
         HistoryMetadata metaMetadata = metaCollector->getMetadata( pm, ii );
         metaMetadata.setName( collector->getTargetName() + " " + metaMetadata.getName( ) );
-        metaIOs[ii] = std::make_unique< HDFHistIO >( m_filename, metaMetadata, 0, 1 );
+        metaIOs[ii] = makeHistIO( metaMetadata, 0, 1 );
         metaCollector->registerBufferCall( ii, [&metaIOs, ii] () { return metaIOs[ii]->getBufferHead( ); } );
         metaIOs[ii]->init( false );
       }
@@ -80,6 +121,24 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
 
 void TimeHistoryOutput::InitializePostSubGroups( Group * const group )
 {
+#ifdef GEOSX_USE_MPI
+  // parallel HDF5 writes call MPI-IO from the background threads
+  int threadSupport = MPI_THREAD_SINGLE;
+  MPI_Query_thread( &threadSupport );
+  GEOSX_WARNING_IF( m_asyncWrite && threadSupport < MPI_THREAD_MULTIPLE,
+                    getName() << ": MPI does not support concurrent calls from several threads, " << viewKeys::asyncWrite << " is ignored" );
+  if( threadSupport < MPI_THREAD_MULTIPLE )
+  {
+    m_asyncWrite = 0;
+  }
+#endif
+
+  if( m_keepFileOpen )
+  {
+    // check whether to truncate or append to the file up front, then keep it open for all later accesses
+    m_file = std::make_shared< HDFFile >( m_filename, (m_recordCount == 0), true, MPI_COMM_GEOSX );
+  }
+  else
   {
     // check whether to truncate or append to the file up front so we don't have to bother during later accesses
     HDFFile( m_filename, (m_recordCount == 0), true, MPI_COMM_GEOSX );
@@ -124,6 +183,12 @@ void TimeHistoryOutput::Cleanup( real64 const time_n,
   {
     th_io->compressInFile();
   }
+  // flush and close the persistent file, if any
+  for( auto & th_io : m_io )
+  {
+    th_io->close();
+  }
+  m_file.reset();
 }
 
 REGISTER_CATALOG_ENTRY( OutputBase, TimeHistoryOutput, std::string const &, Group * const )
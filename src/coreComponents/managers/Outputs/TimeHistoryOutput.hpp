@@ -88,11 +88,30 @@ public:
     static constexpr auto timeHistoryOutputFilename = "filename";
     static constexpr auto timeHistoryOutputFormat = "format";
     static constexpr auto timeHistoryRestart = "restart";
+    static constexpr auto keepFileOpen = "keepFileOpen";
+    static constexpr auto asyncWrite = "asyncWrite";
   } timeHistoryOutputViewKeys;
   /// @endcond
 
+protected:
+
+  virtual void PostProcessInput() override;
+
 private:
 
+  /**
+   * @brief Create a buffered history output object writing to the file of this output.
+   * @param metadata The metadata of the history data.
+   * @param writeHead How many time history states have been written to the file.
+   * @param initAlloc How many states to preallocate the internal buffer to hold.
+   * @param comm A communicator where every rank will participate in writing to the output file.
+   * @return The history output object, not yet initialized.
+   */
+  std::unique_ptr< HDFHistIO > makeHistIO( HistoryMetadata const & metadata,
+                                           localIndex writeHead,
+                                           localIndex initAlloc,
+                                           MPI_Comm comm = MPI_COMM_GEOSX );
+
   /**
    * @brief Initialize a time history collector to write to an MPI comm-specific file collectively.
    * @param group The ProblemManager cast to a Group
@@ -110,6 +129,12 @@ private:
   integer m_recordCount;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
+  /// Flag to keep the time history file open between writes
+  integer m_keepFileOpen;
+  /// Flag to write the time history file from background threads
+  integer m_asyncWrite;
+  /// The time history file, when kept open between writes
+  std::shared_ptr< HDFFile > m_file;
 };
 }
 
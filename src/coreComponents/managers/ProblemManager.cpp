@@ -29,8 +29,10 @@
 #include "managers/NumericalMethodsManager.hpp"
 #include "managers/Outputs/OutputManager.hpp"
 #include "managers/Tasks/TasksManager.hpp"
+#include "mesh/CellBlockManager.hpp"
 #include "mesh/MeshBody.hpp"
 #include "meshUtilities/MeshManager.hpp"
+#include "meshUtilities/MeshReordering.hpp"
 #include "meshUtilities/MeshUtilities.hpp"
 #include "meshUtilities/SimpleGeometricObjects/GeometricObjectManager.hpp"
 #include "meshUtilities/SimpleGeometricObjects/SimpleGeometricObjectBase.hpp"
@@ -579,6 +581,11 @@ void ProblemManager::GenerateMesh()
   meshManager->GenerateMeshes( domain );
   Group * const cellBlockManager = domain->GetGroup( keys::cellManager );
 
+  // The cell blocks are shared by all the mesh levels, so the nodes and elements generated on the
+  // first level are renumbered once, before any map is built from them
+  meshReordering::reorderMesh( meshManager->getReorderingMethod(),
+                               *domain->getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager(),
+                               *domain->GetGroup< CellBlockManager >( keys::cellManager ) );
 
   Group * const meshBodies = domain->getMeshBodies();
 
@@ -789,6 +796,11 @@ void ProblemManager::RunSimulation()
 {
   DomainPartition * domain = getDomainPartition();
   m_eventManager->Run( domain );
+
+  GetPhysicsSolverManager().forSubGroups< SolverBase >( []( SolverBase const & solver )
+  {
+    solver.ReportSolverStatistics();
+  } );
 }
 
 DomainPartition * ProblemManager::getDomainPartition()
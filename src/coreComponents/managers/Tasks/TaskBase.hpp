@@ -72,6 +72,13 @@ public:
 
   /// @copydoc geosx::dataRepository::Group::PostProcessInput( )
   void PostProcessInput() override;
+
+  /**
+   * @copydoc ExecutableGroup::IsTimestepRequestRankInvariant()
+   * @note The tasks do not request a timestep.
+   */
+  virtual bool IsTimestepRequestRankInvariant() const override
+  { return true; }
 };
 
 } /* namespace */
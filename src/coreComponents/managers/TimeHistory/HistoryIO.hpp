@@ -75,6 +75,12 @@ public:
    */
   virtual void compressInFile( ) = 0;
 
+  /**
+   * @brief Release the output target, if it is kept open between writes.
+   * @note Any write still in progress is completed first.
+   */
+  virtual void close( ) {}
+
   /**
    * @brief Query the number of history states currently stored in the internal buffer.
    * @return The number of discrete time history records buffered to be written.
@@ -1,10 +1,14 @@
 #include "PackCollection.hpp"
 
+#include <cstring>
+
 namespace geosx
 {
 PackCollection::PackCollection ( string const & name, Group * parent )
   : HistoryCollection( name, parent )
   , m_setsIndices( )
+  , m_target( nullptr )
+  , m_setsPackers( )
   , m_objectPath( )
   , m_fieldName( )
   , m_setNames( )
@@ -57,6 +61,7 @@ void PackCollection::updateSetsIndices( ProblemManager & pm )
   Group const * target_object = meshLevel.GetGroupByPath( m_objectPath );
   WrapperBase const * target = target_object->getWrapperBase( m_fieldName );
   GEOSX_ERROR_IF( !target->isPackable( false ), "The object targeted for collection must be packable!" );
+  m_target = target;
   localIndex num_sets = m_setNames.size( );
   if( num_sets > 0 )
   {
@@ -78,9 +83,21 @@ void PackCollection::updateSetsIndices( ProblemManager & pm )
       set_idx++;
     }
   }
+
+  // the index lists are only modified above, so the packers referring to them remain valid until the next update
+  m_setsPackers.clear( );
+  if( num_sets > 0 && ParallelPacker::canPack( *target ) )
+  {
+    m_setsPackers.resize( num_sets );
+    for( localIndex set_idx = 0; set_idx < num_sets; ++set_idx )
+    {
+      m_setsPackers[ set_idx ].addIndexList( m_setsIndices[ set_idx ] );
+      m_setsPackers[ set_idx ].addField( *target );
+    }
+  }
 }
 
-void PackCollection::collect( Group * domain_group,
+void PackCollection::collect( Group * GEOSX_UNUSED_PARAM( domain_group ),
                               real64 const GEOSX_UNUSED_PARAM( time_n ),
                               real64 const GEOSX_UNUSED_PARAM( dt ),
                               localIndex collectionIdx,
@@ -88,22 +105,35 @@ void PackCollection::collect( Group * domain_group,
 {
   GEOSX_MARK_FUNCTION;
   GEOSX_ERROR_IF( collectionIdx >= getCollectionCount( ), "Attempting to collection from an invalid collection index!" );
-  DomainPartition const & domain = dynamicCast< DomainPartition const & >( *domain_group );
-  MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
-  Group const * target_object = meshLevel.GetGroupByPath( m_objectPath );
-  WrapperBase const * target = target_object->getWrapperBase( m_fieldName );
+  GEOSX_ERROR_IF( m_target == nullptr, "The field to collect has not been resolved!" );
   if( m_setNames.size( ) > 0 )
   {
     localIndex sz = m_setsIndices.size( );
     if( sz > 0 )
     {
-      // if we could directly transfer a sorted array to an array1d including on device this wouldn't require storing a copy of the indices
-      target->PackByIndex( buffer, m_setsIndices[ collectionIdx ], false, true );
+      if( !m_setsPackers.empty( ) )
+      {
+        // the values of the set are gathered without any metadata, which is the same layout as PackByIndex
+        m_setsPackers[ collectionIdx ].pack( buffer );
+      }
+      else
+      {
+        // if we could directly transfer a sorted array to an array1d including on device this wouldn't require storing a copy of the indices
+        m_target->PackByIndex( buffer, m_setsIndices[ collectionIdx ], false, true );
+      }
     }
   }
+  else if( ParallelPacker::canPack( *m_target ) )
+  {
+    // the whole field is contiguous
+    m_target->move( LvArray::MemorySpace::CPU, false );
+    localIndex const numBytes = m_target->size( ) * m_target->elementByteSize( );
+    std::memcpy( buffer, m_target->voidPointer( ), numBytes );
+    buffer += numBytes;
+  }
   else
   {
-    target->Pack( buffer, false, true );
+    m_target->Pack( buffer, false, true );
   }
 }
 
@@ -20,6 +20,7 @@
 #define GEOSX_PackCollection_HPP_
 
 #include "TimeHistoryCollection.hpp"
+#include "mpiCommunications/ParallelPacker.hpp"
 
 namespace geosx
 {
@@ -56,7 +57,7 @@ public:
   }
 
   /**
-   * @brief Update the indices related to the sets being collected.
+   * @brief Resolve the field to collect and update the indices related to the sets being collected.
    * @param problemManager The problem manager cast to a group.
    * @note This is only required because we don't want to copy/move the
    *       indices each collection execution, becuase that causes data movement
@@ -64,6 +65,8 @@ public:
    * @note Refactoring the packing functions to allow direct usage of set indices
    *       from SortedArrayView instead of only ArrayViews will remove this
    *       duplication.
+   * @note The field is resolved once here rather than at each collection, and is then gathered
+   *       directly into the output buffer when its index slices are contiguous (see ParallelPacker::canPack).
    */
   void updateSetsIndices( ProblemManager & problemManager );
 
@@ -90,6 +93,10 @@ private:
   // for indexing)
   /// The indices for the specified sets to pack
   std::vector< array1d< localIndex > > m_setsIndices;
+  /// The field to collect, resolved by updateSetsIndices()
+  dataRepository::WrapperBase const * m_target;
+  /// The threaded gathers of the specified sets, empty if the field cannot be gathered this way
+  std::vector< ParallelPacker > m_setsPackers;
   /// The dataRepository name/path to get history data from
   string m_objectPath;
   /// The (packable) field associated with the specified object to get data from
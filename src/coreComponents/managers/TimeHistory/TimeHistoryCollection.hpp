@@ -106,11 +106,15 @@ public:
       buffer_unit_type * buffer = m_bufferCalls[collectionIdx]();
       collect( domain, time_n, dt, collectionIdx, buffer );
     }
+    // the time buffer may be registered on all ranks to keep the buffered counts consistent, but only rank 0 holds the time
     int rank = MpiWrapper::Comm_rank();
-    if( rank == 0 && m_timeBufferCall )
+    if( m_timeBufferCall )
     {
       buffer_unit_type * timeBuffer = m_timeBufferCall();
-      memcpy( timeBuffer, &time_n, sizeof(time_n) );
+      if( rank == 0 )
+      {
+        memcpy( timeBuffer, &time_n, sizeof(time_n) );
+      }
     }
   }
 
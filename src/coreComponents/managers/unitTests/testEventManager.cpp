@@ -0,0 +1,351 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+#include "gtest/gtest.h"
+
+#include "managers/initialization.hpp"
+
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/EventManager.hpp"
+#include "managers/Events/PeriodicEvent.hpp"
+#include "managers/Events/SoloEvent.hpp"
+#include "managers/Tasks/TaskBase.hpp"
+#include "meshUtilities/MeshManager.hpp"
+
+#include <cstring>
+#include <limits>
+#include <map>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+/// Executions of a target, as (time, cycle) pairs
+using ExecutionList = std::vector< std::pair< real64, integer > >;
+
+/**
+ * @brief Task recording the times and cycles of its executions.
+ */
+class EventRecorderTask : public TaskBase
+{
+public:
+
+  EventRecorderTask( std::string const & name,
+                     Group * const parent ):
+    TaskBase( name, parent )
+  {}
+
+  static string CatalogName() { return "EventRecorderTask"; }
+
+  virtual void Execute( real64 const time_n,
+                        real64 const GEOSX_UNUSED_PARAM( dt ),
+                        integer const cycleNumber,
+                        integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                        real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                        dataRepository::Group * GEOSX_UNUSED_PARAM( domain ) ) override
+  {
+    m_executions.emplace_back( time_n, cycleNumber );
+  }
+
+  ExecutionList const & executions() const
+  {
+    return m_executions;
+  }
+
+private:
+  ExecutionList m_executions;
+};
+
+/**
+ * @brief Task making a rank-local timestep request.
+ */
+class RankLocalTask : public EventRecorderTask
+{
+public:
+
+  RankLocalTask( std::string const & name,
+                 Group * const parent ):
+    EventRecorderTask( name, parent )
+  {}
+
+  static string CatalogName() { return "RankLocalTask"; }
+
+  virtual bool IsTimestepRequestRankInvariant() const override
+  { return false; }
+};
+
+/**
+ * @brief Target relying on the default timestep request and rank invariance.
+ */
+class PlainTarget : public ExecutableGroup
+{
+public:
+
+  PlainTarget( std::string const & name,
+               Group * const parent ):
+    ExecutableGroup( name, parent )
+  {}
+
+  virtual void Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                        real64 const GEOSX_UNUSED_PARAM( dt ),
+                        integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                        integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                        real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                        dataRepository::Group * GEOSX_UNUSED_PARAM( domain ) ) override
+  {}
+};
+
+REGISTER_CATALOG_ENTRY( TaskBase, EventRecorderTask, std::string const &, Group * const )
+REGISTER_CATALOG_ENTRY( TaskBase, RankLocalTask, std::string const &, Group * const )
+
+/// Events with a target, by name, covering the time-based, cycle-based, windowed and solo events
+std::map< string, string > const targetedEvents =
+{
+  { "timeExact", "<PeriodicEvent name=\"timeExact\" timeFrequency=\"1.5\" target=\"/Tasks/timeExact\"/>" },
+  { "timeLoose", "<PeriodicEvent name=\"timeLoose\" timeFrequency=\"2.2\" targetExactTimestep=\"0\" target=\"/Tasks/timeLoose\"/>" },
+  { "cycles", "<PeriodicEvent name=\"cycles\" cycleFrequency=\"4\" target=\"/Tasks/cycles\"/>" },
+  { "window", "<PeriodicEvent name=\"window\" cycleFrequency=\"2\" beginTime=\"2.0\" endTime=\"6.0\" target=\"/Tasks/window\"/>" },
+  { "soloTime", "<SoloEvent name=\"soloTime\" targetTime=\"5.05\" target=\"/Tasks/soloTime\"/>" },
+  { "soloCycle", "<SoloEvent name=\"soloCycle\" targetCycle=\"7\" target=\"/Tasks/soloCycle\"/>" }
+};
+
+/**
+ * @brief Build the input of a problem running the targeted events.
+ * @param wrapEvents whether each targeted event is the sub-event of an event executing at every cycle
+ * @return the input
+ *
+ * Events with sub-events are checked at every cycle, so the wrapped events give the reference
+ * executions of the events scheduled by the event manager.
+ */
+string problemInput( bool const wrapEvents )
+{
+  string input =
+    "<Problem>"
+    "  <Events maxTime=\"8.0\">"
+    "    <PeriodicEvent name=\"coarseSteps\" forceDt=\"1.0\" endTime=\"4.0\"/>"
+    "    <PeriodicEvent name=\"fineSteps\" forceDt=\"0.3\" beginTime=\"4.0\"/>";
+  for( auto const & event : targetedEvents )
+  {
+    input += wrapEvents ? "<PeriodicEvent name=\"wrap_" + event.first + "\">" + event.second + "</PeriodicEvent>" : event.second;
+  }
+  input +=
+    "  </Events>"
+    "  <Tasks>";
+  for( auto const & event : targetedEvents )
+  {
+    input += "<EventRecorderTask name=\"" + event.first + "\"/>";
+  }
+  input +=
+    "  </Tasks>"
+    "  <Mesh>"
+    "    <InternalMesh name=\"mesh1\""
+    "                  elementTypes=\"{C3D8}\""
+    "                  xCoords=\"{0, 1}\""
+    "                  yCoords=\"{0, 1}\""
+    "                  zCoords=\"{0, 1}\""
+    "                  nx=\"{1}\""
+    "                  ny=\"{1}\""
+    "                  nz=\"{1}\""
+    "                  cellBlockNames=\"{block1}\"/>"
+    "  </Mesh>"
+    "  <ElementRegions>"
+    "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+    "  </ElementRegions>"
+    "</Problem>";
+  return input;
+}
+
+void setupProblemFromXML( ProblemManager & problemManager, string const & xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput.c_str(), xmlInput.size() );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition * domain = problemManager.getDomainPartition();
+  MeshManager * meshManager = problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager->GenerateMeshLevels( domain );
+
+  ElementRegionManager * elementManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager->getName().c_str() );
+  elementManager->ProcessInputFileRecursive( topLevelNode );
+  elementManager->PostProcessInputRecursive();
+
+  problemManager.ProblemSetup();
+}
+
+/**
+ * @brief Run the event loop of a problem and collect the executions of the targets of the events.
+ * @param wrapEvents whether each targeted event is wrapped in an event checked at every cycle
+ * @return the executions, by event name
+ */
+std::map< string, ExecutionList > runEvents( bool const wrapEvents )
+{
+  ProblemManager problemManager( "Problem", nullptr );
+  setupProblemFromXML( problemManager, problemInput( wrapEvents ) );
+
+  EventManager * const eventManager = problemManager.GetGroup< EventManager >( problemManager.groupKeys.eventManager );
+  eventManager->Run( problemManager.getDomainPartition() );
+
+  Group * const tasksManager = problemManager.GetGroup( problemManager.groupKeys.tasksManager );
+  std::map< string, ExecutionList > executions;
+  for( auto const & event : targetedEvents )
+  {
+    executions[event.first] = tasksManager->GetGroup< EventRecorderTask >( event.first )->executions();
+  }
+  return executions;
+}
+
+}
+
+TEST( EventManagerTest, scheduledEventsMatchCheckedEvents )
+{
+  std::map< string, ExecutionList > const reference = runEvents( true );
+  std::map< string, ExecutionList > const scheduled = runEvents( false );
+
+  for( auto const & event : targetedEvents )
+  {
+    SCOPED_TRACE( event.first );
+    ExecutionList const & expected = reference.at( event.first );
+    ExecutionList const & actual = scheduled.at( event.first );
+    EXPECT_FALSE( actual.empty() );
+    ASSERT_EQ( actual.size(), expected.size() );
+    for( std::size_t i = 0; i < actual.size(); ++i )
+    {
+      EXPECT_EQ( actual[i].first, expected[i].first ) << "execution " << i;
+      EXPECT_EQ( actual[i].second, expected[i].second ) << "execution " << i;
+    }
+  }
+
+  // sanity checks of the reference itself
+  for( std::pair< real64, integer > const & execution : reference.at( "cycles" ) )
+  {
+    EXPECT_EQ( execution.second % 4, 0 );
+  }
+  ASSERT_EQ( reference.at( "soloCycle" ).size(), 1 );
+  EXPECT_EQ( reference.at( "soloCycle" )[0].second, 7 );
+  ASSERT_EQ( reference.at( "soloTime" ).size(), 1 );
+  EXPECT_NEAR( reference.at( "soloTime" )[0].first, 5.05, 1e-12 );
+}
+
+TEST( EventManagerTest, nextWakeUp )
+{
+  PeriodicEvent timeEvent( "timeEvent", nullptr );
+  timeEvent.getReference< real64 >( PeriodicEvent::viewKeyStruct::timeFrequencyString ) = 1.5;
+  timeEvent.getReference< real64 >( EventBase::viewKeyStruct::lastTimeString ) = 3.0;
+
+  real64 wakeTime;
+  integer wakeCycle;
+  EXPECT_TRUE( timeEvent.GetNextWakeUp( 3.0, wakeTime, wakeCycle ) );
+  EXPECT_DOUBLE_EQ( wakeTime, 4.5 );
+  EXPECT_EQ( wakeCycle, std::numeric_limits< integer >::max() );
+
+  // until its window opens, an event waits for the begin time
+  timeEvent.getReference< real64 >( EventBase::viewKeyStruct::beginTimeString ) = 10.0;
+  EXPECT_TRUE( timeEvent.GetNextWakeUp( 3.0, wakeTime, wakeCycle ) );
+  EXPECT_DOUBLE_EQ( wakeTime, 10.0 );
+
+  // once its window is closed, an event never wakes up
+  timeEvent.getReference< real64 >( EventBase::viewKeyStruct::beginTimeString ) = 0.0;
+  timeEvent.getReference< real64 >( EventBase::viewKeyStruct::endTimeString ) = 2.0;
+  EXPECT_TRUE( timeEvent.GetNextWakeUp( 3.0, wakeTime, wakeCycle ) );
+  EXPECT_EQ( wakeTime, std::numeric_limits< real64 >::max() );
+  EXPECT_EQ( wakeCycle, std::numeric_limits< integer >::max() );
+
+  PeriodicEvent cycleEvent( "cycleEvent", nullptr );
+  cycleEvent.getReference< integer >( PeriodicEvent::viewKeyStruct::cycleFrequencyString ) = 4;
+  cycleEvent.getReference< integer >( EventBase::viewKeyStruct::lastCycleString ) = 8;
+  EXPECT_TRUE( cycleEvent.GetNextWakeUp( 3.0, wakeTime, wakeCycle ) );
+  EXPECT_EQ( wakeTime, std::numeric_limits< real64 >::max() );
+  EXPECT_EQ( wakeCycle, 12 );
+
+  // a solo event never wakes up again once executed
+  SoloEvent soloEvent( "soloEvent", nullptr );
+  soloEvent.getReference< integer >( SoloEvent::viewKeyStruct::targetCycleString ) = 7;
+  EXPECT_TRUE( soloEvent.GetNextWakeUp( 0.0, wakeTime, wakeCycle ) );
+  EXPECT_EQ( wakeCycle, 7 );
+  soloEvent.getReference< integer >( EventBase::viewKeyStruct::lastCycleString ) = 7;
+  EXPECT_TRUE( soloEvent.GetNextWakeUp( 1.0, wakeTime, wakeCycle ) );
+  EXPECT_EQ( wakeCycle, std::numeric_limits< integer >::max() );
+
+  // events with sub-events are checked at every cycle
+  cycleEvent.RegisterGroup< PeriodicEvent >( "subEvent" );
+  EXPECT_FALSE( cycleEvent.GetNextWakeUp( 3.0, wakeTime, wakeCycle ) );
+}
+
+TEST( EventManagerTest, rankInvariantRequests )
+{
+  EventRecorderTask invariantTask( "invariantTask", nullptr );
+  RankLocalTask rankLocalTask( "rankLocalTask", nullptr );
+  PlainTarget otherTarget( "otherTarget", nullptr );
+
+  // targets opt in to skip the timestep reduction
+  EXPECT_TRUE( invariantTask.IsTimestepRequestRankInvariant() );
+  EXPECT_FALSE( rankLocalTask.IsTimestepRequestRankInvariant() );
+  EXPECT_FALSE( otherTarget.IsTimestepRequestRankInvariant() );
+}
+
+TEST( EventManagerTest, rankInvariantEvents )
+{
+  ProblemManager problemManager( "Problem", nullptr );
+  string const input =
+    "<Problem>"
+    "  <Events maxTime=\"1.0\">"
+    "    <PeriodicEvent name=\"noTarget\" forceDt=\"1.0\"/>"
+    "    <PeriodicEvent name=\"invariant\" target=\"/Tasks/invariantTask\"/>"
+    "    <PeriodicEvent name=\"parent\">"
+    "      <PeriodicEvent name=\"rankLocal\" target=\"/Tasks/rankLocalTask\"/>"
+    "    </PeriodicEvent>"
+    "  </Events>"
+    "  <Tasks>"
+    "    <EventRecorderTask name=\"invariantTask\"/>"
+    "    <RankLocalTask name=\"rankLocalTask\"/>"
+    "  </Tasks>"
+    "  <Mesh>"
+    "    <InternalMesh name=\"mesh1\" elementTypes=\"{C3D8}\" xCoords=\"{0, 1}\" yCoords=\"{0, 1}\" zCoords=\"{0, 1}\""
+    "                  nx=\"{1}\" ny=\"{1}\" nz=\"{1}\" cellBlockNames=\"{block1}\"/>"
+    "  </Mesh>"
+    "  <ElementRegions>"
+    "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+    "  </ElementRegions>"
+    "</Problem>";
+  setupProblemFromXML( problemManager, input );
+
+  EventManager * const eventManager = problemManager.GetGroup< EventManager >( problemManager.groupKeys.eventManager );
+  eventManager->forSubGroups< EventBase >( []( EventBase & event )
+  {
+    event.GetTargetReferences();
+  } );
+
+  // an event is rank-invariant if its target and all its sub-events are
+  EXPECT_TRUE( eventManager->GetGroup< EventBase >( "noTarget" )->IsTimestepRequestRankInvariant() );
+  EXPECT_TRUE( eventManager->GetGroup< EventBase >( "invariant" )->IsTimestepRequestRankInvariant() );
+  EXPECT_FALSE( eventManager->GetGroup< EventBase >( "parent" )->IsTimestepRequestRankInvariant() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
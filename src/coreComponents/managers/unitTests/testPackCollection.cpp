@@ -0,0 +1,228 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+#include "managers/initialization.hpp"
+
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/TimeHistory/PackCollection.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "mesh/NodeManager.hpp"
+
+#include <cstring>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 2}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{4}\""
+  "                  ny=\"{2}\""
+  "                  nz=\"{2}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <Geometry>"
+  "    <Box name=\"left\"  xMin=\"-0.01, -0.01, -0.01\" xMax=\"0.51, 1.01, 1.01\"/>"
+  "    <Box name=\"right\" xMin=\"1.49, -0.01, -0.01\" xMax=\"2.01, 1.01, 1.01\"/>"
+  "  </Geometry>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+constexpr auto scalarFieldName = "packCollectionTestField";
+
+void setupProblemFromXML( ProblemManager & problemManager, char const * const xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput, strlen( xmlInput ) );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition * domain = problemManager.getDomainPartition();
+  MeshManager * meshManager = problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager->GenerateMeshLevels( domain );
+
+  ElementRegionManager * elementManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager->getName().c_str() );
+  elementManager->ProcessInputFileRecursive( topLevelNode );
+  elementManager->PostProcessInputRecursive();
+
+  problemManager.ProblemSetup();
+}
+
+}
+
+class PackCollectionTest : public ::testing::Test
+{
+public:
+
+  PackCollectionTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    domain = problemManager->getDomainPartition();
+    nodeManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+    arrayView1d< real64 > const scalarField =
+      nodeManager->registerWrapper< array1d< real64 > >( scalarFieldName )->reference();
+    for( localIndex a = 0; a < nodeManager->size(); ++a )
+    {
+      scalarField[a] = 0.5 * a + 1.0;
+    }
+  }
+
+  /// Collect a field of the node manager into a buffer per collection, for the given sets (or the whole field)
+  std::vector< buffer_type > collect( string const & fieldName, string_array const & setNames )
+  {
+    PackCollection collection( "collection", nullptr );
+    collection.getReference< string >( PackCollection::viewKeysStruct::objectPath ) = MeshLevel::groupStructKeys::nodeManagerString;
+    collection.getReference< string >( PackCollection::viewKeysStruct::fieldName ) = fieldName;
+    collection.getReference< string_array >( PackCollection::viewKeysStruct::setNames ) = setNames;
+    collection.InitializePostSubGroups( problemManager.get() );
+
+    WrapperBase const * const wrapper = nodeManager->getWrapperBase( fieldName );
+    std::vector< buffer_type > buffers( collection.getCollectionCount() );
+    for( localIndex collectionIdx = 0; collectionIdx < collection.getCollectionCount(); ++collectionIdx )
+    {
+      localIndex const numObjects = setNames.empty() ? nodeManager->size() : nodeSet( setNames[collectionIdx] ).size();
+      buffers[collectionIdx].resize( numObjects * wrapper->elementByteSize() );
+      buffer_unit_type * const head = buffers[collectionIdx].data();
+      collection.registerBufferCall( collectionIdx, [head]() { return head; } );
+    }
+
+    collection.Execute( 0.0, 0.0, 0, 0, 0.0, domain );
+    return buffers;
+  }
+
+  SortedArrayView< localIndex const > const & nodeSet( string const & setName ) const
+  {
+    return nodeManager->sets().getReference< SortedArray< localIndex > >( setName );
+  }
+
+  std::unique_ptr< ProblemManager > const problemManager;
+  DomainPartition * domain;
+  NodeManager * nodeManager;
+};
+
+TEST_F( PackCollectionTest, setsMatchPackByIndex )
+{
+  string_array setNames;
+  setNames.emplace_back( "left" );
+  setNames.emplace_back( "right" );
+
+  for( string const & fieldName : { string( NodeManager::viewKeyStruct::referencePositionString ), string( scalarFieldName ) } )
+  {
+    SCOPED_TRACE( fieldName );
+    WrapperBase * const wrapper = nodeManager->getWrapperBase( fieldName );
+    std::vector< buffer_type > const buffers = collect( fieldName, setNames );
+    ASSERT_EQ( buffers.size(), setNames.size() );
+
+    for( localIndex setIdx = 0; setIdx < setNames.size(); ++setIdx )
+    {
+      SortedArrayView< localIndex const > const & set = nodeSet( setNames[setIdx] );
+      ASSERT_GT( set.size(), 0 );
+      array1d< localIndex > indices( set.size() );
+      std::copy( set.begin(), set.end(), indices.data() );
+
+      // same layout as the wrapper packing without metadata
+      buffer_type expected( buffers[setIdx].size() );
+      buffer_unit_type * expectedPtr = expected.data();
+      localIndex const expectedSize = wrapper->PackByIndex( expectedPtr, indices, false, true );
+      ASSERT_EQ( expectedSize, LvArray::integerConversion< localIndex >( buffers[setIdx].size() ) );
+      EXPECT_EQ( std::memcmp( expected.data(), buffers[setIdx].data(), expectedSize ), 0 );
+    }
+  }
+}
+
+TEST_F( PackCollectionTest, setRoundTrip )
+{
+  string_array setNames;
+  setNames.emplace_back( "right" );
+  std::vector< buffer_type > const buffers = collect( scalarFieldName, setNames );
+
+  // unpack into a cleared field and check the values of the set are restored
+  arrayView1d< real64 > const scalarField = nodeManager->getReference< array1d< real64 > >( scalarFieldName );
+  array1d< real64 > original( scalarField.size() );
+  std::copy( scalarField.data(), scalarField.data() + scalarField.size(), original.data() );
+  scalarField.setValues< serialPolicy >( -1.0 );
+
+  SortedArrayView< localIndex const > const & set = nodeSet( setNames[0] );
+  array1d< localIndex > indices( set.size() );
+  std::copy( set.begin(), set.end(), indices.data() );
+
+  buffer_unit_type const * bufferPtr = buffers[0].data();
+  nodeManager->getWrapperBase( scalarFieldName )->UnpackByIndex( bufferPtr, indices, false, true );
+  EXPECT_EQ( bufferPtr, buffers[0].data() + buffers[0].size() );
+
+  for( localIndex a = 0; a < scalarField.size(); ++a )
+  {
+    EXPECT_EQ( scalarField[a], set.contains( a ) ? original[a] : -1.0 ) << "node " << a;
+  }
+}
+
+TEST_F( PackCollectionTest, wholeFieldRoundTrip )
+{
+  std::vector< buffer_type > const buffers = collect( scalarFieldName, string_array() );
+  ASSERT_EQ( buffers.size(), 1 );
+
+  arrayView1d< real64 > const scalarField = nodeManager->getReference< array1d< real64 > >( scalarFieldName );
+  ASSERT_EQ( LvArray::integerConversion< localIndex >( buffers[0].size() ), scalarField.size() * sizeof( real64 ) );
+
+  // same layout as the wrapper packing without metadata
+  WrapperBase * const wrapper = nodeManager->getWrapperBase( scalarFieldName );
+  buffer_type expected( buffers[0].size() );
+  buffer_unit_type * expectedPtr = expected.data();
+  EXPECT_EQ( wrapper->Pack( expectedPtr, false, true ), LvArray::integerConversion< localIndex >( expected.size() ) );
+  EXPECT_EQ( std::memcmp( expected.data(), buffers[0].data(), expected.size() ), 0 );
+
+  array1d< real64 > original( scalarField.size() );
+  std::copy( scalarField.data(), scalarField.data() + scalarField.size(), original.data() );
+  scalarField.setValues< serialPolicy >( -1.0 );
+
+  buffer_unit_type const * bufferPtr = buffers[0].data();
+  wrapper->Unpack( bufferPtr, false, true );
+  for( localIndex a = 0; a < scalarField.size(); ++a )
+  {
+    EXPECT_EQ( scalarField[a], original[a] ) << "node " << a;
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
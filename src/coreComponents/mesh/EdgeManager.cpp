@@ -172,6 +172,8 @@ void createEdgesByLowestNode( ArrayOfArraysView< localIndex const > const & face
 localIndex calculateTotalNumberOfEdges( ArrayOfArraysView< EdgeBuilder const > const & edgesByLowestNode,
                                         arrayView1d< localIndex > const & uniqueEdgeOffsets )
 {
+  GEOSX_MARK_FUNCTION;
+
   localIndex const numNodes = edgesByLowestNode.size();
   GEOSX_ERROR_IF_NE( numNodes, uniqueEdgeOffsets.size() - 1 );
 
@@ -342,11 +344,11 @@ void populateMaps( ArrayOfArraysView< EdgeBuilder const > const & edgesByLowestN
   GEOSX_ERROR_IF_NE( numUniqueEdges, edgeToNodeMap.size( 0 ) );
 
   // The face to edge map has the same shape as the face to node map, so we can resize appropriately.
-  localIndex totalSize = 0;
-  for( localIndex faceID = 0; faceID < numFaces; ++faceID )
+  RAJA::ReduceSum< parallelHostReduce, localIndex > totalSize( 0 );
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const faceID )
   {
     totalSize += faceToNodeMap.sizeOfArray( faceID );
-  }
+  } );
 
   // Resize the face to edge map
   faceToEdgeMap.resize( 0 );
@@ -357,7 +359,7 @@ void populateMaps( ArrayOfArraysView< EdgeBuilder const > const & edgesByLowestN
   faceToEdgeMap.reserve( entriesToReserve );
 
   // Reserve space for the total number of face edges + extra space for existing faces + even more space for new faces.
-  localIndex const valuesToReserve = totalSize + numFaces * FaceManager::edgeMapExtraSpacePerFace() * ( 1 + 2 * overAllocationFactor );
+  localIndex const valuesToReserve = totalSize.get() + numFaces * FaceManager::edgeMapExtraSpacePerFace() * ( 1 + 2 * overAllocationFactor );
   faceToEdgeMap.reserveValues( valuesToReserve );
   for( localIndex faceID = 0; faceID < numFaces; ++faceID )
   {
@@ -431,6 +433,7 @@ void EdgeManager::BuildEdges( FaceManager * const faceManager, NodeManager * con
                 m_toNodesRelation );
 
   // make sets from nodesets
+  GEOSX_MARK_BEGIN( edgeSets );
   auto const & nodeSets = nodeManager->sets().wrappers();
   for( int i = 0; i < nodeSets.size(); ++i )
   {
@@ -447,6 +450,7 @@ void EdgeManager::BuildEdges( FaceManager * const faceManager, NodeManager * con
     SortedArrayView< localIndex const > const & targetSet = nodeManager->sets().getReference< SortedArray< localIndex > >( setName ).toViewConst();
     ConstructSetFromSetAndMap( targetSet, m_toNodesRelation, setName );
   } );
+  GEOSX_MARK_END( edgeSets );
 
   SetDomainBoundaryObjects( faceManager );
 }
@@ -555,6 +559,8 @@ void EdgeManager::BuildEdges( localIndex const numNodes,
 
 void EdgeManager::SetDomainBoundaryObjects( ObjectManagerBase const * const referenceObject )
 {
+  GEOSX_MARK_FUNCTION;
+
   referenceObject->CheckTypeID( typeid( NodeManager ) );
 
   // cast the referenceObject into a faceManager
@@ -566,12 +572,12 @@ void EdgeManager::SetDomainBoundaryObjects( ObjectManagerBase const * const refe
 
   // get the "isDomainBoundary" field from for *this, and set it to zero
   arrayView1d< integer > const & isEdgeOnDomainBoundary = this->getDomainBoundaryIndicator();
-  isEdgeOnDomainBoundary.setValues< serialPolicy >( 0 );
+  isEdgeOnDomainBoundary.setValues< parallelHostPolicy >( 0 );
 
   ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager->edgeList().toViewConst();
 
   // loop through all faces
-  for( localIndex kf=0; kf<faceManager->size(); ++kf )
+  forAll< parallelHostPolicy >( faceManager->size(), [&]( localIndex const kf )
   {
     // check to see if the face is on a domain boundary
     if( isFaceOnDomainBoundary[kf] == 1 )
@@ -584,7 +590,7 @@ void EdgeManager::SetDomainBoundaryObjects( ObjectManagerBase const * const refe
         isEdgeOnDomainBoundary( faceToEdgeMap( kf, a ) ) = 1;
       }
     }
-  }
+  } );
 }
 
 bool EdgeManager::hasNode( const localIndex edgeID, const localIndex nodeID ) const
@@ -638,7 +644,7 @@ void EdgeManager::SetIsExternal( FaceManager const * const faceManager )
 
 
 void EdgeManager::ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManagerBase const * const nodeManager,
-                                                                   std::vector< std::vector< globalIndex > > & globalEdgeNodes )
+                                                                   array2d< globalIndex > & globalEdgeNodes )
 {
   GEOSX_MARK_FUNCTION;
   nodeManager->CheckTypeID( typeid( NodeManager ) );
@@ -647,23 +653,24 @@ void EdgeManager::ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManager
 
   arrayView2d< localIndex const > const & edgeNodes = this->nodeList();
   arrayView1d< integer const > const & isDomainBoundary = this->getDomainBoundaryIndicator();
+  arrayView1d< globalIndex const > const & nodeLocalToGlobal = nodeManager->localToGlobalMap();
 
-  globalEdgeNodes.resize( numEdges );
+  globalEdgeNodes.resize( numEdges, 2 );
+  arrayView2d< globalIndex > const & globalEdgeNodesView = globalEdgeNodes.toView();
 
   forAll< parallelHostPolicy >( numEdges, [&]( localIndex const edgeID )
   {
-    std::vector< globalIndex > & curEdgeGlobalNodes = globalEdgeNodes[ edgeID ];
-
     if( isDomainBoundary( edgeID ) )
     {
-      curEdgeGlobalNodes.resize( 2 );
-
-      for( localIndex a = 0; a < 2; ++a )
-      {
-        curEdgeGlobalNodes[ a ]= nodeManager->localToGlobalMap()( edgeNodes[ edgeID ][ a ] );
-      }
-
-      std::sort( curEdgeGlobalNodes.begin(), curEdgeGlobalNodes.end() );
+      globalIndex const globalNode0 = nodeLocalToGlobal( edgeNodes[ edgeID ][ 0 ] );
+      globalIndex const globalNode1 = nodeLocalToGlobal( edgeNodes[ edgeID ][ 1 ] );
+      globalEdgeNodesView( edgeID, 0 ) = std::min( globalNode0, globalNode1 );
+      globalEdgeNodesView( edgeID, 1 ) = std::max( globalNode0, globalNode1 );
+    }
+    else
+    {
+      globalEdgeNodesView( edgeID, 0 ) = -1;
+      globalEdgeNodesView( edgeID, 1 ) = -1;
     }
   } );
 }
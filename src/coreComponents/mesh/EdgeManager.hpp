@@ -136,15 +136,16 @@ public:
 
 
   /**
-   * @brief Build \p globalEdgeNodes, a  vector containing all the global indices
-   * of each nodes of each edges
+   * @brief Build \p globalEdgeNodes, an array containing the sorted global indices
+   * of the nodes of each boundary edge
    * @param[in] nodeManager the nodeManager object.
    * @param[out] globalEdgeNodes the globalEdgesNodes array to be built
-   * [ [global_index_node_0_edge_0, global_index_node1_edge_0], [global_index_node_0_edge_1, global_index_node1_edge_1] ....]
+   * [ [global_index_node_0_edge_0, global_index_node1_edge_0], [global_index_node_0_edge_1, global_index_node1_edge_1] ....],
+   * with rows of -1 for the edges that are not on the domain boundary
    */
   virtual void
   ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManagerBase const * const nodeManager,
-                                                   std::vector< std::vector< globalIndex > > & globalEdgeNodes ) override;
+                                                   array2d< globalIndex > & globalEdgeNodes ) override;
 
   /**
    * @brief Compute the future size of a packed list.
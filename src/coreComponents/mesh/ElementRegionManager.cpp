@@ -21,6 +21,7 @@
 #include "mpiCommunications/CommunicationTools.hpp"
 #include "FaceElementRegion.hpp"
 #include "FaceManager.hpp"
+#include "NodeManager.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "CellBlockManager.hpp"
 #include "meshUtilities/MeshManager.hpp"
@@ -201,6 +202,67 @@ void ElementRegionManager::GenerateAggregates( FaceManager const * const faceMan
   } );
 }
 
+SpatialBoxIndex const & ElementRegionManager::getCellElementSpatialIndex( NodeManager const & nodeManager ) const
+{
+  localIndex numCellElements = 0;
+  forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numCellElements += subRegion.size();
+  } );
+
+  if( numCellElements == m_cellElementIndex.numBoxes() &&
+      nodeManager.size() == m_cellElementIndexNumNodes &&
+      nodeManager.referencePositionVersion() == m_cellElementIndexPositionVersion )
+  {
+    return m_cellElementIndex;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+
+  array2d< real64 > boxes( numCellElements, 6 );
+  m_cellElementIndexRegions.resize( numCellElements );
+  m_cellElementIndexSubRegions.resize( numCellElements );
+  m_cellElementIndexElements.resize( numCellElements );
+
+  localIndex offset = 0;
+  forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                             localIndex const esr,
+                                                             ElementRegionBase const &,
+                                                             CellElementSubRegion const & subRegion )
+  {
+    CellElementSubRegion::NodeMapType::ViewTypeConst const & elemToNodes = subRegion.nodeList();
+    localIndex const numNodesPerElem = subRegion.numNodesPerElement();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      localIndex const box = offset + ei;
+      for( int d = 0; d < 3; ++d )
+      {
+        boxes[box][d] = X[elemToNodes[ei][0]][d];
+        boxes[box][d + 3] = X[elemToNodes[ei][0]][d];
+      }
+      for( localIndex a = 1; a < numNodesPerElem; ++a )
+      {
+        for( int d = 0; d < 3; ++d )
+        {
+          boxes[box][d] = std::min( boxes[box][d], X[elemToNodes[ei][a]][d] );
+          boxes[box][d + 3] = std::max( boxes[box][d + 3], X[elemToNodes[ei][a]][d] );
+        }
+      }
+      m_cellElementIndexRegions[box] = er;
+      m_cellElementIndexSubRegions[box] = esr;
+      m_cellElementIndexElements[box] = ei;
+    }
+    offset += subRegion.size();
+  } );
+
+  m_cellElementIndex.build( boxes.toViewConst() );
+  m_cellElementIndexNumNodes = nodeManager.size();
+  m_cellElementIndexPositionVersion = nodeManager.referencePositionVersion();
+  return m_cellElementIndex;
+}
+
 void ElementRegionManager::GenerateWells( MeshManager * const meshManager,
                                           MeshLevel * const meshLevel )
 {
@@ -30,6 +30,7 @@
 #include "fileIO/schema/schemaUtilities.hpp"
 #include "WellElementRegion.hpp"
 #include "EmbeddedSurfaceRegion.hpp"
+#include "SpatialBoxIndex.hpp"
 
 namespace geosx
 {
@@ -141,6 +142,52 @@ public:
    */
   void GenerateAggregates( FaceManager const * const faceManager, NodeManager const * const nodeManager );
 
+  /**
+   * @brief Visit the cell elements, including ghosts, whose bounding box contains a point.
+   * @tparam POINT the type of the point coordinates
+   * @tparam LAMBDA the type of the visitor, called with the region, subregion and element indices,
+   *                and returning true to stop the search
+   * @param [in] nodeManager the node manager holding the reference positions of the element nodes
+   * @param [in] point the point
+   * @param [in] lambda the visitor
+   * @return true if the search was stopped by the visitor
+   * @note The elements are visited in (region, subregion, element) order, using a spatial index of
+   *       their bounding boxes built on first use and rebuilt when the number of elements or nodes changes,
+   *       or when the nodes are moved (see NodeManager::referencePositionModified()).
+   */
+  template< typename POINT, typename LAMBDA >
+  bool forCellElementsContaining( NodeManager const & nodeManager, POINT const & point, LAMBDA && lambda ) const
+  {
+    SpatialBoxIndex const & index = getCellElementSpatialIndex( nodeManager );
+    return index.forBoxesContaining( point, [&]( localIndex const box )
+    {
+      return lambda( m_cellElementIndexRegions[box], m_cellElementIndexSubRegions[box], m_cellElementIndexElements[box] );
+    } );
+  }
+
+  /**
+   * @brief Visit the cell elements, including ghosts, whose bounding box intersects a box.
+   * @tparam POINT the type of the coordinates
+   * @tparam LAMBDA the type of the visitor, called with the region, subregion and element indices
+   * @param [in] nodeManager the node manager holding the reference positions of the element nodes
+   * @param [in] minCoords the minimum coordinates of the box
+   * @param [in] maxCoords the maximum coordinates of the box
+   * @param [in] lambda the visitor
+   * @note The elements are visited in (region, subregion, element) order, see forCellElementsContaining().
+   */
+  template< typename POINT, typename LAMBDA >
+  void forCellElementsIntersecting( NodeManager const & nodeManager,
+                                    POINT const & minCoords,
+                                    POINT const & maxCoords,
+                                    LAMBDA && lambda ) const
+  {
+    SpatialBoxIndex const & index = getCellElementSpatialIndex( nodeManager );
+    index.forBoxesIntersecting( minCoords, maxCoords, [&]( localIndex const box )
+    {
+      lambda( m_cellElementIndexRegions[box], m_cellElementIndexSubRegions[box], m_cellElementIndexElements[box] );
+    } );
+  }
+
   /**
    * @brief Generate the wells.
    * @param [in] meshManager pointer to meshManager
@@ -1027,6 +1074,31 @@ public:
 
 private:
 
+  /**
+   * @brief Get the spatial index of the bounding boxes of the cell elements, (re)building it if needed.
+   * @param nodeManager the node manager holding the reference positions of the element nodes
+   * @return the spatial index, whose boxes are numbered in (region, subregion, element) order
+   */
+  SpatialBoxIndex const & getCellElementSpatialIndex( NodeManager const & nodeManager ) const;
+
+  /// Spatial index of the bounding boxes of the cell elements, built on demand
+  mutable SpatialBoxIndex m_cellElementIndex;
+
+  /// Region of each box of the spatial index
+  mutable array1d< localIndex > m_cellElementIndexRegions;
+
+  /// Subregion of each box of the spatial index
+  mutable array1d< localIndex > m_cellElementIndexSubRegions;
+
+  /// Element of each box of the spatial index
+  mutable array1d< localIndex > m_cellElementIndexElements;
+
+  /// Number of nodes when the spatial index was built
+  mutable localIndex m_cellElementIndexNumNodes = -1;
+
+  /// Version of the node reference position when the spatial index was built
+  mutable localIndex m_cellElementIndexPositionVersion = -1;
+
   /**
    * @brief Pack a list of wrappers or get the buffer size needed to pack.
    * @param buffer pointer to the buffer to be packed
@@ -257,6 +257,8 @@ void createFacesByLowestNode( ElementRegionManager const & elementManager,
 localIndex calculateTotalNumberOfFaces( ArrayOfArraysView< FaceBuilder const > const & facesByLowestNode,
                                         arrayView1d< localIndex > const & uniqueFaceOffsets )
 {
+  GEOSX_MARK_FUNCTION;
+
   localIndex const numNodes = facesByLowestNode.size();
   GEOSX_ERROR_IF_NE( numNodes, uniqueFaceOffsets.size() - 1 );
 
@@ -571,6 +573,7 @@ void FaceManager::BuildFaces( NodeManager * const nodeManager, ElementRegionMana
                 nodeList() );
 
   // First create the sets
+  GEOSX_MARK_BEGIN( faceSets );
   auto const & nodeSets = nodeManager->sets().wrappers();
   for( localIndex i = 0; i < nodeSets.size(); ++i )
   {
@@ -587,6 +590,7 @@ void FaceManager::BuildFaces( NodeManager * const nodeManager, ElementRegionMana
     SortedArrayView< localIndex const > const & targetSet = nodeManager->sets().getReference< SortedArray< localIndex > >( setName ).toViewConst();
     ConstructSetFromSetAndMap( targetSet, m_nodeList.toViewConst(), setName );
   } );
+  GEOSX_MARK_END( faceSets );
 
   SetDomainBoundaryObjects( nodeManager );
 
@@ -596,6 +600,8 @@ void FaceManager::BuildFaces( NodeManager * const nodeManager, ElementRegionMana
 
 void FaceManager::computeGeometry( NodeManager const * const nodeManager )
 {
+  GEOSX_MARK_FUNCTION;
+
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager->referencePosition();
 
   // loop over faces and calculate faceArea, faceNormal and faceCenter
@@ -617,10 +623,12 @@ void FaceManager::computeGeometry( NodeManager const * const nodeManager )
 
 void FaceManager::SetDomainBoundaryObjects( NodeManager * const nodeManager )
 {
+  GEOSX_MARK_FUNCTION;
+
   // Set value of domainBounaryIndicator to one if it is found to have only one elements that it
   // is connected to.
   arrayView1d< integer > const & faceDomainBoundaryIndicator = this->getDomainBoundaryIndicator();
-  faceDomainBoundaryIndicator.setValues< serialPolicy >( 0 );
+  faceDomainBoundaryIndicator.setValues< parallelHostPolicy >( 0 );
 
   arrayView2d< localIndex const > const & elemRegionList = this->elementRegionList();
 
@@ -633,7 +641,7 @@ void FaceManager::SetDomainBoundaryObjects( NodeManager * const nodeManager )
   } );
 
   arrayView1d< integer > const & nodeDomainBoundaryIndicator = nodeManager->getDomainBoundaryIndicator();
-  nodeDomainBoundaryIndicator.setValues< serialPolicy >( 0 );
+  nodeDomainBoundaryIndicator.setValues< parallelHostPolicy >( 0 );
 
   ArrayOfArraysView< localIndex const > const & faceToNodesMap = this->nodeList().toViewConst();
 
@@ -795,7 +803,7 @@ void FaceManager::SortFaceNodes( arrayView2d< real64 const, nodes::REFERENCE_POS
 
 
 void FaceManager::ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManagerBase const * const nodeManager,
-                                                                   std::vector< std::vector< globalIndex > > & globalFaceNodes )
+                                                                   array2d< globalIndex > & globalFaceNodes )
 {
   GEOSX_MARK_FUNCTION;
   nodeManager->CheckTypeID( typeid( NodeManager ) );
@@ -804,28 +812,34 @@ void FaceManager::ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManager
 
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = this->nodeList().toViewConst();
   arrayView1d< integer const > const & isDomainBoundary = this->getDomainBoundaryIndicator();
+  arrayView1d< globalIndex const > const & nodeLocalToGlobal = nodeManager->localToGlobalMap();
 
-  globalFaceNodes.resize( numFaces );
-
-  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const & faceID )
+  RAJA::ReduceMax< parallelHostReduce, localIndex > maxFaceNodes( 0 );
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const faceID )
   {
-    std::vector< globalIndex > & curFaceGlobalNodes = globalFaceNodes[ faceID ];
+    if( isDomainBoundary( faceID ) )
+    {
+      maxFaceNodes.max( faceToNodeMap.sizeOfArray( faceID ) );
+    }
+  } );
+
+  globalFaceNodes.resize( numFaces, maxFaceNodes.get() );
+  arrayView2d< globalIndex > const & globalFaceNodesView = globalFaceNodes.toView();
+  globalFaceNodesView.setValues< parallelHostPolicy >( -1 );
 
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const faceID )
+  {
     if( isDomainBoundary( faceID ) )
     {
       localIndex const numNodes = faceToNodeMap.sizeOfArray( faceID );
-      curFaceGlobalNodes.resize( numNodes );
+      globalIndex * const curFaceGlobalNodes = &globalFaceNodesView( faceID, 0 );
 
       for( localIndex a = 0; a < numNodes; ++a )
       {
-        curFaceGlobalNodes[ a ]= nodeManager->localToGlobalMap()( faceToNodeMap( faceID, a ) );
+        curFaceGlobalNodes[ a ] = nodeLocalToGlobal( faceToNodeMap( faceID, a ) );
       }
 
-      std::sort( curFaceGlobalNodes.begin(), curFaceGlobalNodes.end() );
-    }
-    else
-    {
-      curFaceGlobalNodes.resize( 0 );
+      std::sort( curFaceGlobalNodes, curFaceGlobalNodes + numNodes );
     }
   } );
 }
@@ -258,10 +258,11 @@ public:
   /**
    * @brief Extract a face-to-nodes map with global indexed for boundary faces.
    * @param[in] nodeManager mesh nodeManager
-   * @param[out] faceToNodes face-to-node map
+   * @param[out] faceToNodes face-to-node map, with the sorted global node indices of each boundary face
+   *             padded with -1 up to the largest number of nodes of a boundary face, and only -1 for other faces
    */
   virtual void ExtractMapFromObjectForAssignGlobalIndexNumbers( ObjectManagerBase const * const nodeManager,
-                                                                std::vector< std::vector< globalIndex > > & faceToNodes ) override;
+                                                                array2d< globalIndex > & faceToNodes ) override;
 
   /**
    * @name viewKeyStruct/groupKeyStruct
@@ -34,7 +34,8 @@ MeshLevel::MeshLevel( string const & name,
   m_edgeManager( groupStructKeys::edgeManagerString, this ),
   m_faceManager( groupStructKeys::faceManagerString, this ),
   m_elementManager( groupStructKeys::elemManagerString, this ),
-  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this )
+  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this ),
+  m_ghostingVersion( 0 )
 
 {
 
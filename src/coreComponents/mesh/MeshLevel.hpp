@@ -155,6 +155,18 @@ public:
 
   ///@}
 
+  /**
+   * @brief Get the version of the ghost lists, incremented collectively whenever they are (re)built.
+   * @return the ghosting version
+   */
+  localIndex ghostingVersion() const { return m_ghostingVersion; }
+
+  /**
+   * @brief Record that the ghost lists of the mesh objects have been modified.
+   * @note Must be called collectively, objects keyed on the ghosting version may exchange data with neighbors when it changes.
+   */
+  void ghostingModified() { ++m_ghostingVersion; }
+
 private:
 
   /// Manager for node data
@@ -167,6 +179,8 @@ private:
   ElementRegionManager m_elementManager;
   /// Manager for embedded surfaces edge data
   EdgeManager m_embSurfEdgeManager;
+  /// Version of the ghost lists
+  localIndex m_ghostingVersion;
 
 };
 
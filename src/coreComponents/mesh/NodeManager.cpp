@@ -24,6 +24,8 @@
 #include "common/TimingMacros.hpp"
 #include "ElementRegionManager.hpp"
 
+#include <tuple>
+
 namespace geosx
 {
 
@@ -38,6 +40,7 @@ NodeManager::NodeManager( std::string const & name,
                           Group * const parent ):
   ObjectManagerBase( name, parent ),
   m_referencePosition( 0, 3 ),
+  m_referencePositionVersion( 0 ),
   m_embeddedSurfNodesPosition( 0, 3 )
 {
   registerWrapper( viewKeyStruct::referencePositionString, &m_referencePosition );
@@ -219,35 +222,70 @@ void NodeManager::SetElementMaps( ElementRegionManager const * const elementRegi
   // Append an array for each node with capacity to hold the appropriate number of elements plus some wiggle room.
   for( localIndex nodeID = 0; nodeID < numNodes; ++nodeID )
   {
-    toElementRegionList.appendArray( 0 );
-    toElementSubRegionList.appendArray( 0 );
-    toElementList.appendArray( 0 );
+    toElementRegionList.appendArray( elemsPerNode[ nodeID ] );
+    toElementSubRegionList.appendArray( elemsPerNode[ nodeID ] );
+    toElementList.appendArray( elemsPerNode[ nodeID ] );
 
     toElementRegionList.setCapacityOfArray( nodeID, elemsPerNode[ nodeID ] + getElemMapOverAllocation() );
     toElementSubRegionList.setCapacityOfArray( nodeID, elemsPerNode[ nodeID ] + getElemMapOverAllocation() );
     toElementList.setCapacityOfArray( nodeID, elemsPerNode[ nodeID ] + getElemMapOverAllocation() );
   }
 
-  // Populate the element maps.
-  // Note that this can't be done in parallel because the three element lists must be in the same order.
-  // If this becomes a bottleneck create a temporary ArrayOfArrays of tuples and insert into that first then copy over.
-  elementRegionManager->
-    forElementSubRegionsComplete< CellElementSubRegion >( [&toElementRegionList, &toElementSubRegionList, &toElementList]
-                                                            ( localIndex const er, localIndex const esr, ElementRegionBase const &,
-                                                            CellElementSubRegion const & subRegion )
+  ArrayOfArraysView< localIndex > const & toElementRegionView = toElementRegionList.toView();
+  ArrayOfArraysView< localIndex > const & toElementSubRegionView = toElementSubRegionList.toView();
+  ArrayOfArraysView< localIndex > const & toElementView = toElementList.toView();
+
+  // Populate the element maps. The three element lists are filled in the same slots,
+  // which are claimed atomically and then sorted to give the same order as a serial fill.
   {
-    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodeMap = subRegion.nodeList();
-    for( localIndex k = 0; k < subRegion.size(); ++k )
+    GEOSX_MARK_SCOPE( fillElementMaps );
+
+    array1d< localIndex > nodeFill( numNodes );
+    elementRegionManager->
+      forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er, localIndex const esr, ElementRegionBase const &,
+                                                                 CellElementSubRegion const & subRegion )
     {
-      for( localIndex a=0; a<subRegion.numIndependentNodesPerElement(); ++a )
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodeMap = subRegion.nodeList();
+      localIndex const numIndependentNodes = subRegion.numIndependentNodesPerElement();
+      forAll< parallelHostPolicy >( subRegion.size(), [&]( localIndex const k )
       {
-        localIndex const nodeIndex = elemToNodeMap( k, a );
-        toElementRegionList.emplaceBack( nodeIndex, er );
-        toElementSubRegionList.emplaceBack( nodeIndex, esr );
-        toElementList.emplaceBack( nodeIndex, k );
+        for( localIndex a = 0; a < numIndependentNodes; ++a )
+        {
+          localIndex const nodeIndex = elemToNodeMap( k, a );
+          localIndex const pos = RAJA::atomicInc< parallelHostAtomic >( &nodeFill[ nodeIndex ] );
+          toElementRegionView( nodeIndex, pos ) = er;
+          toElementSubRegionView( nodeIndex, pos ) = esr;
+          toElementView( nodeIndex, pos ) = k;
+        }
+      } );
+    } );
+
+    // Insertion sort by (region, subregion, element), the number of elements of a node being small.
+    forAll< parallelHostPolicy >( numNodes, [&]( localIndex const nodeID )
+    {
+      localIndex * const regions = toElementRegionView[ nodeID ];
+      localIndex * const subRegions = toElementSubRegionView[ nodeID ];
+      localIndex * const elems = toElementView[ nodeID ];
+      localIndex const numNodeElems = toElementView.sizeOfArray( nodeID );
+      for( localIndex i = 1; i < numNodeElems; ++i )
+      {
+        localIndex const er = regions[i];
+        localIndex const esr = subRegions[i];
+        localIndex const k = elems[i];
+        localIndex j = i;
+        while( j > 0 && std::make_tuple( er, esr, k ) < std::make_tuple( regions[j - 1], subRegions[j - 1], elems[j - 1] ) )
+        {
+          regions[j] = regions[j - 1];
+          subRegions[j] = subRegions[j - 1];
+          elems[j] = elems[j - 1];
+          --j;
+        }
+        regions[j] = er;
+        subRegions[j] = esr;
+        elems[j] = k;
       }
-    }
-  } );
+    } );
+  }
 
   this->m_toElements.setElementRegionManager( elementRegionManager );
 }
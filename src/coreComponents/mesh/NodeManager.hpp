@@ -416,6 +416,19 @@ public:
   { return m_referencePosition; }
   //END_SPHINX_REFPOS_ACCESS
 
+  /**
+   * @brief Get the version of the reference position, incremented whenever the nodes are moved.
+   * @return the reference position version
+   */
+  localIndex referencePositionVersion() const { return m_referencePositionVersion; }
+
+  /**
+   * @brief Record that the reference position of existing nodes has been modified.
+   * @note Must be called by any code writing the reference position after the mesh generation,
+   *       objects keyed on the reference position version (e.g. spatial indices) are rebuilt when it changes.
+   */
+  void referencePositionModified() { ++m_referencePositionVersion; }
+
   /**
    * @brief Return the reference position array  of the nodes of the embedded surfaces.
    * @return the location of the nodes of the embedded surfaces
@@ -533,6 +546,9 @@ private:
   array2d< real64, nodes::REFERENCE_POSITION_PERM > m_referencePosition;
   //END_SPHINX_REFPOS
 
+  /// version of the reference position of the nodes
+  localIndex m_referencePositionVersion;
+
   /// reference position of the nodes defining the embedded surfaces
   array2d< real64, nodes::REFERENCE_POSITION_PERM > m_embeddedSurfNodesPosition;
 
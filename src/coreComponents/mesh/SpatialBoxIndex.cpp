@@ -0,0 +1,126 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SpatialBoxIndex.cpp
+ */
+
+#include "SpatialBoxIndex.hpp"
+
+#include "common/TimingMacros.hpp"
+
+#include <cmath>
+
+namespace geosx
+{
+
+void SpatialBoxIndex::build( arrayView2d< real64 const > const & boxes )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numBoxes = boxes.size( 0 );
+  m_boxes.resize( numBoxes, 6 );
+  for( localIndex b = 0; b < numBoxes; ++b )
+  {
+    for( int c = 0; c < 6; ++c )
+    {
+      m_boxes[b][c] = boxes[b][c];
+    }
+  }
+
+  // bounds of the grid and average extent of the boxes
+  real64 upper[3];
+  real64 averageExtent[3];
+  for( int d = 0; d < 3; ++d )
+  {
+    m_origin[d] = numBoxes > 0 ? boxes[0][d] : 0.0;
+    upper[d] = numBoxes > 0 ? boxes[0][d + 3] : 0.0;
+    averageExtent[d] = 0.0;
+  }
+  for( localIndex b = 0; b < numBoxes; ++b )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      m_origin[d] = std::min( m_origin[d], boxes[b][d] );
+      upper[d] = std::max( upper[d], boxes[b][d + 3] );
+      averageExtent[d] += boxes[b][d + 3] - boxes[b][d];
+    }
+  }
+
+  // bins of the size of an average box, or of an average spacing for points
+  real64 numBinsTotal = 1.0;
+  for( int d = 0; d < 3; ++d )
+  {
+    real64 const extent = upper[d] - m_origin[d];
+    averageExtent[d] = numBoxes > 0 ? averageExtent[d] / numBoxes : 0.0;
+    m_binSize[d] = averageExtent[d] > 0.0 ? averageExtent[d] : extent / std::cbrt( static_cast< real64 >( numBoxes ) );
+    m_binSize[d] = m_binSize[d] > 0.0 ? m_binSize[d] : 1.0;
+    numBinsTotal *= std::ceil( extent / m_binSize[d] ) + 1.0;
+  }
+
+  // limit the memory used by empty bins for very heterogeneous box sizes
+  real64 const maxNumBins = 4.0 * numBoxes + 1.0;
+  real64 const scaling = numBinsTotal > maxNumBins ? std::cbrt( numBinsTotal / maxNumBins ) : 1.0;
+  for( int d = 0; d < 3; ++d )
+  {
+    m_binSize[d] *= scaling;
+    m_numBins[d] = std::max( localIndex( 1 ), static_cast< localIndex >( std::ceil( ( upper[d] - m_origin[d] ) / m_binSize[d] ) ) );
+  }
+
+  // count then fill the boxes of each bin, so that they are sorted in each bin
+  localIndex const numBins = m_numBins[0] * m_numBins[1] * m_numBins[2];
+  m_binOffsets.resize( numBins + 1 );
+  m_binOffsets.setValues< serialPolicy >( 0 );
+
+  auto forBinsOfBox = [&]( localIndex const b, auto && visit )
+  {
+    localIndex lower[3], higher[3];
+    for( int d = 0; d < 3; ++d )
+    {
+      lower[d] = binIndex( d, m_boxes[b][d] );
+      higher[d] = binIndex( d, m_boxes[b][d + 3] );
+    }
+    for( localIndex k = lower[2]; k <= higher[2]; ++k )
+    {
+      for( localIndex j = lower[1]; j <= higher[1]; ++j )
+      {
+        for( localIndex i = lower[0]; i <= higher[0]; ++i )
+        {
+          visit( ( k * m_numBins[1] + j ) * m_numBins[0] + i );
+        }
+      }
+    }
+  };
+
+  for( localIndex b = 0; b < numBoxes; ++b )
+  {
+    forBinsOfBox( b, [&]( localIndex const bin ) { ++m_binOffsets[bin + 1]; } );
+  }
+  for( localIndex bin = 0; bin < numBins; ++bin )
+  {
+    m_binOffsets[bin + 1] += m_binOffsets[bin];
+  }
+
+  m_binBoxes.resize( m_binOffsets[numBins] );
+  array1d< localIndex > binFill( numBins );
+  for( localIndex b = 0; b < numBoxes; ++b )
+  {
+    forBinsOfBox( b, [&]( localIndex const bin )
+    {
+      m_binBoxes[m_binOffsets[bin] + binFill[bin]++] = b;
+    } );
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,183 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SpatialBoxIndex.hpp
+ */
+
+#ifndef GEOSX_MESH_SPATIALBOXINDEX_HPP_
+#define GEOSX_MESH_SPATIALBOXINDEX_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class SpatialBoxIndex
+ * @brief A uniform grid over a set of axis-aligned boxes, to find the boxes containing a point
+ *        or intersecting a box without visiting all of them.
+ *
+ * Each box is registered in all the bins of the grid it overlaps. The bin size is the average
+ * extent of the boxes, bounded so that the number of bins remains proportional to the number of boxes.
+ * Points can be indexed as boxes of zero extent.
+ */
+class SpatialBoxIndex
+{
+public:
+
+  /**
+   * @brief Build the index.
+   * @param boxes the boxes, each row holding the minimum then the maximum coordinates of a box
+   */
+  void build( arrayView2d< real64 const > const & boxes );
+
+  /**
+   * @brief @return the number of indexed boxes.
+   */
+  localIndex numBoxes() const
+  { return m_boxes.size( 0 ); }
+
+  /**
+   * @brief Visit the boxes containing a point, in increasing box index order.
+   * @tparam POINT the type of the point coordinates
+   * @tparam LAMBDA the type of the visitor, callable with a box index and returning true to stop the search
+   * @param point the point
+   * @param lambda the visitor
+   * @return true if the search was stopped by the visitor
+   */
+  template< typename POINT, typename LAMBDA >
+  bool forBoxesContaining( POINT const & point, LAMBDA && lambda ) const;
+
+  /**
+   * @brief Visit the boxes intersecting a box, in increasing box index order.
+   * @tparam POINT the type of the coordinates
+   * @tparam LAMBDA the type of the visitor, callable with a box index
+   * @param minCoords the minimum coordinates of the box
+   * @param maxCoords the maximum coordinates of the box
+   * @param lambda the visitor
+   */
+  template< typename POINT, typename LAMBDA >
+  void forBoxesIntersecting( POINT const & minCoords, POINT const & maxCoords, LAMBDA && lambda ) const;
+
+private:
+
+  /**
+   * @brief Compute the bin of a coordinate along a dimension, clamped to the grid.
+   * @param dim the dimension
+   * @param coord the coordinate
+   * @return the bin index along the dimension
+   */
+  localIndex binIndex( int const dim, real64 const coord ) const
+  {
+    localIndex const i = static_cast< localIndex >( ( coord - m_origin[dim] ) / m_binSize[dim] );
+    return std::min( std::max( i, localIndex( 0 ) ), m_numBins[dim] - 1 );
+  }
+
+  /// The boxes
+  array2d< real64 > m_boxes;
+
+  /// The minimum coordinates of the grid
+  real64 m_origin[3] = { 0.0, 0.0, 0.0 };
+
+  /// The size of the bins along each dimension
+  real64 m_binSize[3] = { 1.0, 1.0, 1.0 };
+
+  /// The number of bins along each dimension
+  localIndex m_numBins[3] = { 1, 1, 1 };
+
+  /// The offsets of the boxes of each bin in m_binBoxes
+  array1d< localIndex > m_binOffsets;
+
+  /// The boxes overlapping each bin, in increasing order
+  array1d< localIndex > m_binBoxes;
+};
+
+template< typename POINT, typename LAMBDA >
+bool SpatialBoxIndex::forBoxesContaining( POINT const & point, LAMBDA && lambda ) const
+{
+  if( numBoxes() == 0 )
+  {
+    return false;
+  }
+
+  localIndex const bin = ( binIndex( 2, point[2] ) * m_numBins[1] + binIndex( 1, point[1] ) ) * m_numBins[0] + binIndex( 0, point[0] );
+  for( localIndex k = m_binOffsets[bin]; k < m_binOffsets[bin + 1]; ++k )
+  {
+    localIndex const box = m_binBoxes[k];
+    if( m_boxes[box][0] <= point[0] && point[0] <= m_boxes[box][3] &&
+        m_boxes[box][1] <= point[1] && point[1] <= m_boxes[box][4] &&
+        m_boxes[box][2] <= point[2] && point[2] <= m_boxes[box][5] )
+    {
+      if( lambda( box ) )
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+template< typename POINT, typename LAMBDA >
+void SpatialBoxIndex::forBoxesIntersecting( POINT const & minCoords, POINT const & maxCoords, LAMBDA && lambda ) const
+{
+  if( numBoxes() == 0 )
+  {
+    return;
+  }
+
+  localIndex lower[3], upper[3];
+  for( int d = 0; d < 3; ++d )
+  {
+    lower[d] = binIndex( d, minCoords[d] );
+    upper[d] = binIndex( d, maxCoords[d] );
+  }
+
+  // a box overlapping several bins is found once per bin
+  std::vector< localIndex > candidates;
+  for( localIndex k = lower[2]; k <= upper[2]; ++k )
+  {
+    for( localIndex j = lower[1]; j <= upper[1]; ++j )
+    {
+      for( localIndex i = lower[0]; i <= upper[0]; ++i )
+      {
+        localIndex const bin = ( k * m_numBins[1] + j ) * m_numBins[0] + i;
+        for( localIndex b = m_binOffsets[bin]; b < m_binOffsets[bin + 1]; ++b )
+        {
+          localIndex const box = m_binBoxes[b];
+          if( m_boxes[box][0] <= maxCoords[0] && minCoords[0] <= m_boxes[box][3] &&
+              m_boxes[box][1] <= maxCoords[1] && minCoords[1] <= m_boxes[box][4] &&
+              m_boxes[box][2] <= maxCoords[2] && minCoords[2] <= m_boxes[box][5] )
+          {
+            candidates.push_back( box );
+          }
+        }
+      }
+    }
+  }
+  std::sort( candidates.begin(), candidates.end() );
+  candidates.erase( std::unique( candidates.begin(), candidates.end() ), candidates.end() );
+
+  for( localIndex const box : candidates )
+  {
+    lambda( box );
+  }
+}
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESH_SPATIALBOXINDEX_HPP_ */
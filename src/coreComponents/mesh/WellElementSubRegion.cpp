@@ -16,7 +16,6 @@
 
 #include "mesh/MeshLevel.hpp"
 #include "mesh/NodeManager.hpp"
-#include "mesh/MeshForLoopInterface.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 #include "LvArray/src/output.hpp"
 
@@ -29,8 +28,7 @@ WellElementSubRegion::WellElementSubRegion( string const & name, Group * const p
   m_toNodesRelation(),
   m_topWellElementIndex( -1 ),
   m_perforationData( groupKeyStruct::perforationDataString, this ),
-  m_topRank( -1 ),
-  m_searchDepth( 10 )
+  m_topRank( -1 )
 {
 
   registerWrapper( viewKeyStruct::wellControlsString, &m_wellControlsName );
@@ -145,214 +143,42 @@ bool IsPointInsideElement( NodeManager const * const nodeManager,
 }
 
 /**
- * @brief Collect the nodes of reservoir element ei
- * @param[in] subRegion the subRegion of reservoir element ei
- * @param[in] ei the index of the reservoir element
- * @param[inout] nodes the nodes that have already been visited
- */
-void CollectElementNodes( CellBlock const *         subRegion,
-                          localIndex ei,
-                          SortedArray< localIndex > & nodes )
-{
-  // get all the nodes belonging to this element
-  for( localIndex a = 0; a < subRegion->numNodesPerElement(); ++a )
-  {
-    localIndex const inode = subRegion->nodeList( ei, a );
-
-    // if not already visited, store the newly found node
-    if( !nodes.contains( inode ))
-    {
-      nodes.insert( inode );
-    }
-  }
-}
-
-/**
- * @brief Search the reservoir elements that can be accessed from the set "nodes".
-          Stop if a reservoir element containing the perforation is found.
-          If not, enlarge the set "nodes"
+ * @brief Search for the reservoir element that contains "location".
+          The candidates are the reservoir elements whose bounding box contains "location",
+          found with the spatial index of the element region manager.
  * @param[in] meshLevel the mesh object (single level only)
  * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[inout] nodes the nodes that have already been visited
- * @param[inout] elements the reservoir elements that have already been visited
  * @param[inout] erMatched the region index of the reservoir element that contains "location", if any
  * @param[inout] esrMatched the subregion index of the reservoir element that contains "location", if any
  * @param[inout] eiMatched the element index of the reservoir element that contains "location", if any
+ * @return true if a reservoir element containing "location" was found, false otherwise
  */
-bool VisitNeighborElements( MeshLevel const & mesh,
-                            R1Tensor const & location,
-                            SortedArray< localIndex > & nodes,
-                            SortedArray< globalIndex > & elements,
-                            localIndex & erMatched,
-                            localIndex & esrMatched,
-                            localIndex & eiMatched )
+bool SearchContainingElement( MeshLevel const & mesh,
+                              R1Tensor const & location,
+                              localIndex & erMatched,
+                              localIndex & esrMatched,
+                              localIndex & eiMatched )
 {
   ElementRegionManager const * const elemManager = mesh.getElemManager();
   NodeManager const * const nodeManager          = mesh.getNodeManager();
 
-  ArrayOfArraysView< localIndex const > const & toElementRegionList    = nodeManager->elementRegionList();
-  ArrayOfArraysView< localIndex const > const & toElementSubRegionList = nodeManager->elementSubRegionList();
-  ArrayOfArraysView< localIndex const > const & toElementList          = nodeManager->elementList();
-
-  bool matched = false;
-
-  // In this function, we loop over all the nodes that we have collected so far.
-  // For each node, we grab all the reservoir elements that contain the node
-  //     For reservoir element that has not been visited yet, we check if it contains "location"
-  //           If the reservoir element contains "location" we can stop the search
-  //           If the reservoir element does not contain "location", we collect its nodes
-
-  // we will enlarge the set of nodes in the loop below
-  // to do this we have to create a new set, "currNodes"
-  // that contains only the nodes that have already been visited
-  // the newly added nodes will be added to "nodes"
-  SortedArray< localIndex > currNodes = nodes;
-
-  // for all the nodes already visited
-  for( localIndex currNode : currNodes )
+  return elemManager->forCellElementsContaining( *nodeManager, location, [&]( localIndex const er,
+                                                                              localIndex const esr,
+                                                                              localIndex const ei ) -> bool
   {
-    // collect the elements that have not been visited yet
-    for( localIndex b=0; b<toElementRegionList.sizeOfArray( currNode ); ++b )
-    {
-      localIndex const er      = toElementRegionList[currNode][b];
-      localIndex const esr     = toElementSubRegionList[currNode][b];
-      localIndex const eiLocal = toElementList[currNode][b];
-
-      CellElementRegion const * const region    = dataRepository::Group::group_cast< CellElementRegion const * >( elemManager->GetRegion( er ));
-      CellBlock const * const subRegion = dataRepository::Group::group_cast< CellElementSubRegion const * >( region->GetSubRegion( esr ));
-      globalIndex const eiGlobal  = subRegion->localToGlobalMap()[eiLocal];
-
-      // if this element has not been visited yet, save it
-      if( !elements.contains( eiGlobal ))
-      {
-        elements.insert( eiGlobal );
+    CellElementRegion const * const region = dataRepository::Group::group_cast< CellElementRegion const * >( elemManager->GetRegion( er ));
+    CellBlock const * const subRegion      = dataRepository::Group::group_cast< CellBlock const * >( region->GetSubRegion( esr ));
 
-        // perform the test to see if the point is in this reservoir element
-        // if the point is in the resevoir element, save the indices and stop the search
-        if( IsPointInsideElement( nodeManager, location, subRegion, eiLocal ))
-        {
-          erMatched  = er;
-          esrMatched = esr;
-          eiMatched  = eiLocal;
-          matched    = true;
-          break;
-        }
-        // otherwise add the nodes of this element to the set of new nodes to visit
-        else
-        {
-          CollectElementNodes( subRegion, eiLocal, nodes );
-        }
-      }
-    }
-
-    if( matched )
+    // if the point is in the resevoir element, save the indices and stop the search
+    if( IsPointInsideElement( nodeManager, location, subRegion, ei ))
     {
-      break;
+      erMatched  = er;
+      esrMatched = esr;
+      eiMatched  = ei;
+      return true;
     }
-  }
-
-  // if not matched, insert the new nodes
-  return matched;
-}
-
-/**
- * @brief Search for the reservoir element that is the *closest* from the center of well element.
-          Note that this reservoir element does not necessarily contain the center of the well element.
-          This "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-          contains the well element.
- * @param[in] meshLevel the mesh object (single level only)
- * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[inout] erInit the region index of the reservoir element from which we start the search
- * @param[inout] esrInit the subregion index of the reservoir element from which we start the search
- * @param[inout] eiInit the element index of the reservoir element from which we start the search
- */
-void InitializeLocalSearch( MeshLevel const & mesh,
-                            R1Tensor const & location,
-                            localIndex & erInit,
-                            localIndex & esrInit,
-                            localIndex & eiInit )
-{
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > >
-  resElemCenter = mesh.getElemManager()->ConstructViewAccessor< array2d< real64 >,
-                                                                arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString );
-  // to initialize the local search for the reservoir element that contains "location",
-  // we find the reservoir element that minimizes the distance from "location" to the reservoir element center
-  auto ret = minLocOverElemsInMesh( &mesh, [&] ( localIndex const er,
-                                                 localIndex const esr,
-                                                 localIndex const ei ) -> real64
-  {
-    R1Tensor v = location;
-    v -= resElemCenter[er][esr][ei];
-    return v.L2_Norm();
+    return false;
   } );
-
-  // save the region, subregion and index of the reservoir element
-  // note that this reservoir element does not necessarily contains "location"
-  erInit  = std::get< 0 >( ret.second );
-  esrInit = std::get< 1 >( ret.second );
-  eiInit  = std::get< 2 >( ret.second );
-}
-
-/**
- * @brief Search for the reservoir element that contains the well element.
-          To do that, loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
- * @param[in] meshLevel the mesh object (single level only)
- * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[in] erInit the region index of the reservoir element from which we start the search
- * @param[in] esrInit the subregion index of the reservoir element from which we start the search
- * @param[in] eiInit the element index of the reservoir element from which we start the search
- * @param[inout] erMatched the region index of the reservoir element that contains "location", if any
- * @param[inout] esrMatched the subregion index of the reservoir element that contains "location", if any
- * @param[inout] eiMatched the element index of the reservoir element that contains "location", if any
- */
-bool SearchLocalElements( MeshLevel const & mesh,
-                          R1Tensor const & location,
-                          localIndex const & searchDepth,
-                          localIndex const & erInit,
-                          localIndex const & esrInit,
-                          localIndex const & eiInit,
-                          localIndex & erMatched,
-                          localIndex & esrMatched,
-                          localIndex & eiMatched )
-{
-  // search locally, starting from the location of the previous perforation
-  // the assumption here is that perforations have been entered in order of depth
-  bool resElemFound = false;
-
-  CellElementRegion const * region = dataRepository::Group::group_cast< CellElementRegion const * >( mesh.getElemManager()->GetRegion( erInit ));
-  CellBlock const * subRegion      = dataRepository::Group::group_cast< CellBlock const * >( region->GetSubRegion( esrInit ));
-
-  SortedArray< localIndex >  nodes;
-  SortedArray< globalIndex > elements;
-
-  // here is how the search is done:
-  //   1 - We check if "location" is within the "init" reservoir element defined by (erInit,esrMatched,eiMatched)
-  //   2 - If yes, stop
-  //     - If not, a) collect the nodes of the reservoir element defined by (erInit,esrMatched,eiMatched)
-  //               b) use these nodes to grab the neighbors of (erInit,esrMatched,eiMatched)
-  //               c) check if "location" is within the neighbors. If not, grab the neighbors of the neighbors, and so
-  // on...
-
-  // collect the nodes of the current element
-  // they will be used to access the neighbors and check if they contain the perforation
-  CollectElementNodes( subRegion, eiInit, nodes );
-
-  // if no match is found, enlarge the neighborhood m_searchDepth'th times
-  for( localIndex d = 0; d < searchDepth; ++d )
-  {
-    localIndex nNodes = nodes.size();
-
-    // search the reservoir elements that can be accessed from the set "nodes"
-    // stop if a reservoir element containing the perforation is found
-    // if not, enlarge the set "nodes"
-    resElemFound = VisitNeighborElements( mesh, location, nodes, elements,
-                                          erMatched, esrMatched, eiMatched );
-    if( resElemFound || nNodes == nodes.size())
-    {
-      break;
-    }
-  }
-  return resElemFound;
 }
 
 }
@@ -476,24 +302,9 @@ void WellElementSubRegion::AssignUnownedElementsInReservoir( MeshLevel & mesh,
     localIndex esrMatched = -1;
     localIndex eiMatched  = -1;
 
-    // this will contain the indices of the reservoir element
-    // from which we are going to start the search
-    localIndex erInit     = -1;
-    localIndex esrInit    = -1;
-    localIndex eiInit     = -1;
-
-    // Step 1: first, we search for the reservoir element that is the *closest* from the center of well element
-    //         note that this reservoir element does not necessarily contain the center of the well element
-    //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-    //         contains the well element
-    InitializeLocalSearch( mesh, location,
-                           erInit, esrInit, eiInit );
-
-    // Step 2: then, search for the reservoir element that contains the well element
-    //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
-    bool resElemFound = SearchLocalElements( mesh, location, m_searchDepth,
-                                             erInit, esrInit, eiInit,
-                                             erMatched, esrMatched, eiMatched );
+    // search for the reservoir element that contains the well element
+    bool resElemFound = SearchContainingElement( mesh, location,
+                                                 erMatched, esrMatched, eiMatched );
 
     // if the element was found
     if( resElemFound )
@@ -788,35 +599,9 @@ void WellElementSubRegion::ConnectPerforationsToMeshElements( MeshLevel & mesh,
     localIndex esrMatched = -1;
     localIndex eiMatched  = -1;
 
-    localIndex erInit     = -1;
-    localIndex esrInit    = -1;
-    localIndex eiInit     = -1;
-
     // for each perforation, we have to find the reservoir element that contains the perforation
-
-    if( iperfLocal > 0 )
-    {
-      // get the info of the element matched with the previous perforation
-      // this will be used next to search around this reservoir element
-      erInit  = m_perforationData.GetMeshElements().m_toElementRegion[iperfLocal-1];
-      esrInit = m_perforationData.GetMeshElements().m_toElementSubRegion[iperfLocal-1];
-      eiInit  = m_perforationData.GetMeshElements().m_toElementIndex[iperfLocal-1];
-    }
-    else
-    {
-      // Step 1: first, we search for the reservoir element that is the *closest* from the center of well element
-      //         note that this reservoir element does not necessarily contain the center of the well element
-      //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-      //         contains the well element
-      InitializeLocalSearch( mesh, location,
-                             erInit, esrInit, eiInit );
-    }
-
-    // Step 2: then, search for the reservoir element that contains the well element
-    //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
-    bool resElemFound = SearchLocalElements( mesh, location, m_searchDepth,
-                                             erInit, esrInit, eiInit,
-                                             erMatched, esrMatched, eiMatched );
+    bool resElemFound = SearchContainingElement( mesh, location,
+                                                 erMatched, esrMatched, eiMatched );
 
     // if the element was found
     if( resElemFound )
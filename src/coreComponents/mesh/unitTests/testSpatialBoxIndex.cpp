@@ -0,0 +1,235 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "mesh/SpatialBoxIndex.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 4}\""
+  "                  yCoords=\"{0, 2}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{4}\""
+  "                  ny=\"{2}\""
+  "                  nz=\"{1}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+void setupProblemFromXML( ProblemManager & problemManager, char const * const xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput, strlen( xmlInput ) );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition * domain = problemManager.getDomainPartition();
+  MeshManager * meshManager = problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager->GenerateMeshLevels( domain );
+
+  ElementRegionManager * elementManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager->getName().c_str() );
+  elementManager->ProcessInputFileRecursive( topLevelNode );
+  elementManager->PostProcessInputRecursive();
+
+  problemManager.ProblemSetup();
+}
+
+/**
+ * @brief Get the global indices of the cell elements whose bounding box contains a point.
+ */
+std::vector< globalIndex > findCellElements( ElementRegionManager const & elemManager,
+                                             NodeManager const & nodeManager,
+                                             real64 const ( &point )[3] )
+{
+  std::vector< globalIndex > found;
+  elemManager.forCellElementsContaining( nodeManager, point, [&]( localIndex const er,
+                                                                  localIndex const esr,
+                                                                  localIndex const ei )
+  {
+    ElementSubRegionBase const * const subRegion = elemManager.GetRegion( er )->GetSubRegion( esr );
+    found.push_back( subRegion->localToGlobalMap()[ei] );
+    return false;
+  } );
+  return found;
+}
+
+/**
+ * @brief Build the boxes of a regular grid of unit cells, plus one large box covering all of them.
+ */
+array2d< real64 > makeGridBoxes( localIndex const n )
+{
+  array2d< real64 > boxes( n * n * n + 1, 6 );
+  for( localIndex k = 0; k < n; ++k )
+  {
+    for( localIndex j = 0; j < n; ++j )
+    {
+      for( localIndex i = 0; i < n; ++i )
+      {
+        localIndex const b = ( k * n + j ) * n + i;
+        boxes[b][0] = i; boxes[b][1] = j; boxes[b][2] = k;
+        boxes[b][3] = i + 1; boxes[b][4] = j + 1; boxes[b][5] = k + 1;
+      }
+    }
+  }
+  localIndex const last = n * n * n;
+  for( int d = 0; d < 3; ++d )
+  {
+    boxes[last][d] = -0.5;
+    boxes[last][d + 3] = n + 0.5;
+  }
+  return boxes;
+}
+
+}
+
+TEST( testSpatialBoxIndex, containing )
+{
+  localIndex const n = 5;
+  array2d< real64 > const boxes = makeGridBoxes( n );
+
+  SpatialBoxIndex index;
+  index.build( boxes.toViewConst() );
+  ASSERT_EQ( index.numBoxes(), n * n * n + 1 );
+
+  real64 const point[3] = { 2.5, 1.5, 3.5 };
+  std::vector< localIndex > found;
+  EXPECT_FALSE( index.forBoxesContaining( point, [&]( localIndex const b )
+  {
+    found.push_back( b );
+    return false;
+  } ) );
+  ASSERT_EQ( found.size(), 2u );
+  EXPECT_EQ( found[0], ( 3 * n + 1 ) * n + 2 );
+  EXPECT_EQ( found[1], n * n * n );
+
+  // the search stops at the first box accepted by the visitor
+  localIndex numVisited = 0;
+  EXPECT_TRUE( index.forBoxesContaining( point, [&]( localIndex const )
+  {
+    ++numVisited;
+    return true;
+  } ) );
+  EXPECT_EQ( numVisited, 1 );
+
+  // only the large box contains a point outside of the cells
+  real64 const outside[3] = { -0.25, 2.5, 2.5 };
+  found.clear();
+  index.forBoxesContaining( outside, [&]( localIndex const b )
+  {
+    found.push_back( b );
+    return false;
+  } );
+  ASSERT_EQ( found.size(), 1u );
+  EXPECT_EQ( found[0], n * n * n );
+}
+
+TEST( testSpatialBoxIndex, intersecting )
+{
+  localIndex const n = 6;
+  array2d< real64 > const boxes = makeGridBoxes( n );
+
+  SpatialBoxIndex index;
+  index.build( boxes.toViewConst() );
+
+  real64 const minCoords[3] = { 1.5, 1.5, 1.5 };
+  real64 const maxCoords[3] = { 3.5, 2.5, 1.75 };
+
+  std::vector< localIndex > found;
+  index.forBoxesIntersecting( minCoords, maxCoords, [&]( localIndex const b )
+  {
+    found.push_back( b );
+  } );
+
+  // compare with a brute force search
+  std::vector< localIndex > expected;
+  for( localIndex b = 0; b < boxes.size( 0 ); ++b )
+  {
+    bool intersects = true;
+    for( int d = 0; d < 3; ++d )
+    {
+      intersects = intersects && boxes[b][d] <= maxCoords[d] && minCoords[d] <= boxes[b][d + 3];
+    }
+    if( intersects )
+    {
+      expected.push_back( b );
+    }
+  }
+  EXPECT_EQ( found, expected );
+}
+
+TEST( testSpatialBoxIndex, cellElementsFollowNodeMotion )
+{
+  ProblemManager problemManager( "Problem", nullptr );
+  setupProblemFromXML( problemManager, xmlInput );
+  MeshLevel & mesh = *problemManager.getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 );
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+  NodeManager & nodeManager = *mesh.getNodeManager();
+
+  real64 const point[3] = { 2.5, 0.5, 0.5 };
+  std::vector< globalIndex > const before = findCellElements( elemManager, nodeManager, point );
+  ASSERT_EQ( before.size(), 1u );
+
+  // translate the mesh, the element is found at the translated point only
+  real64 const shift[3] = { 10.0, -3.0, 1.0 };
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      X[a][d] += shift[d];
+    }
+  }
+  nodeManager.referencePositionModified();
+
+  real64 const shiftedPoint[3] = { point[0] + shift[0], point[1] + shift[1], point[2] + shift[2] };
+  EXPECT_EQ( findCellElements( elemManager, nodeManager, shiftedPoint ), before );
+  EXPECT_TRUE( findCellElements( elemManager, nodeManager, point ).empty() );
+}
+
+int main( int argc, char * argv[] )
+{
+  geosx::basicSetup( argc, argv );
+
+  int result = 0;
+  testing::InitGoogleTest( &argc, argv );
+  result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+  return result;
+}
@@ -26,9 +26,16 @@ using namespace dataRepository;
 
 MeshManager::MeshManager( std::string const & name,
                           Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_reorderingMethod( meshReordering::Method::None )
 {
   setInputFlags( InputFlags::REQUIRED );
+
+  registerWrapper( viewKeyStruct::reorderingMethodString, &m_reorderingMethod )->
+    setApplyDefaultValue( m_reorderingMethod )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Renumbering of the local nodes and elements after partitioning, to improve memory locality. Valid options:\n* " +
+                    EnumStrings< meshReordering::Method >::concat( "\n* " ) );
 }
 
 MeshManager::~MeshManager()
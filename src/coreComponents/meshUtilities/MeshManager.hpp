@@ -21,6 +21,7 @@
 
 #include "dataRepository/Group.hpp"
 #include "managers/DomainPartition.hpp"
+#include "meshUtilities/MeshReordering.hpp"
 
 namespace geosx
 {
@@ -68,6 +69,19 @@ public:
    */
   void GenerateMeshLevels( DomainPartition * const domain );
 
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeyStruct
+  {
+    constexpr static auto reorderingMethodString = "reorderingMethod";
+  };
+  /// @endcond
+
+  /**
+   * @brief Get the ordering applied to the local nodes and elements after the mesh generation.
+   * @return the reordering method
+   */
+  meshReordering::Method getReorderingMethod() const { return m_reorderingMethod; }
+
 private:
 
   /**
@@ -75,6 +89,9 @@ private:
    */
   MeshManager() = delete;
 
+  /// Ordering of the local nodes and elements
+  meshReordering::Method m_reorderingMethod;
+
 };
 
 } /* namespace geosx */
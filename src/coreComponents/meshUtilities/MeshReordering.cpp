@@ -0,0 +1,532 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshReordering.cpp
+ */
+
+#include "MeshReordering.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace geosx
+{
+
+namespace meshReordering
+{
+
+std::uint64_t mortonKey( std::uint32_t const ( &coords )[3] )
+{
+  std::uint64_t key = 0;
+  for( int bit = numKeyBits - 1; bit >= 0; --bit )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      key = ( key << 1 ) | ( ( coords[d] >> bit ) & 1u );
+    }
+  }
+  return key;
+}
+
+std::uint64_t hilbertKey( std::uint32_t const ( &coords )[3] )
+{
+  // Transpose the coordinates into the Hilbert index, see J. Skilling, "Programming the Hilbert curve" (2004).
+  std::uint32_t x[3] = { coords[0], coords[1], coords[2] };
+  std::uint32_t const m = 1u << ( numKeyBits - 1 );
+
+  // inverse undo
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    std::uint32_t const p = q - 1;
+    for( int i = 0; i < 3; ++i )
+    {
+      if( x[i] & q )
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        std::uint32_t const t = ( x[0] ^ x[i] ) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  std::uint32_t t = 0;
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    if( x[2] & q )
+    {
+      t ^= q - 1;
+    }
+  }
+  for( int i = 0; i < 3; ++i )
+  {
+    x[i] ^= t;
+  }
+
+  // the transposed index holds the bits of the key from the first to the last coordinate
+  return mortonKey( x );
+}
+
+namespace
+{
+
+/**
+ * @brief Compute the order of increasing keys, ties being broken by index.
+ * @param keys the keys
+ * @return the index of the object at each position in the order
+ */
+array1d< localIndex > sortByKey( arrayView1d< std::uint64_t const > const & keys )
+{
+  array1d< localIndex > order( keys.size() );
+  for( localIndex i = 0; i < order.size(); ++i )
+  {
+    order[i] = i;
+  }
+  std::sort( order.begin(), order.end(), [&]( localIndex const lhs, localIndex const rhs )
+  {
+    return keys[lhs] < keys[rhs] || ( keys[lhs] == keys[rhs] && lhs < rhs );
+  } );
+  return order;
+}
+
+/**
+ * @brief Invert a permutation.
+ * @param newToOld the old index at each new index
+ * @return the new index at each old index
+ */
+array1d< localIndex > invertPermutation( arrayView1d< localIndex const > const & newToOld )
+{
+  array1d< localIndex > oldToNew( newToOld.size() );
+  forAll< parallelHostPolicy >( newToOld.size(), [&]( localIndex const i )
+  {
+    oldToNew[ newToOld[i] ] = i;
+  } );
+  return oldToNew;
+}
+
+/**
+ * @brief Maps a bounding box onto the grid of the space-filling curves, with the same scaling in all directions.
+ */
+struct CurveGrid
+{
+  /**
+   * @brief Constructor.
+   * @param X the node positions
+   */
+  explicit CurveGrid( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X )
+  {
+    real64 maxExtent = 0.0;
+    for( int d = 0; d < 3; ++d )
+    {
+      RAJA::ReduceMin< parallelHostReduce, real64 > minCoord( std::numeric_limits< real64 >::max() );
+      RAJA::ReduceMax< parallelHostReduce, real64 > maxCoord( std::numeric_limits< real64 >::lowest() );
+      forAll< parallelHostPolicy >( X.size( 0 ), [&]( localIndex const a )
+      {
+        minCoord.min( X( a, d ) );
+        maxCoord.max( X( a, d ) );
+      } );
+      origin[d] = X.size( 0 ) > 0 ? minCoord.get() : 0.0;
+      maxExtent = X.size( 0 ) > 0 ? std::max( maxExtent, maxCoord.get() - minCoord.get() ) : maxExtent;
+    }
+    scale = maxExtent > 0.0 ? ( ( 1u << numKeyBits ) - 1 ) / maxExtent : 0.0;
+  }
+
+  /**
+   * @brief Compute the grid coordinates of a point.
+   * @param x the point
+   * @param coords the grid coordinates
+   */
+  void gridCoords( real64 const ( &x )[3], std::uint32_t ( & coords )[3] ) const
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      coords[d] = static_cast< std::uint32_t >( ( x[d] - origin[d] ) * scale );
+    }
+  }
+
+  /// The minimum coordinates of the nodes
+  real64 origin[3] = { 0.0, 0.0, 0.0 };
+
+  /// The number of grid cells per unit length
+  real64 scale = 0.0;
+};
+
+/**
+ * @brief Compute the key of a point along a space-filling curve.
+ * @param method the curve
+ * @param grid the grid of the curve
+ * @param x the point
+ * @return the key
+ */
+std::uint64_t curveKey( Method const method, CurveGrid const & grid, real64 const ( &x )[3] )
+{
+  std::uint32_t coords[3];
+  grid.gridCoords( x, coords );
+  return method == Method::Hilbert ? hilbertKey( coords ) : mortonKey( coords );
+}
+
+/**
+ * @brief Compute the reverse Cuthill-McKee ordering of the nodes, two nodes being adjacent if they share an element.
+ * @param numNodes the number of nodes
+ * @param elemNodeOffsets the offsets of the nodes of each element in @p elemNodes
+ * @param elemNodes the nodes of all the elements
+ * @return the old index of the node at each new index
+ *
+ * Each connected component is traversed from the last node reached by a first traversal,
+ * which is far from its starting point, to reduce the width of the levels.
+ */
+array1d< localIndex > reverseCuthillMcKee( localIndex const numNodes,
+                                           arrayView1d< localIndex const > const & elemNodeOffsets,
+                                           arrayView1d< localIndex const > const & elemNodes )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numElems = elemNodeOffsets.size() - 1;
+
+  // node to element map, the number of elements of a node being used as its degree
+  array1d< localIndex > nodeElemOffsets( numNodes + 1 );
+  for( localIndex i = 0; i < elemNodeOffsets[numElems]; ++i )
+  {
+    ++nodeElemOffsets[ elemNodes[i] + 1 ];
+  }
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    nodeElemOffsets[a + 1] += nodeElemOffsets[a];
+  }
+  array1d< localIndex > nodeElems( nodeElemOffsets[numNodes] );
+  array1d< localIndex > nodeFill( numNodes );
+  for( localIndex e = 0; e < numElems; ++e )
+  {
+    for( localIndex i = elemNodeOffsets[e]; i < elemNodeOffsets[e + 1]; ++i )
+    {
+      localIndex const a = elemNodes[i];
+      nodeElems[ nodeElemOffsets[a] + nodeFill[a]++ ] = e;
+    }
+  }
+
+  auto degreeLess = [&]( localIndex const lhs, localIndex const rhs )
+  {
+    localIndex const lhsDegree = nodeElemOffsets[lhs + 1] - nodeElemOffsets[lhs];
+    localIndex const rhsDegree = nodeElemOffsets[rhs + 1] - nodeElemOffsets[rhs];
+    return lhsDegree < rhsDegree || ( lhsDegree == rhsDegree && lhs < rhs );
+  };
+
+  // breadth-first traversal of a connected component, visiting the neighbors by increasing degree
+  array1d< localIndex > mark( numNodes );
+  mark.setValues< serialPolicy >( -1 );
+  localIndex stamp = 0;
+  std::vector< localIndex > neighbors;
+  auto traverse = [&]( localIndex const root, std::vector< localIndex > & queue )
+  {
+    ++stamp;
+    queue.clear();
+    queue.push_back( root );
+    mark[root] = stamp;
+    for( std::size_t head = 0; head < queue.size(); ++head )
+    {
+      localIndex const a = queue[head];
+      neighbors.clear();
+      for( localIndex i = nodeElemOffsets[a]; i < nodeElemOffsets[a + 1]; ++i )
+      {
+        localIndex const e = nodeElems[i];
+        for( localIndex j = elemNodeOffsets[e]; j < elemNodeOffsets[e + 1]; ++j )
+        {
+          localIndex const b = elemNodes[j];
+          if( mark[b] != stamp )
+          {
+            mark[b] = stamp;
+            neighbors.push_back( b );
+          }
+        }
+      }
+      std::sort( neighbors.begin(), neighbors.end(), degreeLess );
+      queue.insert( queue.end(), neighbors.begin(), neighbors.end() );
+    }
+  };
+
+  array1d< localIndex > newToOld( numNodes );
+  localIndex numOrdered = 0;
+  std::vector< localIndex > queue;
+  for( localIndex root = 0; root < numNodes; ++root )
+  {
+    if( mark[root] >= 0 )
+    {
+      continue;
+    }
+    traverse( root, queue );
+    traverse( queue.back(), queue );
+    for( localIndex const a : queue )
+    {
+      newToOld[ numNodes - 1 - numOrdered++ ] = a;
+    }
+  }
+  GEOSX_ERROR_IF_NE( numOrdered, numNodes );
+
+  return newToOld;
+}
+
+/**
+ * @brief Compute the maximum and total node index span of the elements.
+ * @param cellBlockManager the cell blocks
+ * @param maxSpan the maximum over all ranks of the difference between the largest and smallest node of an element
+ * @param averageSpan the average over all ranks of this difference
+ */
+void computeNodeSpan( CellBlockManager & cellBlockManager,
+                      localIndex & maxSpan,
+                      real64 & averageSpan )
+{
+  RAJA::ReduceMax< parallelHostReduce, localIndex > localMaxSpan( 0 );
+  RAJA::ReduceSum< parallelHostReduce, localIndex > localTotalSpan( 0 );
+  localIndex numElems = 0;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNode = block.nodeList().toViewConst();
+    localIndex const numNodesPerElem = block.numNodesPerElement();
+    forAll< parallelHostPolicy >( block.size(), [&]( localIndex const k )
+    {
+      localIndex minNode = elemToNode( k, 0 );
+      localIndex maxNode = elemToNode( k, 0 );
+      for( localIndex a = 1; a < numNodesPerElem; ++a )
+      {
+        minNode = std::min( minNode, elemToNode( k, a ) );
+        maxNode = std::max( maxNode, elemToNode( k, a ) );
+      }
+      localMaxSpan.max( maxNode - minNode );
+      localTotalSpan += maxNode - minNode;
+    } );
+    numElems += block.size();
+  } );
+
+  maxSpan = MpiWrapper::Max( localMaxSpan.get() );
+  localIndex const totalElems = MpiWrapper::Sum( numElems );
+  averageSpan = totalElems > 0 ? static_cast< real64 >( MpiWrapper::Sum( localTotalSpan.get() ) ) / totalElems : 0.0;
+}
+
+/**
+ * @brief Renumber the objects of the sets of a manager.
+ * @param object the manager
+ * @param oldToNew the new index at each old index
+ */
+void renumberSets( ObjectManagerBase & object,
+                   arrayView1d< localIndex const > const & oldToNew )
+{
+  std::vector< localIndex > values;
+  object.sets().forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+  {
+    SortedArray< localIndex > & set = wrapper.reference();
+    set.move( LvArray::MemorySpace::CPU, true );
+
+    values.clear();
+    for( localIndex const a : set )
+    {
+      values.push_back( oldToNew[a] );
+    }
+    std::sort( values.begin(), values.end() );
+
+    set.clear();
+    set.reserve( values.size() );
+    for( localIndex const a : values )
+    {
+      set.insert( a );
+    }
+  } );
+}
+
+}
+
+void permuteObjects( ObjectManagerBase & object,
+                     arrayView1d< localIndex const > const & newToOld )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numObjects = object.size();
+  GEOSX_ERROR_IF_NE( newToOld.size(), numObjects );
+
+  // follow the cycles of the permutation, using an extra object as scratch space
+  localIndex const scratch = numObjects;
+  object.resize( numObjects + 1 );
+
+  auto copyObject = [&]( localIndex const source, localIndex const destination )
+  {
+    object.forWrappers( [&]( dataRepository::WrapperBase & wrapper )
+    {
+      wrapper.copy( source, destination );
+    } );
+  };
+
+  array1d< integer > placed( numObjects );
+  for( localIndex start = 0; start < numObjects; ++start )
+  {
+    if( placed[start] || newToOld[start] == start )
+    {
+      continue;
+    }
+
+    copyObject( start, scratch );
+    localIndex destination = start;
+    while( true )
+    {
+      localIndex const source = newToOld[destination];
+      placed[destination] = 1;
+      if( source == start )
+      {
+        copyObject( scratch, destination );
+        break;
+      }
+      copyObject( source, destination );
+      destination = source;
+    }
+  }
+
+  object.resize( numObjects );
+
+  array1d< localIndex > const oldToNew = invertPermutation( newToOld );
+  renumberSets( object, oldToNew );
+}
+
+void reorderMesh( Method const method,
+                  NodeManager & nodeManager,
+                  CellBlockManager & cellBlockManager )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( method == Method::None )
+  {
+    return;
+  }
+
+  localIndex const numNodes = nodeManager.size();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
+  CurveGrid const grid( X );
+
+  // the node and element orderings are computed before anything is moved
+  array1d< localIndex > nodeNewToOld;
+  if( method == Method::ReverseCuthillMcKee )
+  {
+    array1d< localIndex > elemNodeOffsets( 1 );
+    array1d< localIndex > elemNodes;
+    cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+    {
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNode = block.nodeList().toViewConst();
+      for( localIndex k = 0; k < block.size(); ++k )
+      {
+        for( localIndex a = 0; a < block.numNodesPerElement(); ++a )
+        {
+          elemNodes.emplace_back( elemToNode( k, a ) );
+        }
+        elemNodeOffsets.emplace_back( elemNodes.size() );
+      }
+    } );
+    nodeNewToOld = reverseCuthillMcKee( numNodes, elemNodeOffsets, elemNodes );
+  }
+  else
+  {
+    array1d< std::uint64_t > nodeKeys( numNodes );
+    forAll< parallelHostPolicy >( numNodes, [&]( localIndex const a )
+    {
+      real64 const x[3] = { X( a, 0 ), X( a, 1 ), X( a, 2 ) };
+      nodeKeys[a] = curveKey( method, grid, x );
+    } );
+    nodeNewToOld = sortByKey( nodeKeys );
+  }
+  array1d< localIndex > const nodeOldToNew = invertPermutation( nodeNewToOld );
+
+  // elements follow the nodes for RCM, and their center along the curve otherwise
+  std::vector< array1d< localIndex > > elemNewToOld;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNode = block.nodeList().toViewConst();
+    localIndex const numNodesPerElem = block.numNodesPerElement();
+    array1d< std::uint64_t > elemKeys( block.size() );
+    forAll< parallelHostPolicy >( block.size(), [&]( localIndex const k )
+    {
+      if( method == Method::ReverseCuthillMcKee )
+      {
+        localIndex firstNode = nodeOldToNew[ elemToNode( k, 0 ) ];
+        for( localIndex a = 1; a < numNodesPerElem; ++a )
+        {
+          firstNode = std::min( firstNode, nodeOldToNew[ elemToNode( k, a ) ] );
+        }
+        elemKeys[k] = static_cast< std::uint64_t >( firstNode );
+      }
+      else
+      {
+        real64 center[3] = { 0.0, 0.0, 0.0 };
+        for( localIndex a = 0; a < numNodesPerElem; ++a )
+        {
+          for( int d = 0; d < 3; ++d )
+          {
+            center[d] += X( elemToNode( k, a ), d ) / numNodesPerElem;
+          }
+        }
+        elemKeys[k] = curveKey( method, grid, center );
+      }
+    } );
+    elemNewToOld.emplace_back( sortByKey( elemKeys ) );
+  } );
+
+  localIndex maxSpanBefore;
+  real64 averageSpanBefore;
+  computeNodeSpan( cellBlockManager, maxSpanBefore, averageSpanBefore );
+
+  // move the nodes and the elements, and renumber the nodes of the elements
+  permuteObjects( nodeManager, nodeNewToOld );
+  nodeManager.ConstructGlobalToLocalMap();
+  nodeManager.referencePositionModified();
+
+  std::size_t blockIndex = 0;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+  {
+    arrayView1d< localIndex const > const & newToOld = elemNewToOld[ blockIndex++ ];
+    permuteObjects( block, newToOld );
+    block.ConstructGlobalToLocalMap();
+
+    CellBlock::NodeMapType & elemToNode = block.nodeList();
+    array2d< localIndex, cells::NODE_MAP_PERMUTATION > const oldElemToNode( elemToNode );
+    localIndex const numNodesPerElem = block.numNodesPerElement();
+    forAll< parallelHostPolicy >( block.size(), [&]( localIndex const k )
+    {
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        elemToNode( k, a ) = nodeOldToNew[ oldElemToNode( newToOld[k], a ) ];
+      }
+    } );
+  } );
+
+  localIndex maxSpanAfter;
+  real64 averageSpanAfter;
+  computeNodeSpan( cellBlockManager, maxSpanAfter, averageSpanAfter );
+
+  GEOSX_LOG_RANK_0( "Mesh reordering (" << method << "): maximum element node span "
+                                        << maxSpanBefore << " -> " << maxSpanAfter
+                                        << ", average " << averageSpanBefore << " -> " << averageSpanAfter );
+}
+
+} // namespace meshReordering
+
+} // namespace geosx
@@ -0,0 +1,100 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshReordering.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_MESHREORDERING_HPP_
+#define GEOSX_MESHUTILITIES_MESHREORDERING_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
+
+#include <cstdint>
+
+namespace geosx
+{
+
+class NodeManager;
+class CellBlockManager;
+class ObjectManagerBase;
+
+namespace meshReordering
+{
+
+/**
+ * @enum Method
+ * @brief The orderings of the local mesh objects.
+ */
+enum class Method : integer
+{
+  None,                ///< keep the order of the mesh generator
+  ReverseCuthillMcKee, ///< reverse Cuthill-McKee ordering of the node graph
+  Morton,              ///< Morton (Z-order) space-filling curve
+  Hilbert              ///< Hilbert space-filling curve
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( Method, "None", "RCM", "Morton", "Hilbert" )
+
+/// The number of bits per dimension of the space-filling curve keys
+constexpr int numKeyBits = 21;
+
+/**
+ * @brief Compute the Morton key of a point of a grid.
+ * @param coords the grid coordinates of the point, lower than 2^numKeyBits
+ * @return the key, interleaving the bits of the coordinates
+ */
+std::uint64_t mortonKey( std::uint32_t const ( &coords )[3] );
+
+/**
+ * @brief Compute the Hilbert key of a point of a grid.
+ * @param coords the grid coordinates of the point, lower than 2^numKeyBits
+ * @return the position of the point along the Hilbert curve
+ *
+ * Consecutive keys correspond to neighboring grid points.
+ */
+std::uint64_t hilbertKey( std::uint32_t const ( &coords )[3] );
+
+/**
+ * @brief Permute the objects of a manager in place.
+ * @param object the manager
+ * @param newToOld the old index of the object at each new index
+ *
+ * All the array wrappers sized from the manager are permuted, and the sets are renumbered.
+ * Relation maps are left untouched and must be permuted by the caller.
+ */
+void permuteObjects( ObjectManagerBase & object,
+                     arrayView1d< localIndex const > const & newToOld );
+
+/**
+ * @brief Renumber the local nodes and the elements of each cell block of a freshly generated mesh.
+ * @param method the ordering
+ * @param nodeManager the node manager
+ * @param cellBlockManager the cell blocks
+ *
+ * This must be called before the faces, edges and ghosts are built, since those are numbered
+ * after the nodes and elements. The node bandwidth of the element-to-node maps is logged
+ * before and after the renumbering.
+ */
+void reorderMesh( Method const method,
+                  NodeManager & nodeManager,
+                  CellBlockManager & cellBlockManager );
+
+} // namespace meshReordering
+
+} // namespace geosx
+
+#endif /* GEOSX_MESHUTILITIES_MESHREORDERING_HPP_ */
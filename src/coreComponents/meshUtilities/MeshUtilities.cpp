@@ -23,6 +23,7 @@
 #include "SimpleGeometricObjects/SimpleGeometricObjectBase.hpp"
 #include "common/TimingMacros.hpp"
 #include "mesh/NodeManager.hpp"
+#include "mesh/SpatialBoxIndex.hpp"
 
 namespace geosx
 {
@@ -44,10 +45,16 @@ MeshUtilities::~MeshUtilities()
 void MeshUtilities::GenerateNodesets( dataRepository::Group const * geometries,
                                       NodeManager * const nodeManager )
 {
+  GEOSX_MARK_FUNCTION;
+
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager->referencePosition();
   localIndex const numNodes = nodeManager->size();
   Group & sets = nodeManager->sets();
 
+  // nodes indexed as boxes of zero extent, built with the first bounded object
+  SpatialBoxIndex nodeIndex;
+  bool nodeIndexBuilt = false;
+
   for( int i = 0; i < geometries->GetSubGroups().size(); ++i )
   {
     SimpleGeometricObjectBase const * const object = geometries->GetGroup< SimpleGeometricObjectBase >( i );
@@ -55,11 +62,41 @@ void MeshUtilities::GenerateNodesets( dataRepository::Group const * geometries,
     {
       string name = object->getName();
       SortedArray< localIndex > & targetSet = sets.registerWrapper< SortedArray< localIndex > >( name )->reference();
-      for( localIndex a=0; a<numNodes; ++a )
+
+      R1Tensor minCoords, maxCoords;
+      if( object->GetBoundingBox( minCoords, maxCoords ) )
+      {
+        if( !nodeIndexBuilt )
+        {
+          array2d< real64 > nodeBoxes( numNodes, 6 );
+          for( localIndex a=0; a<numNodes; ++a )
+          {
+            for( int d=0; d<3; ++d )
+            {
+              nodeBoxes[a][d] = X[a][d];
+              nodeBoxes[a][d+3] = X[a][d];
+            }
+          }
+          nodeIndex.build( nodeBoxes.toViewConst() );
+          nodeIndexBuilt = true;
+        }
+
+        nodeIndex.forBoxesIntersecting( minCoords, maxCoords, [&]( localIndex const a )
+        {
+          if( object->IsCoordInObject( X[a] ))
+          {
+            targetSet.insert( a );
+          }
+        } );
+      }
+      else
       {
-        if( object->IsCoordInObject( X[a] ))
+        for( localIndex a=0; a<numNodes; ++a )
         {
-          targetSet.insert( a );
+          if( object->IsCoordInObject( X[a] ))
+          {
+            targetSet.insert( a );
+          }
         }
       }
     }
@@ -136,6 +136,28 @@ bool BoundedPlane::IsCoordInObject( const R1Tensor & coord ) const
   return isInside;
 }
 
+bool BoundedPlane::GetBoundingBox( R1Tensor & minCoords, R1Tensor & maxCoords ) const
+{
+  minCoords = m_points[0];
+  maxCoords = m_points[0];
+  for( localIndex p = 1; p < m_points.size(); ++p )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      minCoords[i] = std::min( minCoords[i], m_points[p][i] );
+      maxCoords[i] = std::max( maxCoords[i], m_points[p][i] );
+    }
+  }
+  // account for the round-off of the rectangle limits
+  real64 const tolerance = 1e-10 * ( m_dimensions[0] + m_dimensions[1] );
+  for( int i = 0; i < 3; ++i )
+  {
+    minCoords[i] -= tolerance;
+    maxCoords[i] += tolerance;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, BoundedPlane, std::string const &, Group * const )
 
 } /* namespace geosx */
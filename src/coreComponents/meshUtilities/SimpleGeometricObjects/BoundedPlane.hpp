@@ -67,6 +67,8 @@ public:
 
   bool IsCoordInObject( const R1Tensor & coord ) const override final;
 
+  bool GetBoundingBox( R1Tensor & minCoords, R1Tensor & maxCoords ) const override final;
+
   /**
    * @brief Find the bounds of the plane.
    */
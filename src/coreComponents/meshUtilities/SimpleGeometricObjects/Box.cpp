@@ -137,6 +137,18 @@ bool Box::IsCoordInObject( const R1Tensor & coord ) const
   return rval;
 }
 
+bool Box::GetBoundingBox( R1Tensor & minCoords, R1Tensor & maxCoords ) const
+{
+  // the bounds of a rotated box are not computed
+  if( std::fabs( m_strikeAngle ) < 1e-20 )
+  {
+    minCoords = m_min;
+    maxCoords = m_max;
+    return true;
+  }
+  return false;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Box, std::string const &, Group * const )
 
 } /* namespace geosx */
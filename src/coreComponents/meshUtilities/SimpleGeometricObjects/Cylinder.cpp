@@ -78,6 +78,20 @@ bool Cylinder::IsCoordInObject( const R1Tensor & coord ) const
   return rval;
 }
 
+bool Cylinder::GetBoundingBox( R1Tensor & minCoords, R1Tensor & maxCoords ) const
+{
+  // IsCoordInObject bounds the distance to point1 along the axis by the height on both sides of point1
+  R1Tensor point0 = m_point1;
+  point0 -= m_point2;
+  point0 += m_point1;
+  for( int i = 0; i < 3; ++i )
+  {
+    minCoords[i] = std::min( point0[i], m_point2[i] ) - m_radius;
+    maxCoords[i] = std::max( point0[i], m_point2[i] ) + m_radius;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Cylinder, std::string const &, Group * const )
 
 } /* namespace geosx */
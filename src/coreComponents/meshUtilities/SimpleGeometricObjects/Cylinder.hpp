@@ -68,6 +68,8 @@ public:
 
   bool IsCoordInObject( const R1Tensor & coord ) const override final;
 
+  bool GetBoundingBox( R1Tensor & minCoords, R1Tensor & maxCoords ) const override final;
+
 
 private:
 
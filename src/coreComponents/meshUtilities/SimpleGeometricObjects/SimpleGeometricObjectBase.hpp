@@ -94,6 +94,16 @@ public:
    */
   virtual bool IsCoordInObject( const R1Tensor & coord ) const = 0;
 
+  /**
+   * @brief Get a box containing all the coordinates in the object.
+   * @param[out] minCoords the minimum coordinates of the box
+   * @param[out] maxCoords the maximum coordinates of the box
+   * @return true if the box was set, false if the object is unbounded or has no simple bounding box
+   */
+  virtual bool GetBoundingBox( R1Tensor & GEOSX_UNUSED_PARAM( minCoords ),
+                               R1Tensor & GEOSX_UNUSED_PARAM( maxCoords ) ) const
+  { return false; }
+
 };
 
 
@@ -0,0 +1,269 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "meshUtilities/MeshReordering.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+constexpr std::uint32_t gridSize = 8;
+
+struct GridPoint
+{
+  std::uint64_t key;
+  std::uint32_t coords[3];
+};
+
+template< typename KEY_FUNCTION >
+std::vector< GridPoint > sortGridPoints( KEY_FUNCTION && keyFunction )
+{
+  std::vector< GridPoint > points;
+  for( std::uint32_t k = 0; k < gridSize; ++k )
+  {
+    for( std::uint32_t j = 0; j < gridSize; ++j )
+    {
+      for( std::uint32_t i = 0; i < gridSize; ++i )
+      {
+        GridPoint point{ 0, { i, j, k } };
+        point.key = keyFunction( point.coords );
+        points.push_back( point );
+      }
+    }
+  }
+  std::sort( points.begin(), points.end(), []( GridPoint const & lhs, GridPoint const & rhs )
+  {
+    return lhs.key < rhs.key;
+  } );
+  return points;
+}
+
+string meshInput( string const & reorderingMethod )
+{
+  return
+    "<Problem>"
+    "  <Mesh reorderingMethod=\"" + reorderingMethod + "\">"
+    "    <InternalMesh name=\"mesh1\""
+    "                  elementTypes=\"{C3D8}\""
+    "                  xCoords=\"{0, 4}\""
+    "                  yCoords=\"{0, 3}\""
+    "                  zCoords=\"{0, 2}\""
+    "                  nx=\"{4}\""
+    "                  ny=\"{3}\""
+    "                  nz=\"{2}\""
+    "                  cellBlockNames=\"{block1}\"/>"
+    "  </Mesh>"
+    "  <Geometry>"
+    "    <Box name=\"corner\" xMin=\"-0.01, -0.01, -0.01\" xMax=\"1.01, 1.01, 2.01\"/>"
+    "  </Geometry>"
+    "  <ElementRegions>"
+    "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+    "  </ElementRegions>"
+    "</Problem>";
+}
+
+void setupProblemFromXML( ProblemManager & problemManager, string const & xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput.c_str(), xmlInput.size() );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition * domain = problemManager.getDomainPartition();
+  MeshManager * meshManager = problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager->GenerateMeshLevels( domain );
+
+  ElementRegionManager * elementManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager->getName().c_str() );
+  elementManager->ProcessInputFileRecursive( topLevelNode );
+  elementManager->PostProcessInputRecursive();
+
+  problemManager.ProblemSetup();
+}
+
+/// Mesh objects and their relations, identified by global indices
+struct MeshSnapshot
+{
+  /// Local-to-global map of the nodes
+  std::vector< globalIndex > nodeLocalToGlobal;
+
+  /// Reference position of each node
+  std::map< globalIndex, std::array< real64, 3 > > nodePositions;
+
+  /// Ordered nodes of each element
+  std::map< globalIndex, std::vector< globalIndex > > elementNodes;
+
+  /// Nodes of each node set
+  std::map< string, std::vector< globalIndex > > nodeSets;
+
+  /// Elements of each element set
+  std::map< string, std::vector< globalIndex > > elementSets;
+};
+
+/// Collect the global indices of the objects of the sets of a manager
+void collectSets( ObjectManagerBase const & object,
+                  std::map< string, std::vector< globalIndex > > & sets )
+{
+  arrayView1d< globalIndex const > const & localToGlobal = object.localToGlobalMap();
+  object.sets().forWrappers< SortedArray< localIndex > >( [&]( auto const & wrapper )
+  {
+    std::vector< globalIndex > & globalSet = sets[wrapper.getName()];
+    for( localIndex const a : wrapper.reference() )
+    {
+      globalSet.push_back( localToGlobal[a] );
+    }
+    std::sort( globalSet.begin(), globalSet.end() );
+  } );
+}
+
+/**
+ * @brief Generate the mesh with a reordering method and check the consistency of the local numbering.
+ * @param reorderingMethod the reordering method
+ * @return the mesh objects and relations, identified by global indices
+ */
+MeshSnapshot generateMesh( string const & reorderingMethod )
+{
+  ProblemManager problemManager( "Problem", nullptr );
+  setupProblemFromXML( problemManager, meshInput( reorderingMethod ) );
+  MeshLevel const & mesh = *problemManager.getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 );
+
+  MeshSnapshot snapshot;
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  arrayView1d< globalIndex const > const & nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    globalIndex const globalNode = nodeLocalToGlobal[a];
+    EXPECT_EQ( nodeManager.globalToLocalMap().at( globalNode ), a );
+    snapshot.nodeLocalToGlobal.push_back( globalNode );
+    snapshot.nodePositions[globalNode] = { X( a, 0 ), X( a, 1 ), X( a, 2 ) };
+  }
+  collectSets( nodeManager, snapshot.nodeSets );
+
+  mesh.getElemManager()->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< globalIndex const > const & elemLocalToGlobal = subRegion.localToGlobalMap();
+    CellElementSubRegion::NodeMapType const & elemToNodes = subRegion.nodeList();
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      EXPECT_EQ( subRegion.globalToLocalMap().at( elemLocalToGlobal[k] ), k );
+      std::vector< globalIndex > & nodes = snapshot.elementNodes[elemLocalToGlobal[k]];
+      for( localIndex i = 0; i < elemToNodes.size( 1 ); ++i )
+      {
+        nodes.push_back( nodeLocalToGlobal[elemToNodes( k, i )] );
+      }
+    }
+    collectSets( subRegion, snapshot.elementSets );
+  } );
+
+  return snapshot;
+}
+
+}
+
+TEST( MeshReordering, reorderedMeshIsConsistent )
+{
+  MeshSnapshot const reference = generateMesh( "None" );
+  ASSERT_FALSE( reference.nodeSets.at( "corner" ).empty() );
+
+  for( string const method : { "RCM", "Morton", "Hilbert" } )
+  {
+    SCOPED_TRACE( method );
+    MeshSnapshot const reordered = generateMesh( method );
+
+    // the local numbering of the nodes has changed
+    ASSERT_EQ( reordered.nodeLocalToGlobal.size(), reference.nodeLocalToGlobal.size() );
+    EXPECT_NE( reordered.nodeLocalToGlobal, reference.nodeLocalToGlobal );
+
+    // the nodes, the element connectivities and the sets are the same once identified by global index
+    EXPECT_EQ( reordered.nodePositions, reference.nodePositions );
+    EXPECT_EQ( reordered.elementNodes, reference.elementNodes );
+    EXPECT_EQ( reordered.nodeSets, reference.nodeSets );
+    EXPECT_EQ( reordered.elementSets, reference.elementSets );
+  }
+}
+
+TEST( MeshReordering, mortonKeyInterleavesBits )
+{
+  std::uint32_t const x[3] = { 1, 0, 0 };
+  std::uint32_t const y[3] = { 0, 1, 0 };
+  std::uint32_t const z[3] = { 0, 0, 1 };
+  std::uint32_t const xyz[3] = { 3, 2, 1 };
+  EXPECT_EQ( meshReordering::mortonKey( x ), 4u );
+  EXPECT_EQ( meshReordering::mortonKey( y ), 2u );
+  EXPECT_EQ( meshReordering::mortonKey( z ), 1u );
+  EXPECT_EQ( meshReordering::mortonKey( xyz ), 0b110101u );
+
+  // the points of the grid fill the first keys
+  std::vector< GridPoint > const points = sortGridPoints( meshReordering::mortonKey );
+  for( std::size_t i = 0; i < points.size(); ++i )
+  {
+    EXPECT_EQ( points[i].key, i );
+  }
+}
+
+TEST( MeshReordering, hilbertKeyIsContinuous )
+{
+  std::vector< GridPoint > const points = sortGridPoints( meshReordering::hilbertKey );
+
+  // the curve starts at the origin and fills the grid before leaving it
+  for( std::size_t i = 0; i < points.size(); ++i )
+  {
+    EXPECT_EQ( points[i].key, i );
+  }
+
+  // consecutive points along the curve are neighbors
+  for( std::size_t i = 1; i < points.size(); ++i )
+  {
+    int distance = 0;
+    for( int d = 0; d < 3; ++d )
+    {
+      distance += std::abs( static_cast< int >( points[i].coords[d] ) - static_cast< int >( points[i-1].coords[d] ) );
+    }
+    EXPECT_EQ( distance, 1 ) << "between keys " << points[i-1].key << " and " << points[i].key;
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  geosx::basicSetup( argc, argv );
+
+  int result = 0;
+  testing::InitGoogleTest( &argc, argv );
+  result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+  return result;
+}
@@ -24,6 +24,7 @@
 #include "mpiCommunications/NeighborCommunicator.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/ObjectManagerBase.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 #include <algorithm>
 
@@ -82,6 +83,109 @@ void CommunicationTools::releaseCommID( int & ID )
   ID = -1;
 }
 
+namespace
+{
+
+/**
+ * @brief Lexicographically compare two keys of the same width.
+ * @param lhs the first key
+ * @param rhs the second key
+ * @param width the number of entries of the keys
+ * @return a negative value if @p lhs comes first, a positive value if @p rhs comes first, zero if they are equal
+ */
+int compareKeys( globalIndex const * const lhs,
+                 globalIndex const * const rhs,
+                 localIndex const width )
+{
+  for( localIndex i = 0; i < width; ++i )
+  {
+    if( lhs[i] != rhs[i] )
+    {
+      return lhs[i] < rhs[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Sort the objects that have a key by increasing key.
+ * @param keys the fixed-width keys of the objects, starting with -1 for objects without a key
+ * @return the objects with a key, sorted by key
+ *
+ * The objects are first distributed in buckets of increasing first key entry,
+ * which are then sorted independently.
+ */
+array1d< localIndex > sortObjectsByKey( arrayView2d< globalIndex const > const & keys )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const width = keys.size( 1 );
+
+  localIndex numObjects = 0;
+  globalIndex minFirstEntry = std::numeric_limits< globalIndex >::max();
+  globalIndex maxFirstEntry = 0;
+  for( localIndex a = 0; a < keys.size( 0 ); ++a )
+  {
+    if( width > 0 && keys( a, 0 ) >= 0 )
+    {
+      ++numObjects;
+      minFirstEntry = std::min( minFirstEntry, keys( a, 0 ) );
+      maxFirstEntry = std::max( maxFirstEntry, keys( a, 0 ) );
+    }
+  }
+
+  array1d< localIndex > sortedObjects( numObjects );
+  if( numObjects == 0 )
+  {
+    return sortedObjects;
+  }
+
+  // buckets of contiguous ranges of first entries, a few dozen objects each on average
+  localIndex const numBuckets = numObjects / 32 + 1;
+  real64 const bucketScale = numBuckets / ( static_cast< real64 >( maxFirstEntry - minFirstEntry ) + 1.0 );
+  auto bucketOf = [&]( localIndex const a )
+  {
+    return std::min( numBuckets - 1, static_cast< localIndex >( ( keys( a, 0 ) - minFirstEntry ) * bucketScale ) );
+  };
+
+  array1d< localIndex > bucketOffsets( numBuckets + 1 );
+  for( localIndex a = 0; a < keys.size( 0 ); ++a )
+  {
+    if( keys( a, 0 ) >= 0 )
+    {
+      ++bucketOffsets[ bucketOf( a ) + 1 ];
+    }
+  }
+  for( localIndex b = 0; b < numBuckets; ++b )
+  {
+    bucketOffsets[b + 1] += bucketOffsets[b];
+  }
+
+  array1d< localIndex > bucketFill( numBuckets );
+  for( localIndex a = 0; a < keys.size( 0 ); ++a )
+  {
+    if( keys( a, 0 ) >= 0 )
+    {
+      localIndex const b = bucketOf( a );
+      sortedObjects[ bucketOffsets[b] + bucketFill[b]++ ] = a;
+    }
+  }
+
+  forAll< parallelHostPolicy >( numBuckets, [&]( localIndex const b )
+  {
+    std::sort( sortedObjects.data() + bucketOffsets[b],
+               sortedObjects.data() + bucketOffsets[b + 1],
+               [&]( localIndex const lhs, localIndex const rhs )
+    {
+      return compareKeys( &keys( lhs, 0 ), &keys( rhs, 0 ), width ) < 0;
+    } );
+  } );
+
+  return sortedObjects;
+}
+
+}
+
 void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
                                               ObjectManagerBase const & compositionObject,
                                               std::vector< NeighborCommunicator > & neighbors )
@@ -104,60 +208,31 @@ void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
   }
 
   // get the relation to the composition object used that will be used to identify the main object. For example,
-  // a face can be identified by its nodes.
-  std::vector< std::vector< globalIndex > > objectToCompositionObject;
+  // a face can be identified by its nodes. Each object on the domain boundary is given a fixed-width key made of
+  // the sorted global indices of its composition objects, padded with -1.
+  array2d< globalIndex > objectToCompositionObject;
   object.ExtractMapFromObjectForAssignGlobalIndexNumbers( &compositionObject, objectToCompositionObject );
 
-  // now arrange the data from objectToCompositionObject into a map "indexByFirstCompositionIndex", such that the key
-  // is the lowest global index of the composition object that make up this object. The value of the map is a pair, with
-  // the array being the remaining composition object global indices, and the second being the global index of the
-  // object
-  // itself.
-  map< globalIndex, std::vector< std::pair< std::vector< globalIndex >, localIndex > > > indexByFirstCompositionIndex;
-
-  localIndex bufferSize = 0;
-  for( std::size_t a = 0; a < objectToCompositionObject.size(); ++a )
-  {
-    if( objectToCompositionObject[a].size() > 0 )
-    {
-      // set nodelist array
-      std::vector< globalIndex > const & nodeList = objectToCompositionObject[a];
+  array1d< localIndex > const sortedObjects = sortObjectsByKey( objectToCompositionObject.toViewConst() );
+  localIndex const numSortedObjects = sortedObjects.size();
 
-      // grab the first global index of the composition objects
-      const globalIndex firstCompositionIndex = nodeList[0];
+  // the keys are communicated with the width of the widest key over all ranks
+  localIndex const localKeyWidth = objectToCompositionObject.size( 1 );
+  localIndex const keyWidth = MpiWrapper::Max( localKeyWidth );
+  localIndex const recordSize = keyWidth + 1;
 
-      // create a temporary to hold the pair
-      std::pair< std::vector< globalIndex >, globalIndex > tempComp;
-
-      // fill the array with the remaining composition object global indices
-      tempComp.first.insert( tempComp.first.begin(), nodeList.begin() + 1, nodeList.end() );
-
-      // set the second value of the pair to the localIndex of the object.
-      tempComp.second = a;
-
-      // push the tempComp onto the map.
-      indexByFirstCompositionIndex[firstCompositionIndex].emplace_back( std::move( tempComp ) );
-      bufferSize += 2 + nodeList.size();
-    }
-  }
-
-  globalIndex_array objectToCompositionObjectSendBuffer;
-  objectToCompositionObjectSendBuffer.reserve( bufferSize );
-
-  // put the map into a buffer
-  for( std::size_t a = 0; a < objectToCompositionObject.size(); ++a )
+  // put the global index and the key of each object into a buffer, in increasing key order
+  globalIndex_array objectToCompositionObjectSendBuffer( numSortedObjects * recordSize );
+  forAll< parallelHostPolicy >( numSortedObjects, [&]( localIndex const i )
   {
-    if( objectToCompositionObject[a].size() > 0 )
+    localIndex const a = sortedObjects[i];
+    globalIndex * const record = objectToCompositionObjectSendBuffer.data() + i * recordSize;
+    record[0] = localToGlobal[a];
+    for( localIndex k = 0; k < keyWidth; ++k )
     {
-      std::vector< globalIndex > const & nodeList = objectToCompositionObject[a];
-      objectToCompositionObjectSendBuffer.emplace_back( nodeList.size() );
-      objectToCompositionObjectSendBuffer.emplace_back( localToGlobal[a] );
-      for( std::size_t b = 0; b < nodeList.size(); ++b )
-      {
-        objectToCompositionObjectSendBuffer.emplace_back( nodeList[b] );
-      }
+      record[k + 1] = k < localKeyWidth ? objectToCompositionObject( a, k ) : -1;
     }
-  }
+  } );
 
   MPI_iCommData commData;
   commData.resize( neighbors.size() );
@@ -203,16 +278,6 @@ void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
 
   }
 
-  // unpack the data from neighbor->tempNeighborData.neighborNumbers[DomainPartition::FiniteElementNodeManager] to
-  // the local arrays
-
-  // object to receive the neighbor data
-  // this baby is an Array (for each neighbor) of maps, with the key of lowest composition index, and a value
-  // containing an array containing the std::pairs of the remaining composition indices, and the globalIndex of the
-  // object.
-  std::vector< map< globalIndex, std::vector< std::pair< std::vector< globalIndex >, globalIndex > > > >
-  neighborCompositionObjects( neighbors.size() );
-
   for( std::size_t count=0; count<neighbors.size(); ++count )
   {
     int neighborIndex;
@@ -223,96 +288,44 @@ void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
 
-    globalIndex const * recBuffer = receiveBuffers[neighborIndex].data();
-    localIndex recBufferSize = receiveBufferSizes[neighborIndex];
-    globalIndex const * endBuffer = recBuffer + recBufferSize;
-    // iterate over data that was just received
-    while( recBuffer < endBuffer )
-    {
-      // the first thing packed was the data size for a given object
-      localIndex dataSize = LvArray::integerConversion< localIndex >( *recBuffer++ );
-
-      // the second thing packed was the globalIndex of that object
-      const globalIndex neighborGlobalIndex = *( recBuffer++ );
+    globalIndex const * const neighborRecords = receiveBuffers[neighborIndex].data();
+    localIndex const numNeighborRecords = receiveBufferSizes[neighborIndex] / recordSize;
 
-      // the global indices of the composition objects were next. they are ordered, so the lowest one is first.
-      const globalIndex firstCompositionIndex = *( recBuffer++ );
+    // the records of both ranks are sorted by key, so the shared objects are found by merging them
+    localIndex localRecordIndex = 0;
+    localIndex neighborRecordIndex = 0;
+    while( localRecordIndex < numSortedObjects && neighborRecordIndex < numNeighborRecords )
+    {
+      globalIndex const * const localRecord = objectToCompositionObjectSendBuffer.data() + localRecordIndex * recordSize;
+      globalIndex const * const neighborRecord = neighborRecords + neighborRecordIndex * recordSize;
 
-      // the remaining composition object indices.
-      std::vector< globalIndex > temp;
-      for( localIndex b = 1; b < dataSize; ++b )
+      int const comparison = compareKeys( localRecord + 1, neighborRecord + 1, keyWidth );
+      if( comparison < 0 )
       {
-        temp.emplace_back( *( recBuffer++ ) );
+        ++localRecordIndex;
       }
-
-      // fill neighborCompositionObjects
-      std::pair< std::vector< globalIndex >, globalIndex >
-      tempComp( std::make_pair( std::move( temp ), std::move( neighborGlobalIndex ) ) );
-
-      neighborCompositionObjects[neighborIndex][firstCompositionIndex].emplace_back( tempComp );
-    }
-
-    // Set iterators to the beginning of each indexByFirstCompositionIndex,
-    // and neighborCompositionObjects[neighborNum].
-    map< globalIndex, std::vector< std::pair< std::vector< globalIndex >, localIndex > > >::const_iterator
-      iter_local = indexByFirstCompositionIndex.begin();
-    map< globalIndex, std::vector< std::pair< std::vector< globalIndex >, globalIndex > > >::const_iterator
-      iter_neighbor = neighborCompositionObjects[neighborIndex].begin();
-
-    // now we continue the while loop as long as both of our iterators are in range.
-    while( iter_local != indexByFirstCompositionIndex.end() &&
-           iter_neighbor != neighborCompositionObjects[neighborIndex].end() )
-    {
-      // check to see if the map keys (first composition index) are the same.
-      if( iter_local->first == iter_neighbor->first )
+      else if( comparison > 0 )
+      {
+        ++neighborRecordIndex;
+      }
+      else
       {
-        // first we loop over all local composition arrays (objects with the matched key)
-        for( std::vector< std::pair< std::vector< globalIndex >, localIndex > >::const_iterator
-             iter_local2 = iter_local->second.begin();
-             iter_local2 != iter_local->second.end(); ++iter_local2 )
+        // they are equal, so we need to overwrite the global index for the object
+        localIndex const a = sortedObjects[localRecordIndex];
+        globalIndex const neighborGlobalIndex = neighborRecord[0];
+        if( neighborGlobalIndex < localToGlobal[a] )
         {
-          // and loop over all of the neighbor composition arrays (objects with the matched key)
-          for( std::vector< std::pair< std::vector< globalIndex >, globalIndex > >::const_iterator
-               iter_neighbor2 = iter_neighbor->second.begin();
-               iter_neighbor2 != iter_neighbor->second.end();
-               ++iter_neighbor2 )
+          if( neighbor.NeighborRank() < commRank )
+          {
+            localToGlobal[a] = neighborGlobalIndex;
+            ghostRank[a] = neighbor.NeighborRank();
+          }
+          else
           {
-            // now compare the composition arrays
-            if( iter_local2->first.size() == iter_neighbor2->first.size() &&
-                std::equal( iter_local2->first.begin(),
-                            iter_local2->first.end(),
-                            iter_neighbor2->first.begin() ) )
-            {
-              // they are equal, so we need to overwrite the global index for the object
-              if( iter_neighbor2->second < localToGlobal[iter_local2->second] )
-              {
-                if( neighbor.NeighborRank() < commRank )
-                {
-                  localToGlobal[iter_local2->second] = iter_neighbor2->second;
-                  ghostRank[iter_local2->second] = neighbor.NeighborRank();
-                }
-                else
-                {
-                  ghostRank[iter_local2->second] = -1;
-                }
-
-              }
-
-              // we should break out of the iter_local2 loop since we aren't going to find another match.
-              break;
-            }
+            ghostRank[a] = -1;
           }
         }
-        ++iter_local;
-        ++iter_neighbor;
-      }
-      else if( iter_local->first < iter_neighbor->first )
-      {
-        ++iter_local;
-      }
-      else if( iter_local->first > iter_neighbor->first )
-      {
-        ++iter_neighbor;
+        ++localRecordIndex;
       }
     }
   }
@@ -761,6 +774,8 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
   edgeManager.compressRelationMaps();
   faceManager.compressRelationMaps();
 
+  meshLevel.ghostingModified();
+
   CommunicationTools::releaseCommID( commID );
 }
 
@@ -119,7 +119,9 @@ std::size_t MpiWrapper::getSizeofMpiType( MPI_Datatype const type )
 int MpiWrapper::Init( int * argc, char * * * argv )
 {
 #ifdef GEOSX_USE_MPI
-  return MPI_Init( argc, argv );
+  // the time histories may be written with MPI-IO from background threads
+  int provided = MPI_THREAD_SINGLE;
+  return MPI_Init_thread( argc, argv, MPI_THREAD_MULTIPLE, &provided );
 #else
   return 0;
 #endif
@@ -197,6 +199,23 @@ int MpiWrapper::Waitall( int count, MPI_Request array_of_requests[], MPI_Status
   return 0;
 }
 
+int MpiWrapper::Startall( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#endif
+  return 0;
+}
+
+int MpiWrapper::Request_free( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#endif
+  *request = MPI_REQUEST_NULL;
+  return 0;
+}
+
 double MpiWrapper::Wtime( void )
 {
 #ifdef GEOSX_USE_MPI
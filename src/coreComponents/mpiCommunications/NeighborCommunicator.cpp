@@ -22,6 +22,7 @@
 #include "common/TimingMacros.hpp"
 #include "managers/ObjectManagerBase.hpp"
 #include "mesh/MeshLevel.hpp"
+#include "mpiCommunications/ParallelPacker.hpp"
 #include <sys/time.h>
 
 namespace geosx
@@ -29,6 +30,81 @@ namespace geosx
 
 using namespace dataRepository;
 
+namespace
+{
+
+/**
+ * @brief Call a function on each object manager holding fields to synchronize.
+ * @tparam MESH type of the mesh level (const or not)
+ * @tparam LAMBDA type of the function
+ * @param fieldNames names of the fields to synchronize, keyed by object type
+ * @param mesh the mesh level
+ * @param lambda the function, called with the object manager and the names of its fields
+ */
+template< typename MESH, typename LAMBDA >
+void forSyncObjects( std::map< string, string_array > const & fieldNames,
+                     MESH & mesh,
+                     LAMBDA && lambda )
+{
+  if( fieldNames.count( "node" ) > 0 )
+  {
+    lambda( *mesh.getNodeManager(), fieldNames.at( "node" ) );
+  }
+
+  if( fieldNames.count( "edge" ) > 0 )
+  {
+    lambda( *mesh.getEdgeManager(), fieldNames.at( "edge" ) );
+  }
+
+  if( fieldNames.count( "face" ) > 0 )
+  {
+    lambda( *mesh.getFaceManager(), fieldNames.at( "face" ) );
+  }
+
+  if( fieldNames.count( "elems" ) > 0 )
+  {
+    mesh.getElemManager()->template forElementSubRegions< ElementSubRegionBase >( [&]( auto & subRegion )
+    {
+      lambda( subRegion, fieldNames.at( "elems" ) );
+    } );
+  }
+}
+
+/**
+ * @brief Add the fields of an object manager that can be synchronized by the parallel packer.
+ * @param object the object manager holding the fields
+ * @param fieldNames the names of the fields to synchronize
+ * @param indices the ghost indices to pack or unpack
+ * @param packer the parallel packer
+ * @return the names of the remaining fields, to be packed through ObjectManagerBase::Pack
+ *
+ * Both sides of the communication split the fields identically, since the decision only
+ * depends on the type and layout of the fields.
+ */
+string_array addSyncFields( ObjectManagerBase const & object,
+                            string_array const & fieldNames,
+                            arrayView1d< localIndex const > const & indices,
+                            ParallelPacker & packer )
+{
+  string_array remainingNames;
+  packer.addIndexList( indices );
+  for( string const & name : fieldNames )
+  {
+    WrapperBase const * const wrapper = object.getWrapperBase( name );
+    if( wrapper != nullptr && ParallelPacker::canPack( *wrapper ) )
+    {
+      packer.addField( *wrapper );
+    }
+    else
+    {
+      remainingNames.emplace_back( name );
+    }
+  }
+  return remainingNames;
+}
+
+}
+
 NeighborCommunicator::NeighborCommunicator():
   m_neighborRank( -1 ),
   m_sendBufferSize(),
@@ -555,39 +631,26 @@ int NeighborCommunicator::PackCommSizeForSync( std::map< string, string_array >
 {
   GEOSX_MARK_FUNCTION;
 
-  NodeManager const & nodeManager = *(mesh.getNodeManager());
-  EdgeManager const & edgeManager = *(mesh.getEdgeManager());
-  FaceManager const & faceManager = *(mesh.getFaceManager());
-  ElementRegionManager const & elemManager = *(mesh.getElemManager());
-
-  arrayView1d< localIndex const > const & nodeGhostsToSend = nodeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
-
   int bufferSize = 0;
 
-  if( fieldNames.count( "node" ) > 0 )
-  {
-    bufferSize += nodeManager.PackSize( fieldNames.at( "node" ), nodeGhostsToSend, 0, on_device );
-  }
-
-  if( fieldNames.count( "edge" ) > 0 )
-  {
-    bufferSize += edgeManager.PackSize( fieldNames.at( "edge" ), edgeGhostsToSend, 0, on_device );
-  }
-
-  if( fieldNames.count( "face" ) > 0 )
-  {
-    bufferSize += faceManager.PackSize( fieldNames.at( "face" ), faceGhostsToSend, 0, on_device );
-  }
-
-  if( fieldNames.count( "elems" ) > 0 )
+  forSyncObjects( fieldNames, mesh, [&]( ObjectManagerBase const & object, string_array const & names )
   {
-    elemManager.forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+    arrayView1d< localIndex const > const & ghostsToSend = object.getNeighborData( m_neighborRank ).ghostsToSend();
+    if( on_device )
     {
-      bufferSize += subRegion.PackSize( fieldNames.at( "elems" ), subRegion.getNeighborData( m_neighborRank ).ghostsToSend(), 0, on_device );
-    } );
-  }
+      bufferSize += object.PackSize( names, ghostsToSend, 0, on_device );
+    }
+    else
+    {
+      ParallelPacker packer;
+      string_array const remainingNames = addSyncFields( object, names, ghostsToSend, packer );
+      bufferSize += packer.packSize();
+      if( !remainingNames.empty() )
+      {
+        bufferSize += object.PackSize( remainingNames, ghostsToSend, 0, on_device );
+      }
+    }
+  } );
 
   this->m_sendBufferSize[commID] = bufferSize;
   return bufferSize;
@@ -601,42 +664,30 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
 {
   GEOSX_MARK_FUNCTION;
 
-  NodeManager const & nodeManager = *(mesh.getNodeManager());
-  EdgeManager const & edgeManager = *(mesh.getEdgeManager());
-  FaceManager const & faceManager = *(mesh.getFaceManager());
-  ElementRegionManager const & elemManager = *(mesh.getElemManager());
-
-  arrayView1d< localIndex const > const & nodeGhostsToSend = nodeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
-
   buffer_type & sendBuffer = SendBuffer( commID );
   int const bufferSize =  LvArray::integerConversion< int >( sendBuffer.size());
   buffer_unit_type * sendBufferPtr = sendBuffer.data();
 
   int packedSize = 0;
-  if( fieldNames.count( "node" ) > 0 )
-  {
-    packedSize += nodeManager.Pack( sendBufferPtr, fieldNames.at( "node" ), nodeGhostsToSend, 0, on_device );
-  }
 
-  if( fieldNames.count( "edge" ) > 0 )
-  {
-    packedSize += edgeManager.Pack( sendBufferPtr, fieldNames.at( "edge" ), edgeGhostsToSend, 0, on_device );
-  }
-
-  if( fieldNames.count( "face" ) > 0 )
-  {
-    packedSize += faceManager.Pack( sendBufferPtr, fieldNames.at( "face" ), faceGhostsToSend, 0, on_device );
-  }
-
-  if( fieldNames.count( "elems" ) > 0 )
+  forSyncObjects( fieldNames, mesh, [&]( ObjectManagerBase const & object, string_array const & names )
   {
-    elemManager.forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+    arrayView1d< localIndex const > const & ghostsToSend = object.getNeighborData( m_neighborRank ).ghostsToSend();
+    if( on_device )
     {
-      packedSize += subRegion.Pack( sendBufferPtr, fieldNames.at( "elems" ), subRegion.getNeighborData( m_neighborRank ).ghostsToSend(), 0, on_device );
-    } );
-  }
+      packedSize += object.Pack( sendBufferPtr, names, ghostsToSend, 0, on_device );
+    }
+    else
+    {
+      ParallelPacker packer;
+      string_array const remainingNames = addSyncFields( object, names, ghostsToSend, packer );
+      packedSize += packer.pack( sendBufferPtr );
+      if( !remainingNames.empty() )
+      {
+        packedSize += object.Pack( sendBufferPtr, remainingNames, ghostsToSend, 0, on_device );
+      }
+    }
+  } );
 
   GEOSX_ERROR_IF_NE( bufferSize, packedSize );
 }
@@ -658,39 +709,24 @@ void NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array >
   buffer_type const & receiveBuffer = ReceiveBuffer( commID );
   buffer_unit_type const * receiveBufferPtr = receiveBuffer.data();
 
-  NodeManager & nodeManager = *(mesh->getNodeManager());
-  EdgeManager & edgeManager = *(mesh->getEdgeManager());
-  FaceManager & faceManager = *(mesh->getFaceManager());
-  ElementRegionManager & elemManager = *(mesh->getElemManager());
-
-  array1d< localIndex > & nodeGhostsToReceive = nodeManager.getNeighborData( m_neighborRank ).ghostsToReceive();
-  array1d< localIndex > & edgeGhostsToReceive = edgeManager.getNeighborData( m_neighborRank ).ghostsToReceive();
-  array1d< localIndex > & faceGhostsToReceive = faceManager.getNeighborData( m_neighborRank ).ghostsToReceive();
-
-  int unpackedSize = 0;
-
-  if( fieldNames.count( "node" ) > 0 )
-  {
-    unpackedSize += nodeManager.Unpack( receiveBufferPtr, nodeGhostsToReceive, 0, on_device );
-  }
-
-  if( fieldNames.count( "edge" ) > 0 )
+  forSyncObjects( fieldNames, *mesh, [&]( ObjectManagerBase & object, string_array const & names )
   {
-    unpackedSize += edgeManager.Unpack( receiveBufferPtr, edgeGhostsToReceive, 0, on_device );
-  }
-
-  if( fieldNames.count( "face" ) > 0 )
-  {
-    unpackedSize += faceManager.Unpack( receiveBufferPtr, faceGhostsToReceive, 0, on_device );
-  }
-
-  if( fieldNames.count( "elems" ) > 0 )
-  {
-    elemManager.forElementSubRegions< ElementSubRegionBase >( [&] ( ElementSubRegionBase & subRegion )
+    array1d< localIndex > & ghostsToReceive = object.getNeighborData( m_neighborRank ).ghostsToReceive();
+    if( on_device )
     {
-      unpackedSize += subRegion.Unpack( receiveBufferPtr, subRegion.getNeighborData( m_neighborRank ).ghostsToReceive(), 0, on_device );
-    } );
-  }
+      object.Unpack( receiveBufferPtr, ghostsToReceive, 0, on_device );
+    }
+    else
+    {
+      ParallelPacker packer;
+      string_array const remainingNames = addSyncFields( object, names, ghostsToReceive, packer );
+      packer.unpack( receiveBufferPtr );
+      if( !remainingNames.empty() )
+      {
+        object.Unpack( receiveBufferPtr, ghostsToReceive, 0, on_device );
+      }
+    }
+  } );
 }
 
 
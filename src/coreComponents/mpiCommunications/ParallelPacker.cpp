@@ -0,0 +1,165 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ParallelPacker.cpp
+ */
+
+#include "mpiCommunications/ParallelPacker.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "dataRepository/WrapperBase.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include <cstring>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+bool ParallelPacker::canPack( WrapperBase const & wrapper )
+{
+  return wrapper.indexSliceByteSize() > 0;
+}
+
+void ParallelPacker::addIndexList( arrayView1d< localIndex const > const & indices )
+{
+  m_groups.emplace_back();
+  m_groups.back().indices = indices;
+}
+
+void ParallelPacker::addField( WrapperBase const & wrapper )
+{
+  GEOSX_ERROR_IF( m_groups.empty(), "ParallelPacker: an index list must be added before the fields" );
+  GEOSX_ERROR_IF( !canPack( wrapper ), "ParallelPacker: field " << wrapper.getName() << " cannot be packed in parallel" );
+  m_groups.back().wrappers.push_back( &wrapper );
+}
+
+bool ParallelPacker::empty() const
+{
+  for( Group const & group : m_groups )
+  {
+    if( !group.wrappers.empty() )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+localIndex ParallelPacker::packSize() const
+{
+  localIndex packedSize = 0;
+  for( Group const & group : m_groups )
+  {
+    for( WrapperBase const * const wrapper : group.wrappers )
+    {
+      packedSize += group.indices.size() * wrapper->indexSliceByteSize();
+    }
+  }
+  return packedSize;
+}
+
+localIndex ParallelPacker::pack( buffer_unit_type * & buffer ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex packedSize = 0;
+  for( Group const & group : m_groups )
+  {
+    localIndex const numFields = LvArray::integerConversion< localIndex >( group.wrappers.size() );
+    localIndex const numIndices = group.indices.size();
+    if( numFields == 0 || numIndices == 0 )
+    {
+      continue;
+    }
+
+    // resolve the data and the position of the slab of each field in the buffer
+    std::vector< buffer_unit_type const * > fieldData( numFields );
+    std::vector< buffer_unit_type * > fieldSlab( numFields );
+    std::vector< localIndex > sliceSize( numFields );
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      WrapperBase const & wrapper = *group.wrappers[f];
+      wrapper.move( LvArray::MemorySpace::CPU, false );
+      fieldData[f] = static_cast< buffer_unit_type const * >( wrapper.voidPointer() );
+      sliceSize[f] = wrapper.indexSliceByteSize();
+      fieldSlab[f] = buffer;
+      buffer += numIndices * sliceSize[f];
+      packedSize += numIndices * sliceSize[f];
+    }
+
+    buffer_unit_type const * const * const data = fieldData.data();
+    buffer_unit_type * const * const slab = fieldSlab.data();
+    localIndex const * const size = sliceSize.data();
+    arrayView1d< localIndex const > const indices = group.indices;
+
+    forAll< parallelHostPolicy >( numIndices, [=]( localIndex const i )
+    {
+      for( localIndex f = 0; f < numFields; ++f )
+      {
+        std::memcpy( slab[f] + i * size[f], data[f] + indices[i] * size[f], size[f] );
+      }
+    } );
+  }
+  return packedSize;
+}
+
+localIndex ParallelPacker::unpack( buffer_unit_type const * & buffer ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex unpackedSize = 0;
+  for( Group const & group : m_groups )
+  {
+    localIndex const numFields = LvArray::integerConversion< localIndex >( group.wrappers.size() );
+    localIndex const numIndices = group.indices.size();
+    if( numFields == 0 || numIndices == 0 )
+    {
+      continue;
+    }
+
+    std::vector< buffer_unit_type * > fieldData( numFields );
+    std::vector< buffer_unit_type const * > fieldSlab( numFields );
+    std::vector< localIndex > sliceSize( numFields );
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      WrapperBase const & wrapper = *group.wrappers[f];
+      wrapper.move( LvArray::MemorySpace::CPU, true );
+      // the wrappers given for unpacking refer to modifiable objects (see unpack())
+      fieldData[f] = static_cast< buffer_unit_type * >( const_cast< void * >( wrapper.voidPointer() ) );
+      sliceSize[f] = wrapper.indexSliceByteSize();
+      fieldSlab[f] = buffer;
+      buffer += numIndices * sliceSize[f];
+      unpackedSize += numIndices * sliceSize[f];
+    }
+
+    buffer_unit_type * const * const data = fieldData.data();
+    buffer_unit_type const * const * const slab = fieldSlab.data();
+    localIndex const * const size = sliceSize.data();
+    arrayView1d< localIndex const > const indices = group.indices;
+
+    forAll< parallelHostPolicy >( numIndices, [=]( localIndex const i )
+    {
+      for( localIndex f = 0; f < numFields; ++f )
+      {
+        std::memcpy( data[f] + indices[i] * size[f], slab[f] + i * size[f], size[f] );
+      }
+    } );
+  }
+  return unpackedSize;
+}
+
+} /* namespace geosx */
@@ -0,0 +1,115 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ParallelPacker.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_PARALLELPACKER_HPP_
+#define GEOSX_MPICOMMUNICATIONS_PARALLELPACKER_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+class WrapperBase;
+}
+
+/**
+ * @class ParallelPacker
+ * @brief Threaded host packing of fields for a list of indices.
+ *
+ * Fields are organized in groups sharing an index list (e.g. the ghosts of an object manager
+ * for a neighbor). A group is packed with a single parallelHostPolicy loop over its index list,
+ * each iteration gathering the values of the index for all fields of the group. In the buffer,
+ * the values of each field form a contiguous slab of index slices, which is the same layout as
+ * bufferOps::PackDataByIndexDevice. No metadata is packed: sender and receiver must add
+ * the same fields in the same order.
+ *
+ * Only fields whose index slices are contiguous trivially copyable memory can be added
+ * (see canPack()). Data pointers are queried at every pack/unpack, so the packer remains
+ * valid if the fields are reallocated, but not if the index lists are.
+ */
+class ParallelPacker
+{
+public:
+
+  /**
+   * @brief Check whether a field can be packed by the parallel packer.
+   * @param wrapper the wrapper of the field
+   * @return true if the index slices of the field are contiguous trivially copyable memory
+   */
+  static bool canPack( dataRepository::WrapperBase const & wrapper );
+
+  /**
+   * @brief Start a new group of fields.
+   * @param indices the indices to pack/unpack for the fields of the group
+   */
+  void addIndexList( arrayView1d< localIndex const > const & indices );
+
+  /**
+   * @brief Add a field to the last group.
+   * @param wrapper the wrapper of the field, must satisfy canPack()
+   */
+  void addField( dataRepository::WrapperBase const & wrapper );
+
+  /**
+   * @brief @return whether any field has been added.
+   */
+  bool empty() const;
+
+  /**
+   * @brief @return the packed size of all fields, in buffer units.
+   */
+  localIndex packSize() const;
+
+  /**
+   * @brief Pack all fields.
+   * @param buffer the buffer to pack into, advanced upon completion
+   * @return the packed size
+   */
+  localIndex pack( buffer_unit_type * & buffer ) const;
+
+  /**
+   * @brief Unpack all fields.
+   * @param buffer the buffer to unpack from, advanced upon completion
+   * @return the unpacked size
+   *
+   * @note The fields are written through the wrappers given to addField(), which
+   *       must therefore refer to modifiable objects.
+   */
+  localIndex unpack( buffer_unit_type const * & buffer ) const;
+
+private:
+
+  /// Fields sharing an index list
+  struct Group
+  {
+    /// Indices to pack/unpack
+    arrayView1d< localIndex const > indices;
+
+    /// Wrappers of the fields
+    std::vector< dataRepository::WrapperBase const * > wrappers;
+  };
+
+  /// Groups of fields
+  std::vector< Group > m_groups;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_PARALLELPACKER_HPP_ */
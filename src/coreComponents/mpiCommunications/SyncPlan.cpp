@@ -0,0 +1,295 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SyncPlan.cpp
+ */
+
+#include "mpiCommunications/SyncPlan.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+#include "mpiCommunications/NeighborData.hpp"
+#include "mesh/MeshLevel.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SyncPlan::SyncPlan( std::map< string, string_array > const & fieldNames,
+                    MeshLevel & mesh,
+                    std::vector< NeighborCommunicator > & neighbors,
+                    bool onDevice ):
+  m_fieldNames( fieldNames ),
+  m_mesh( mesh ),
+  m_neighbors( neighbors ),
+  m_onDevice( onDevice ),
+  m_commID( CommunicationTools::reserveCommID() ),
+  m_ghostingVersion( -1 ),
+  m_neighborPlans(),
+  m_sendRequests(),
+  m_recvRequests()
+{
+  build();
+  verifyBufferSizes();
+}
+
+SyncPlan::~SyncPlan()
+{
+  freeRequests();
+  CommunicationTools::releaseCommID( m_commID );
+}
+
+bool SyncPlan::matches( std::map< string, string_array > const & fieldNames,
+                        MeshLevel const & mesh,
+                        bool onDevice ) const
+{
+  if( &mesh != &m_mesh || onDevice != m_onDevice || fieldNames.size() != m_fieldNames.size() )
+  {
+    return false;
+  }
+  for( auto const & entry : fieldNames )
+  {
+    auto const it = m_fieldNames.find( entry.first );
+    if( it == m_fieldNames.end() || it->second.size() != entry.second.size() )
+    {
+      return false;
+    }
+    for( localIndex i = 0; i < entry.second.size(); ++i )
+    {
+      if( it->second[i] != entry.second[i] )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void SyncPlan::freeRequests()
+{
+  for( localIndex i = 0; i < m_sendRequests.size(); ++i )
+  {
+    if( m_sendRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::Request_free( &m_sendRequests[i] );
+    }
+    if( m_recvRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::Request_free( &m_recvRequests[i] );
+    }
+  }
+}
+
+void SyncPlan::build()
+{
+  GEOSX_MARK_FUNCTION;
+
+  freeRequests();
+
+  m_ghostingVersion = m_mesh.ghostingVersion();
+
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( m_neighbors.size() );
+  m_neighborPlans.clear();
+  m_neighborPlans.resize( numNeighbors );
+  m_sendRequests.resize( numNeighbors );
+  m_recvRequests.resize( numNeighbors );
+
+  NodeManager & nodeManager = *m_mesh.getNodeManager();
+  EdgeManager & edgeManager = *m_mesh.getEdgeManager();
+  FaceManager & faceManager = *m_mesh.getFaceManager();
+  ElementRegionManager & elemManager = *m_mesh.getElemManager();
+
+  for( localIndex n = 0; n < numNeighbors; ++n )
+  {
+    NeighborCommunicator & neighbor = m_neighbors[n];
+    NeighborPlan & plan = m_neighborPlans[n];
+    int const neighborRank = neighbor.NeighborRank();
+
+    auto addObject = [&]( ObjectManagerBase & object, string_array const & names )
+    {
+      ObjectEntry entry;
+      entry.neighborData = &object.getNeighborData( neighborRank );
+      if( !m_onDevice )
+      {
+        plan.sendPacker.addIndexList( entry.neighborData->ghostsToSend() );
+        plan.recvPacker.addIndexList( entry.neighborData->ghostsToReceive() );
+      }
+      for( string const & name : names )
+      {
+        WrapperBase * const wrapper = object.getWrapperBase( name );
+        if( wrapper == nullptr )
+        {
+          continue;
+        }
+        if( !m_onDevice && ParallelPacker::canPack( *wrapper ) )
+        {
+          plan.sendPacker.addField( *wrapper );
+          plan.recvPacker.addField( *wrapper );
+        }
+        else
+        {
+          entry.wrappers.push_back( wrapper );
+        }
+      }
+      if( !entry.wrappers.empty() )
+      {
+        plan.objects.push_back( entry );
+      }
+    };
+
+    if( m_fieldNames.count( "node" ) > 0 )
+    {
+      addObject( nodeManager, m_fieldNames.at( "node" ) );
+    }
+    if( m_fieldNames.count( "edge" ) > 0 )
+    {
+      addObject( edgeManager, m_fieldNames.at( "edge" ) );
+    }
+    if( m_fieldNames.count( "face" ) > 0 )
+    {
+      addObject( faceManager, m_fieldNames.at( "face" ) );
+    }
+    if( m_fieldNames.count( "elems" ) > 0 )
+    {
+      elemManager.forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+      {
+        addObject( subRegion, m_fieldNames.at( "elems" ) );
+      } );
+    }
+
+    // Packed sizes only depend on the number of objects, so both sides are computed locally
+    localIndex sendSize = plan.sendPacker.packSize();
+    localIndex recvSize = plan.recvPacker.packSize();
+    for( ObjectEntry const & entry : plan.objects )
+    {
+      for( WrapperBase const * const wrapper : entry.wrappers )
+      {
+        sendSize += wrapper->PackByIndexSize( entry.neighborData->ghostsToSend(), false, m_onDevice );
+        recvSize += wrapper->PackByIndexSize( entry.neighborData->ghostsToReceive(), false, m_onDevice );
+      }
+    }
+    plan.sendBuffer.resize( sendSize );
+    plan.recvBuffer.resize( recvSize );
+
+    MpiWrapper::sendInit( plan.sendBuffer.data(),
+                          LvArray::integerConversion< int >( sendSize ),
+                          neighborRank,
+                          CommTag( MpiWrapper::Comm_rank(), neighborRank, m_commID ),
+                          MPI_COMM_GEOSX,
+                          &m_sendRequests[n] );
+
+    MpiWrapper::recvInit( plan.recvBuffer.data(),
+                          LvArray::integerConversion< int >( recvSize ),
+                          neighborRank,
+                          CommTag( neighborRank, MpiWrapper::Comm_rank(), m_commID ),
+                          MPI_COMM_GEOSX,
+                          &m_recvRequests[n] );
+  }
+}
+
+void SyncPlan::verifyBufferSizes()
+{
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( m_neighbors.size() );
+
+  array1d< int > sendSizes( numNeighbors );
+  array1d< int > recvSizes( numNeighbors );
+  array1d< MPI_Request > sendRequests( numNeighbors );
+  array1d< MPI_Request > recvRequests( numNeighbors );
+
+  for( localIndex n = 0; n < numNeighbors; ++n )
+  {
+    sendSizes[n] = LvArray::integerConversion< int >( m_neighborPlans[n].sendBuffer.size() );
+    m_neighbors[n].MPI_iSendReceive( &sendSizes[n], 1, sendRequests[n],
+                                     &recvSizes[n], 1, recvRequests[n],
+                                     m_commID, MPI_COMM_GEOSX );
+  }
+
+  MpiWrapper::Waitall( LvArray::integerConversion< int >( numNeighbors ), recvRequests.data(), MPI_STATUSES_IGNORE );
+  MpiWrapper::Waitall( LvArray::integerConversion< int >( numNeighbors ), sendRequests.data(), MPI_STATUSES_IGNORE );
+
+  for( localIndex n = 0; n < numNeighbors; ++n )
+  {
+    GEOSX_ERROR_IF_NE_MSG( recvSizes[n], LvArray::integerConversion< int >( m_neighborPlans[n].recvBuffer.size() ),
+                           "SyncPlan: buffer size mismatch with rank " << m_neighbors[n].NeighborRank() <<
+                           ", only fields with a fixed packed size per object can be synchronized with a plan" );
+  }
+}
+
+bool SyncPlan::upToDate() const
+{
+  return m_mesh.ghostingVersion() == m_ghostingVersion && m_neighbors.size() == m_neighborPlans.size();
+}
+
+void SyncPlan::start()
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the ghosting version changes collectively, so all neighbors rebuild and re-verify together
+  if( !upToDate() )
+  {
+    build();
+    verifyBufferSizes();
+  }
+
+  for( NeighborPlan & plan : m_neighborPlans )
+  {
+    buffer_unit_type * sendBufferPtr = plan.sendBuffer.data();
+    localIndex packedSize = plan.sendPacker.pack( sendBufferPtr );
+    for( ObjectEntry const & entry : plan.objects )
+    {
+      arrayView1d< localIndex const > const & ghostsToSend = entry.neighborData->ghostsToSend();
+      for( WrapperBase const * const wrapper : entry.wrappers )
+      {
+        packedSize += wrapper->PackByIndex( sendBufferPtr, ghostsToSend, false, m_onDevice );
+      }
+    }
+    GEOSX_ERROR_IF_NE( packedSize, LvArray::integerConversion< localIndex >( plan.sendBuffer.size() ) );
+  }
+
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighborPlans.size() );
+  MpiWrapper::Startall( numNeighbors, m_recvRequests.data() );
+  MpiWrapper::Startall( numNeighbors, m_sendRequests.data() );
+}
+
+void SyncPlan::finish()
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighborPlans.size() );
+
+  for( int count = 0; count < numNeighbors; ++count )
+  {
+    int neighborIndex;
+    MpiWrapper::Waitany( numNeighbors, m_recvRequests.data(), &neighborIndex, MPI_STATUS_IGNORE );
+
+    NeighborPlan & plan = m_neighborPlans[neighborIndex];
+    buffer_unit_type const * recvBufferPtr = plan.recvBuffer.data();
+    plan.recvPacker.unpack( recvBufferPtr );
+    for( ObjectEntry const & entry : plan.objects )
+    {
+      arrayView1d< localIndex const > const & ghostsToReceive = entry.neighborData->ghostsToReceive();
+      for( WrapperBase * const wrapper : entry.wrappers )
+      {
+        wrapper->UnpackByIndex( recvBufferPtr, ghostsToReceive, false, m_onDevice );
+      }
+    }
+  }
+
+  MpiWrapper::Waitall( numNeighbors, m_sendRequests.data(), MPI_STATUSES_IGNORE );
+}
+
+} /* namespace geosx */
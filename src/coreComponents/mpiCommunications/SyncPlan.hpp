@@ -0,0 +1,194 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SyncPlan.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_SYNCPLAN_HPP_
+#define GEOSX_MPICOMMUNICATIONS_SYNCPLAN_HPP_
+
+#include "MpiWrapper.hpp"
+#include "ParallelPacker.hpp"
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+class WrapperBase;
+}
+
+class MeshLevel;
+class NeighborCommunicator;
+class NeighborData;
+class ObjectManagerBase;
+
+/**
+ * @class SyncPlan
+ * @brief Precompiled ghost synchronization of a fixed set of fields.
+ *
+ * CommunicationTools::SynchronizeFields resolves wrappers by name, computes and
+ * exchanges buffer sizes and packs field names along with the data on every call.
+ * A SyncPlan does all of this once: it caches the resolved wrappers and ghost lists,
+ * sizes the buffers and creates persistent MPI requests, so that a synchronization
+ * only packs the data, starts the requests, waits and unpacks. On host, fields with
+ * contiguous index slices are packed with a ParallelPacker.
+ *
+ * The plan is keyed on the ghosting version of the mesh level: when the ghost lists
+ * are rebuilt, the plan resolves the wrappers and ghost lists again and re-verifies
+ * the buffer sizes with its neighbors. Only fields with a fixed packed size per object
+ * (e.g. arrays of numeric types) are supported, which is verified on every build.
+ */
+class SyncPlan
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param fieldNames names of the fields to synchronize, keyed by object type ("node", "edge", "face", "elems")
+   * @param mesh the mesh level holding the fields
+   * @param neighbors the neighbor communicators
+   * @param onDevice whether to pack/unpack on device
+   *
+   * @note Must be called collectively, since buffer sizes are verified with all neighbors.
+   */
+  SyncPlan( std::map< string, string_array > const & fieldNames,
+            MeshLevel & mesh,
+            std::vector< NeighborCommunicator > & neighbors,
+            bool onDevice = false );
+
+  /// Destructor, frees persistent requests.
+  ~SyncPlan();
+
+  /// Deleted copy constructor.
+  SyncPlan( SyncPlan const & ) = delete;
+
+  /// Deleted copy assignment.
+  SyncPlan & operator=( SyncPlan const & ) = delete;
+
+  /**
+   * @brief Synchronize the fields (blocking).
+   */
+  void execute()
+  {
+    start();
+    finish();
+  }
+
+  /**
+   * @brief Pack the send buffers and start all sends and receives.
+   * @note Must be called collectively if the ghost lists have changed since the last call.
+   */
+  void start();
+
+  /**
+   * @brief Wait for the receives, unpack them and wait for the sends to complete.
+   */
+  void finish();
+
+  /**
+   * @brief Get the names of the fields synchronized by this plan.
+   * @return the map of field names keyed by object type
+   */
+  std::map< string, string_array > const & fieldNames() const
+  { return m_fieldNames; }
+
+  /**
+   * @brief Check whether the plan synchronizes the given fields on the given mesh.
+   * @param fieldNames names of the fields keyed by object type
+   * @param mesh the mesh level holding the fields
+   * @param onDevice whether packing is done on device
+   * @return true if the plan can be used in place of a SynchronizeFields call with the same arguments
+   */
+  bool matches( std::map< string, string_array > const & fieldNames,
+                MeshLevel const & mesh,
+                bool onDevice ) const;
+
+private:
+
+  /// Fields of one object manager synchronized with one neighbor
+  struct ObjectEntry
+  {
+    /// Ghost lists of the object manager for the neighbor
+    NeighborData const * neighborData;
+
+    /// Resolved wrappers to synchronize that are not handled by the parallel packers
+    std::vector< dataRepository::WrapperBase * > wrappers;
+  };
+
+  /// Synchronization data for one neighbor
+  struct NeighborPlan
+  {
+    /// Objects with fields to synchronize
+    std::vector< ObjectEntry > objects;
+
+    /// Threaded packing of the fields with contiguous index slices (host only)
+    ParallelPacker sendPacker;
+
+    /// Threaded unpacking of the fields with contiguous index slices (host only)
+    ParallelPacker recvPacker;
+
+    /// Send buffer
+    buffer_type sendBuffer;
+
+    /// Receive buffer
+    buffer_type recvBuffer;
+  };
+
+  /// Resolve fields and ghost lists, size buffers and create persistent requests
+  void build();
+
+  /// Exchange send buffer sizes with neighbors and check them against local receive sizes
+  void verifyBufferSizes();
+
+  /// Check whether the ghost lists have changed since the plan was built
+  bool upToDate() const;
+
+  /// Free the persistent requests
+  void freeRequests();
+
+  /// Names of fields to synchronize
+  std::map< string, string_array > const m_fieldNames;
+
+  /// Mesh level holding the fields
+  MeshLevel & m_mesh;
+
+  /// Neighbor communicators
+  std::vector< NeighborCommunicator > & m_neighbors;
+
+  /// Whether to pack/unpack on device
+  bool const m_onDevice;
+
+  /// Communication ID (message tag) reserved for this plan
+  int m_commID;
+
+  /// Ghosting version of the mesh level when the plan was built
+  localIndex m_ghostingVersion;
+
+  /// Per-neighbor data
+  std::vector< NeighborPlan > m_neighborPlans;
+
+  /// Persistent send requests
+  array1d< MPI_Request > m_sendRequests;
+
+  /// Persistent receive requests
+  array1d< MPI_Request > m_recvRequests;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_SYNCPLAN_HPP_ */
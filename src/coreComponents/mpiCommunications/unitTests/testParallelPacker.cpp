@@ -0,0 +1,122 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "dataRepository/Group.hpp"
+#include "dataRepository/Wrapper.hpp"
+#include "managers/initialization.hpp"
+#include "mpiCommunications/ParallelPacker.hpp"
+
+using namespace geosx;
+using namespace dataRepository;
+
+namespace
+{
+
+constexpr localIndex numObjects = 10;
+
+struct Fields
+{
+  explicit Fields( std::string const & name ):
+    group( name, nullptr )
+  {
+    vectors = group.registerWrapper< array2d< real64 > >( "vectors" );
+    vectors->reference().resizeDimension< 1 >( 3 );
+    flags = group.registerWrapper< array1d< integer > >( "flags" );
+    transposed = group.registerWrapper< array2d< real64, RAJA::PERM_JI > >( "transposed" );
+    transposed->reference().resizeDimension< 1 >( 2 );
+    group.resize( numObjects );
+  }
+
+  Group group;
+  Wrapper< array2d< real64 > > * vectors;
+  Wrapper< array1d< integer > > * flags;
+  Wrapper< array2d< real64, RAJA::PERM_JI > > * transposed;
+};
+
+}
+
+TEST( testParallelPacker, canPack )
+{
+  Fields fields( "fields" );
+  EXPECT_TRUE( ParallelPacker::canPack( *fields.vectors ) );
+  EXPECT_TRUE( ParallelPacker::canPack( *fields.flags ) );
+  EXPECT_FALSE( ParallelPacker::canPack( *fields.transposed ) );
+}
+
+TEST( testParallelPacker, packUnpack )
+{
+  Fields source( "source" );
+  Fields target( "target" );
+
+  arrayView2d< real64 > const & sourceVectors = source.vectors->reference();
+  arrayView1d< integer > const & sourceFlags = source.flags->reference();
+  for( localIndex i = 0; i < numObjects; ++i )
+  {
+    for( localIndex j = 0; j < 3; ++j )
+    {
+      sourceVectors[i][j] = 10.0 * i + j;
+    }
+    sourceFlags[i] = LvArray::integerConversion< integer >( i );
+  }
+
+  array1d< localIndex > sendIndices( 3 );
+  sendIndices[0] = 1; sendIndices[1] = 4; sendIndices[2] = 7;
+  array1d< localIndex > recvIndices( 3 );
+  recvIndices[0] = 0; recvIndices[1] = 2; recvIndices[2] = 5;
+
+  ParallelPacker sendPacker;
+  sendPacker.addIndexList( sendIndices );
+  sendPacker.addField( *source.vectors );
+  sendPacker.addField( *source.flags );
+
+  ParallelPacker recvPacker;
+  recvPacker.addIndexList( recvIndices );
+  recvPacker.addField( *target.vectors );
+  recvPacker.addField( *target.flags );
+
+  localIndex const expectedSize = 3 * ( 3 * sizeof( real64 ) + sizeof( integer ) );
+  ASSERT_EQ( sendPacker.packSize(), expectedSize );
+  ASSERT_EQ( recvPacker.packSize(), expectedSize );
+
+  buffer_type buffer( expectedSize );
+  buffer_unit_type * sendPtr = buffer.data();
+  EXPECT_EQ( sendPacker.pack( sendPtr ), expectedSize );
+  EXPECT_EQ( sendPtr, buffer.data() + expectedSize );
+
+  buffer_unit_type const * recvPtr = buffer.data();
+  EXPECT_EQ( recvPacker.unpack( recvPtr ), expectedSize );
+  EXPECT_EQ( recvPtr, buffer.data() + expectedSize );
+
+  arrayView2d< real64 const > const & targetVectors = target.vectors->reference();
+  arrayView1d< integer const > const & targetFlags = target.flags->reference();
+  for( localIndex k = 0; k < 3; ++k )
+  {
+    for( localIndex j = 0; j < 3; ++j )
+    {
+      EXPECT_EQ( targetVectors[recvIndices[k]][j], sourceVectors[sendIndices[k]][j] );
+    }
+    EXPECT_EQ( targetFlags[recvIndices[k]], sourceFlags[sendIndices[k]] );
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,207 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "mpiCommunications/NeighborData.hpp"
+#include "mpiCommunications/SyncPlan.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 4}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{8}\""
+  "                  ny=\"{2}\""
+  "                  nz=\"{2}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+constexpr auto fieldName = "syncPlanTestField";
+
+void setupProblemFromXML( ProblemManager & problemManager, char const * const xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput, strlen( xmlInput ) );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  // partition along x, so that every rank has neighbors in parallel
+  int const mpiSize = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  Group * commandLine = problemManager.GetGroup< Group >( problemManager.groupKeys.commandLine );
+  commandLine->registerWrapper< integer >( problemManager.viewKeys.xPartitionsOverride.Key() )->
+    setApplyDefaultValue( mpiSize );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition * domain = problemManager.getDomainPartition();
+  MeshManager * meshManager = problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager->GenerateMeshLevels( domain );
+
+  ElementRegionManager * elementManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager->getName().c_str() );
+  elementManager->ProcessInputFileRecursive( topLevelNode );
+  elementManager->PostProcessInputRecursive();
+
+  problemManager.ProblemSetup();
+}
+
+real64 expectedValue( globalIndex const globalIndex, integer const pass )
+{
+  return 10.0 * globalIndex + pass;
+}
+
+}
+
+class SyncPlanTest : public ::testing::Test
+{
+public:
+
+  SyncPlanTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    domain = problemManager->getDomainPartition();
+    mesh = domain->getMeshBody( 0 )->getMeshLevel( 0 );
+
+    mesh->getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      subRegion.registerWrapper< array1d< real64 > >( fieldName );
+    } );
+  }
+
+  /// Set owned values for a pass and invalidate ghost values
+  void setValues( integer const pass )
+  {
+    mesh->getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      arrayView1d< real64 > const field = subRegion.getReference< array1d< real64 > >( fieldName );
+      arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex const > const & localToGlobal = subRegion.localToGlobalMap();
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        field[ei] = ghostRank[ei] < 0 ? expectedValue( localToGlobal[ei], pass ) : -1.0;
+      }
+    } );
+  }
+
+  /// Check that all values, owned and ghosted, are those of a pass
+  void checkValues( integer const pass )
+  {
+    mesh->getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      arrayView1d< real64 const > const field = subRegion.getReference< array1d< real64 > >( fieldName );
+      arrayView1d< globalIndex const > const & localToGlobal = subRegion.localToGlobalMap();
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        EXPECT_EQ( field[ei], expectedValue( localToGlobal[ei], pass ) ) << "element " << localToGlobal[ei];
+      }
+    } );
+  }
+
+  std::unique_ptr< ProblemManager > const problemManager;
+  DomainPartition * domain;
+  MeshLevel * mesh;
+};
+
+TEST_F( SyncPlanTest, synchronizeRepeatedly )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].push_back( fieldName );
+
+  SyncPlan plan( fieldNames, *mesh, domain->getNeighbors() );
+  EXPECT_TRUE( plan.matches( fieldNames, *mesh, false ) );
+  EXPECT_FALSE( plan.matches( fieldNames, *mesh, true ) );
+
+  for( integer pass = 0; pass < 3; ++pass )
+  {
+    setValues( pass );
+    plan.execute();
+    checkValues( pass );
+  }
+}
+
+TEST_F( SyncPlanTest, rebuildOnGhostingChange )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].push_back( fieldName );
+
+  SyncPlan plan( fieldNames, *mesh, domain->getNeighbors() );
+  setValues( 0 );
+  plan.execute();
+  checkValues( 0 );
+
+  // Rebuild the ghost lists in a different order and into new storage. Each rank reverses both its send
+  // and receive lists, so the lists stay consistent between neighbors while keeping their sizes.
+  mesh->getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+  {
+    for( NeighborCommunicator const & neighbor : domain->getNeighbors() )
+    {
+      NeighborData & neighborData = subRegion.getNeighborData( neighbor.NeighborRank() );
+      for( array1d< localIndex > * const list : { &neighborData.ghostsToSend(), &neighborData.ghostsToReceive() } )
+      {
+        array1d< localIndex > reversed( list->size() );
+        std::reverse_copy( list->data(), list->data() + list->size(), reversed.data() );
+        *list = std::move( reversed );
+      }
+    }
+  } );
+  localIndex const ghostingVersion = mesh->ghostingVersion();
+  mesh->ghostingModified();
+  EXPECT_EQ( mesh->ghostingVersion(), ghostingVersion + 1 );
+
+  for( integer pass = 1; pass < 3; ++pass )
+  {
+    setValues( pass );
+    plan.execute();
+    checkValues( pass );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -69,6 +69,13 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::krylovAdaptiveMaxIterString, &m_parameters.krylov.adaptiveMaxIterations )->
+    setApplyDefaultValue( m_parameters.krylov.adaptiveMaxIterations )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum iterations allowed for an iterative solver when the adaptive tolerance is weaker than "
+                    + std::string( viewKeyStruct::krylovTolString ) + ", typically in the first Newton iterations "
+                    "(0 to use " + std::string( viewKeyStruct::krylovMaxIterString ) + ")" );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString, &m_parameters.amg.numSweeps )->
     setApplyDefaultValue( m_parameters.amg.numSweeps )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -100,6 +107,31 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setApplyDefaultValue( m_parameters.ilu.threshold )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "ILU(T) threshold factor" );
+
+  registerWrapper( viewKeyStruct::precondRebuildIntervalString, &m_parameters.precondReuse.rebuildInterval )->
+    setApplyDefaultValue( m_parameters.precondReuse.rebuildInterval )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of linear solves served by a single preconditioner setup.\n"
+                    "Values above 1 apply the preconditioner through the native Krylov solvers; 1 rebuilds it for every solve" );
+
+  registerWrapper( viewKeyStruct::precondIterGrowthTolString, &m_parameters.precondReuse.iterGrowthTol )->
+    setApplyDefaultValue( m_parameters.precondReuse.iterGrowthTol )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "When reusing a preconditioner, force a rebuild once the Krylov iteration count exceeds "
+                    "that of the first solve after setup by this relative amount" );
+
+  registerWrapper( viewKeyStruct::reuseMatrixPatternString, &m_parameters.reuseMatrixPattern )->
+    setApplyDefaultValue( m_parameters.reuseMatrixPattern )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to only update the values of the parallel matrix when the sparsity pattern of the assembled system "
+                    "is unchanged, instead of re-creating it for every nonlinear iteration" );
+
+  registerWrapper( viewKeyStruct::usePointBlocksString, &m_parameters.usePointBlocks )->
+    setApplyDefaultValue( m_parameters.usePointBlocks )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to exploit the point-block structure of a system made of a single field (all the unknowns of a cell or node numbered "
+                    "consecutively): block-sparse storage of the parallel matrix with iterative solvers (PETSc), and "
+                    "unknown-based coarsening in AMG (hypre)" );
 }
 
 void LinearSolverParametersInput::PostProcessInput()
@@ -111,6 +143,10 @@ void LinearSolverParametersInput::PostProcessInput()
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.krylov.relTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.adaptiveMaxIterations, 0, "Invalid value of " << viewKeyStruct::krylovAdaptiveMaxIterString );
+
+  GEOSX_WARNING_IF( m_parameters.krylov.useAdaptiveTol && m_parameters.solverType == LinearSolverParameters::SolverType::direct,
+                    viewKeyStruct::krylovAdaptiveTolString << " has no effect with a direct solver" );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ilu.fill, 0, "Invalid value of " << viewKeyStruct::iluFillString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ilu.threshold, 0.0, "Invalid value of " << viewKeyStruct::iluThresholdString );
@@ -120,6 +156,9 @@ void LinearSolverParametersInput::PostProcessInput()
   GEOSX_ERROR_IF_GT_MSG( m_parameters.amg.threshold, 1.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
 
   // TODO input validation for other AMG parameters ?
+
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.precondReuse.rebuildInterval, 1, "Invalid value of " << viewKeyStruct::precondRebuildIntervalString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.precondReuse.iterGrowthTol, 0.0, "Invalid value of " << viewKeyStruct::precondIterGrowthTolString );
 }
 
 REGISTER_CATALOG_ENTRY( Group, LinearSolverParametersInput, std::string const &, Group * const )
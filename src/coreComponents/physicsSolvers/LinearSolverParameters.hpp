@@ -76,6 +76,7 @@ public:
     static constexpr auto krylovTolString         = "krylovTol";         ///< Krylov tolerance key
     static constexpr auto krylovAdaptiveTolString = "krylovAdaptiveTol"; ///< Krylov adaptive tolerance key
     static constexpr auto krylovWeakTolString     = "krylovWeakestTol";  ///< Krylov weakest tolerance key
+    static constexpr auto krylovAdaptiveMaxIterString = "krylovAdaptiveMaxIter"; ///< Krylov adaptive max iterations key
 
     static constexpr auto amgNumSweepsString = "amgNumSweeps";             ///< AMG number of sweeps key
     static constexpr auto amgSmootherString  = "amgSmootherType";          ///< AMG smoother type key
@@ -84,6 +85,12 @@ public:
 
     static constexpr auto iluFillString      = "iluFill";       ///< ILU fill key
     static constexpr auto iluThresholdString = "iluThreshold";  ///< ILU threshold key
+
+    static constexpr auto precondRebuildIntervalString = "precondRebuildInterval"; ///< Preconditioner rebuild interval key
+    static constexpr auto precondIterGrowthTolString   = "precondIterGrowthTol";   ///< Preconditioner iteration growth key
+
+    static constexpr auto reuseMatrixPatternString = "reuseMatrixPattern"; ///< Matrix pattern reuse flag key
+    static constexpr auto usePointBlocksString     = "usePointBlocks";     ///< Point-block structure flag key
   } viewKeys;
 
 private:
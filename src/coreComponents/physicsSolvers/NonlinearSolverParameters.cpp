@@ -99,6 +99,52 @@ NonlinearSolverParameters::NonlinearSolverParameters( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Maximum number of time sub-steps allowed for the solver" );
 
+  registerWrapper( viewKeysStruct::timeStepControlString, &m_timeStepControl )->
+    setApplyDefaultValue( TimeStepControl::NewtonIterations )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "How the size of the next time step is selected. Options are: \n "
+                    "* NewtonIterations - Double or halve the time step based on the number of Newton iterations of the last step "
+                    "(see dtIncIterLimit and dtCutIterLimit).\n"
+                    "* SolutionChange   - PID control of the time step based on the largest change of the primary variables over "
+                    "the last step, relative to the target changes of the solver. The time step is still halved when the Newton solver "
+                    "needs more than dtCutIterLimit. Solvers that do not measure the solution change fall back to NewtonIterations." );
+
+  registerWrapper( viewKeysStruct::newtonPredictionString, &m_newtonConvergencePrediction )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to stop the Newton loop and cut the time step when the last two residual reduction rates predict "
+                    "that the tolerance cannot be reached within newtonMaxIter iterations. The residual growing at a single "
+                    "iteration does not stop the loop." );
+
+  registerWrapper( viewKeysStruct::initialGuessOrderString, &m_initialGuessOrder )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Order of the extrapolation in time of the Newton initial guess from the increments of the previous "
+                    "steps: 0 starts from the previous converged state, 1 is linear and 2 is quadratic. The extrapolated "
+                    "guess is discarded if it increases the initial residual." );
+
+  registerWrapper( viewKeysStruct::totalNewtonIterationsString, &m_totalNewtonIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of Newton iterations performed by the solver." );
+
+  registerWrapper( viewKeysStruct::wastedNewtonIterationsString, &m_wastedNewtonIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of Newton iterations performed in time step attempts that were cut." );
+
+  registerWrapper( viewKeysStruct::numTimeStepCutsString, &m_numTimeStepCuts )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of time step cuts." );
+
+  registerWrapper( viewKeysStruct::totalLinearIterationsString, &m_totalLinearIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of linear solver iterations performed by the iterative solvers." );
+
+  registerWrapper( viewKeysStruct::savedLinearIterationsString, &m_savedLinearIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Estimated number of linear solver iterations saved by the adaptive linear tolerance." );
+
+  m_previousSolutionChange[0] = -1.0;
+  m_previousSolutionChange[1] = -1.0;
 
 
 }
@@ -109,6 +155,9 @@ void NonlinearSolverParameters::PostProcessInput()
   {
     GEOSX_ERROR( " dtIncIterLimit should be smaller than dtCutIterLimit!!" );
   }
+
+  GEOSX_ERROR_IF( m_initialGuessOrder < 0 || m_initialGuessOrder > 2,
+                  viewKeysStruct::initialGuessOrderString << " should be 0, 1 or 2" );
 }
 
 
@@ -82,6 +82,15 @@ public:
     static constexpr auto maxTimeStepCutsString         = "maxTimeStepCuts";
     static constexpr auto minNumNewtonIterationsString  = "minNumberOfNewtonIterations";
     static constexpr auto timeStepCutFactorString       = "timestepCutFactor";
+    static constexpr auto timeStepControlString         = "timeStepControl";
+    static constexpr auto newtonPredictionString        = "newtonConvergencePrediction";
+    static constexpr auto initialGuessOrderString       = "initialGuessExtrapolationOrder";
+
+    static constexpr auto totalNewtonIterationsString   = "totalNewtonIterations";
+    static constexpr auto wastedNewtonIterationsString  = "wastedNewtonIterations";
+    static constexpr auto numTimeStepCutsString         = "numTimeStepCuts";
+    static constexpr auto totalLinearIterationsString   = "totalLinearIterations";
+    static constexpr auto savedLinearIterationsString   = "adaptiveTolSavedLinearIterations";
 
   } viewKeys;
 
@@ -117,6 +126,15 @@ public:
     Require, ///< Use line search. If smaller residual than starting residual is not achieved, cut time step.
   };
 
+  /**
+   * @brief Indicates how the size of the next time step is selected.
+   */
+  enum class TimeStepControl : integer
+  {
+    NewtonIterations, ///< Grow or shrink the time step based on the number of Newton iterations of the last step
+    SolutionChange,   ///< PID control of the time step based on the change of the solution over the last step
+  };
+
   /// Flag to apply a line search.
   LineSearchAction m_lineSearchAction;
 
@@ -159,10 +177,39 @@ public:
   /// number of times that the time-step had to be cut
   integer m_numdtAttempts;
 
+  /// The strategy used to select the next time step
+  TimeStepControl m_timeStepControl;
+
+  /// Flag to stop the Newton loop as soon as the observed convergence rate cannot reach the tolerance
+  integer m_newtonConvergencePrediction;
+
+  /// Order of the extrapolation in time of the initial guess of the Newton loop (0 to disable)
+  integer m_initialGuessOrder;
+
+  /// Solution change ratios of the two previously accepted steps, used by the PID time step control
+  real64 m_previousSolutionChange[2];
+
+  /// Total number of Newton iterations performed by the solver
+  integer m_totalNewtonIterations;
+
+  /// Number of Newton iterations performed in time step attempts that were cut
+  integer m_wastedNewtonIterations;
+
+  /// Total number of time step cuts
+  integer m_numTimeStepCuts;
+
+  /// Total number of linear solver iterations performed by the iterative solvers
+  integer m_totalLinearIterations;
+
+  /// Estimated number of linear solver iterations saved by the adaptive linear tolerance
+  integer m_savedLinearIterations;
+
 };
 
 ENUM_STRINGS( NonlinearSolverParameters::LineSearchAction, "None", "Attempt", "Require" )
 
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControl, "NewtonIterations", "SolutionChange" )
+
 } /* namespace geosx */
 
 #endif /* GEOSX_PHYSICSSOLVERS_NONLINEARSOLVERPARAMETERS_HPP_ */
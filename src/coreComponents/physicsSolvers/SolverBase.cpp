@@ -15,6 +15,7 @@
 #include "SolverBase.hpp"
 #include "PhysicsSolverManager.hpp"
 
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
@@ -32,9 +33,21 @@ SolverBase::SolverBase( std::string const & name,
   m_cflFactor(),
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
+  m_solutionChangeRatio( -1.0 ),
   m_dofManager( name ),
+  m_krylovSolverType( LinearSolverParameters::SolverType::direct ),
+  m_krylovSolverMatrix( nullptr ),
+  m_krylovSolverPrecond( nullptr ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString, this ),
-  m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString, this )
+  m_krylovAdaptiveTol( 0.0 ),
+  m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString, this ),
+  m_stepIncrementDt{ 0.0, 0.0, 0.0 },
+  m_currentStepIncrement( 0 ),
+  m_numStepIncrements( 0 ),
+  m_stepIncrementRankOffset( -1 ),
+  m_isInitialGuessPending( false ),
+  m_initialResidualNorm( 0.0 ),
+  m_lastInitialResidualNorm( 0.0 )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -179,12 +192,77 @@ void SolverBase::Execute( real64 const time_n,
   SetNextDt( nextDt, m_nextDt );
 }
 
+void SolverBase::ReportSolverStatistics() const
+{
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+  if( params.m_totalNewtonIterations > 0 )
+  {
+    GEOSX_LOG_RANK_0( getName() << ": " << params.m_totalNewtonIterations << " Newton iterations, "
+                                << params.m_wastedNewtonIterations << " of which wasted in "
+                                << params.m_numTimeStepCuts << " time step cuts" );
+  }
+  if( params.m_totalLinearIterations > 0 )
+  {
+    GEOSX_LOG_RANK_0( getName() << ": " << params.m_totalLinearIterations << " linear iterations"
+                                << ( m_linearSolverParameters.get().krylov.useAdaptiveTol
+                                     ? ", about " + std::to_string( params.m_savedLinearIterations ) + " saved by the adaptive tolerance"
+                                     : string() ) );
+  }
+}
+
 void SolverBase::SetNextDt( real64 const & currentDt,
                             real64 & nextDt )
 {
+  if( m_nonlinearSolverParameters.m_timeStepControl == NonlinearSolverParameters::TimeStepControl::SolutionChange )
+  {
+    if( m_solutionChangeRatio >= 0.0 )
+    {
+      SetNextDtBasedOnSolutionChange( currentDt, nextDt );
+      return;
+    }
+    GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": solution change not measured, time-step selected from the Newton iterations." );
+  }
   SetNextDtBasedOnNewtonIter( currentDt, nextDt );
 }
 
+void SolverBase::SetNextDtBasedOnSolutionChange( real64 const & currentDt,
+                                                 real64 & nextDt )
+{
+  // PID gains of Valli, Carey and Coutinho (2005), "Control strategies for timestep selection in finite element
+  // simulation of incompressible flows and coupled reaction-convection-diffusion processes"
+  real64 const kP = 0.075;
+  real64 const kI = 0.175;
+  real64 const kD = 0.01;
+  real64 const minFactor = 0.2;
+  real64 const maxFactor = 2.0;
+
+  // the ratio is bounded away from zero, a solution that barely changes lets the time-step grow by maxFactor
+  real64 ( &previousChange )[2] = m_nonlinearSolverParameters.m_previousSolutionChange;
+  real64 const change = std::max( m_solutionChangeRatio, 1e-3 );
+  real64 const lastChange = previousChange[0] > 0.0 ? previousChange[0] : change;
+  real64 const secondLastChange = previousChange[1] > 0.0 ? previousChange[1] : lastChange;
+
+  real64 factor = std::pow( lastChange / change, kP )
+                  * std::pow( 1.0 / change, kI )
+                  * std::pow( lastChange * lastChange / ( change * secondLastChange ), kD );
+  factor = std::min( std::max( factor, minFactor ), maxFactor );
+
+  // the Newton iterations still limit the time-step when the convergence is difficult
+  if( m_nonlinearSolverParameters.m_numNewtonIterations > m_nonlinearSolverParameters.dtCutIterLimit() )
+  {
+    factor = std::min( factor, 0.5 );
+  }
+  nextDt = factor * currentDt;
+
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": solution change ratio = " << m_solutionChangeRatio
+                                       << ", time-step required will be scaled by " << factor << "." );
+
+  // the ratio is consumed, so that a step that does not measure it falls back to the Newton iterations
+  previousChange[1] = previousChange[0];
+  previousChange[0] = change;
+  m_solutionChangeRatio = -1.0;
+}
+
 void SolverBase::SetNextDtBasedOnNewtonIter( real64 const & currentDt,
                                              real64 & nextDt )
 {
@@ -240,7 +318,7 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
                            m_localRhs.toView() );
 
   // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-  m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  ComposeParallelMatrix();
   m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
   m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
@@ -308,6 +386,7 @@ bool SolverBase::LineSearch( real64 const & time_n,
     }
 
     ApplySystemSolution( dofManager, localSolution, localScaleFactor, domain );
+    AccumulateStepIncrement( localSolution, localScaleFactor );
 
     // re-assemble system
     localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
@@ -392,6 +471,196 @@ real64 SolverBase::EisenstatWalker( real64 const newNewtonNorm,
   return krylovTol;
 }
 
+void SolverBase::UpdateAdaptiveLinearTolerance( real64 const newNewtonNorm,
+                                                real64 const oldNewtonNorm )
+{
+  LinearSolverParameters::Krylov const & krylovParams = m_linearSolverParameters.get().krylov;
+  if( krylovParams.useAdaptiveTol )
+  {
+    m_krylovAdaptiveTol = EisenstatWalker( newNewtonNorm, oldNewtonNorm, krylovParams.weakestTol );
+  }
+}
+
+bool SolverBase::ApplyAdaptiveTolerance( real64 const adaptiveTol,
+                                         LinearSolverParameters & params )
+{
+  if( adaptiveTol <= 0.0 || params.solverType == LinearSolverParameters::SolverType::direct )
+  {
+    return false;
+  }
+
+  bool const isCapped = adaptiveTol > params.krylov.relTolerance && params.krylov.adaptiveMaxIterations > 0;
+  params.krylov.relTolerance = adaptiveTol;
+  if( isCapped )
+  {
+    params.krylov.maxIterations = std::min( params.krylov.maxIterations, params.krylov.adaptiveMaxIterations );
+  }
+  return isCapped;
+}
+
+LinearSolverParameters SolverBase::NextLinearSolverParameters( bool & isCapped )
+{
+  LinearSolverParameters params = m_linearSolverParameters.get();
+  isCapped = ApplyAdaptiveTolerance( m_krylovAdaptiveTol, params );
+  m_krylovAdaptiveTol = 0.0;
+  return params;
+}
+
+void SolverBase::ComputeInitialGuessWeights( integer const order,
+                                             real64 const dt,
+                                             real64 const lastDt,
+                                             real64 const secondLastDt,
+                                             real64 & lastWeight,
+                                             real64 & secondLastWeight )
+{
+  lastWeight = dt / lastDt;
+  secondLastWeight = 0.0;
+  if( order > 1 )
+  {
+    real64 const slope = ( lastDt + dt ) / ( lastDt + secondLastDt );
+    lastWeight = dt * ( 1.0 + slope ) / lastDt;
+    secondLastWeight = -dt * slope / secondLastDt;
+  }
+}
+
+void SolverBase::ApplyExtrapolatedInitialGuess( real64 const & dt,
+                                                DomainPartition & domain )
+{
+  m_isInitialGuessPending = false;
+
+  // the DoFs are renumbered at every step, the stored increments are only used if the numbering did not change
+  localIndex const numLocalDofs = m_dofManager.numLocalDofs();
+  if( m_stepIncrementRankOffset != m_dofManager.rankOffset()
+      || m_stepIncrements[( m_currentStepIncrement + 2 ) % 3].size() != numLocalDofs )
+  {
+    m_numStepIncrements = 0;
+    m_stepIncrementRankOffset = m_dofManager.rankOffset();
+  }
+
+  array1d< real64 > & increment = m_stepIncrements[m_currentStepIncrement];
+  increment.resize( numLocalDofs );
+  increment.setValues< parallelDevicePolicy<> >( 0.0 );
+
+  integer const order = std::min( m_nonlinearSolverParameters.m_initialGuessOrder, m_numStepIncrements );
+  if( order == 0 )
+  {
+    return;
+  }
+
+  // the rates of change over the last steps are assigned to the middle of the steps, the quadratic
+  // extrapolation then extrapolates them linearly to the middle of the new step
+  integer const last = ( m_currentStepIncrement + 2 ) % 3;
+  integer const secondLast = order > 1 ? ( m_currentStepIncrement + 1 ) % 3 : last;
+  real64 const lastDt = m_stepIncrementDt[last];
+  real64 const secondLastDt = m_stepIncrementDt[secondLast];
+
+  real64 lastWeight, secondLastWeight;
+  ComputeInitialGuessWeights( order, dt, lastDt, secondLastDt, lastWeight, secondLastWeight );
+
+  arrayView1d< real64 > const & guess = increment.toView();
+  arrayView1d< real64 const > const & lastIncrement = m_stepIncrements[last].toViewConst();
+  arrayView1d< real64 const > const & secondLastIncrement = m_stepIncrements[secondLast].toViewConst();
+  forAll< parallelDevicePolicy<> >( guess.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    guess[i] = lastWeight * lastIncrement[i] + secondLastWeight * secondLastIncrement[i];
+  } );
+
+  if( !CheckSystemSolution( domain, m_dofManager, increment.toViewConst(), 1.0 ) )
+  {
+    GEOSX_LOG_LEVEL_RANK_0( 1, "    Extrapolated initial guess failed the solution check. Starting from the previous state." );
+    increment.setValues< parallelDevicePolicy<> >( 0.0 );
+    return;
+  }
+
+  ApplySystemSolution( m_dofManager, increment.toViewConst(), 1.0, domain );
+  m_isInitialGuessPending = true;
+}
+
+bool SolverBase::CheckInitialGuess( real64 const residualNorm,
+                                    DomainPartition & domain )
+{
+  if( m_isInitialGuessPending )
+  {
+    m_isInitialGuessPending = false;
+    // the residual of the previous state is not assembled again, the initial residual of the last step stands for it
+    if( residualNorm >= m_lastInitialResidualNorm )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 1, "    Extrapolated initial guess did not reduce the initial residual of the last step ( "
+                              << m_lastInitialResidualNorm << " ). Starting from the previous state." );
+      ResetStateToBeginningOfStep( domain );
+      m_stepIncrements[m_currentStepIncrement].setValues< parallelDevicePolicy<> >( 0.0 );
+      return false;
+    }
+    GEOSX_LOG_LEVEL_RANK_0( 1, "    Extrapolated initial guess: ( R ) = ( " << m_lastInitialResidualNorm << " ) -> ( " << residualNorm << " )" );
+  }
+  m_initialResidualNorm = residualNorm;
+  return true;
+}
+
+void SolverBase::AccumulateStepIncrement( arrayView1d< real64 const > const & localSolution,
+                                          real64 const scale )
+{
+  arrayView1d< real64 > const & increment = m_stepIncrements[m_currentStepIncrement].toView();
+  if( m_nonlinearSolverParameters.m_initialGuessOrder == 0 || increment.size() != localSolution.size() )
+  {
+    return;
+  }
+
+  forAll< parallelDevicePolicy<> >( increment.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    increment[i] += scale * localSolution[i];
+  } );
+}
+
+void SolverBase::RecordStepIncrement( real64 const & dt,
+                                      bool const isConverged )
+{
+  if( m_nonlinearSolverParameters.m_initialGuessOrder == 0 )
+  {
+    return;
+  }
+
+  if( !isConverged )
+  {
+    m_numStepIncrements = 0;
+    return;
+  }
+
+  m_stepIncrementDt[m_currentStepIncrement] = dt;
+  m_lastInitialResidualNorm = m_initialResidualNorm;
+  m_currentStepIncrement = ( m_currentStepIncrement + 1 ) % 3;
+  m_numStepIncrements = std::min( m_numStepIncrements + 1, 2 );
+}
+
+bool SolverBase::IsConvergenceExpected( real64 const secondLastResidual,
+                                        real64 const lastResidual,
+                                        real64 const residualNorm,
+                                        real64 const newtonTol,
+                                        integer const remainingIter )
+{
+  real64 const lastRate = lastResidual / secondLastResidual;
+  real64 const rate = residualNorm / lastResidual;
+
+  // a single increase of the residual, e.g. before the iterates enter the region of fast convergence, does not
+  // show divergence, and the order of convergence can't be estimated from a single decrease
+  if( rate >= 1.0 || lastRate >= 1.0 )
+  {
+    return rate < 1.0 || lastRate < 1.0;
+  }
+
+  // order of convergence estimated from the last two rates, between linear and the quadratic convergence of Newton's method
+  real64 const order = std::min( std::max( std::log( rate ) / std::log( lastRate ), 1.0 ), 2.0 );
+
+  real64 predictedRate = rate;
+  real64 predictedResidual = residualNorm;
+  for( integer iter = 0; iter < remainingIter && predictedResidual >= newtonTol; ++iter )
+  {
+    predictedRate = std::pow( predictedRate, order );
+    predictedResidual *= predictedRate;
+  }
+  return predictedResidual < newtonTol;
+}
+
 real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
                                           real64 const & dt,
                                           integer const cycleNumber,
@@ -426,11 +695,20 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
       ResetStateToBeginningOfStep( domain );
     }
 
+    if( m_nonlinearSolverParameters.m_initialGuessOrder > 0 )
+    {
+      ApplyExtrapolatedInitialGuess( stepDt, domain );
+    }
+
     // keep residual from previous iteration in case we need to do a line search
     real64 lastResidual = 1e99;
+    real64 secondLastResidual = 1e99;
     integer & newtonIter = m_nonlinearSolverParameters.m_numNewtonIterations;
     real64 scaleFactor = 1.0;
 
+    // number of linear solves performed in this attempt
+    integer numAttemptIterations = 0;
+
     // main Newton loop
     for( newtonIter = 0; newtonIter < maxNewtonIter; ++newtonIter )
     {
@@ -441,31 +719,37 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
         std::cout << output << std::endl;
       }
 
-      // zero out matrix/rhs before assembly
-      m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
-      m_localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
-
-      // call assemble to fill the matrix and the rhs
-      AssembleSystem( time_n,
-                      stepDt,
-                      domain,
-                      m_dofManager,
-                      m_localMatrix.toViewConstSizes(),
-                      m_localRhs.toView() );
-
-      // apply boundary conditions to system
-      ApplyBoundaryConditions( time_n,
-                               stepDt,
-                               domain,
-                               m_dofManager,
-                               m_localMatrix.toViewConstSizes(),
-                               m_localRhs.toView() );
-
-      // TODO: maybe add scale function here?
-      // Scale()
-
-      // get residual norm
-      real64 residualNorm = CalculateResidualNorm( domain, m_dofManager, m_localRhs.toViewConst() );
+      real64 residualNorm;
+      // the system is assembled again from the previous state if the extrapolated initial guess is rejected
+      do
+      {
+        // zero out matrix/rhs before assembly
+        m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+        m_localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
+
+        // call assemble to fill the matrix and the rhs
+        AssembleSystem( time_n,
+                        stepDt,
+                        domain,
+                        m_dofManager,
+                        m_localMatrix.toViewConstSizes(),
+                        m_localRhs.toView() );
+
+        // apply boundary conditions to system
+        ApplyBoundaryConditions( time_n,
+                                 stepDt,
+                                 domain,
+                                 m_dofManager,
+                                 m_localMatrix.toViewConstSizes(),
+                                 m_localRhs.toView() );
+
+        // TODO: maybe add scale function here?
+        // Scale()
+
+        // get residual norm
+        residualNorm = CalculateResidualNorm( domain, m_dofManager, m_localRhs.toViewConst() );
+      }
+      while( newtonIter == 0 && !CheckInitialGuess( residualNorm, domain ) );
 
       if( getLogLevel() >= 1 && logger::internal::rank==0 )
       {
@@ -527,15 +811,22 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
         }
       }
 
-      // if using adaptive Krylov tolerance scheme, update tolerance.
-      LinearSolverParameters::Krylov & krylovParams = m_linearSolverParameters.get().krylov;
-      if( krylovParams.useAdaptiveTol )
+      // stop early if the last residual reduction rates predict that the tolerance cannot be reached in the remaining iterations
+      if( m_nonlinearSolverParameters.m_newtonConvergencePrediction > 0 && newtonIter > 1 && residualNorm >= newtonTol )
       {
-        krylovParams.relTolerance = EisenstatWalker( residualNorm, lastResidual, krylovParams.weakestTol );
+        integer const remainingIter = maxNewtonIter - 1 - newtonIter;
+        if( !IsConvergenceExpected( secondLastResidual, lastResidual, residualNorm, newtonTol, remainingIter ) )
+        {
+          GEOSX_LOG_LEVEL_RANK_0( 1, "        Convergence not expected within " << maxNewtonIter << " iterations. Exiting Newton Loop." );
+          break;
+        }
       }
 
+      // if using adaptive Krylov tolerance scheme, update tolerance.
+      UpdateAdaptiveLinearTolerance( residualNorm, lastResidual );
+
       // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-      m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+      ComposeParallelMatrix();
       m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
       m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
@@ -544,6 +835,7 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
 
       // Solve the linear system
       SolveSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+      ++numAttemptIterations;
 
       // Output the linear system solution for debugging purposes
       DebugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
@@ -563,16 +855,23 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
 
       // apply the system solution to the fields/variables
       ApplySystemSolution( m_dofManager, m_localSolution, scaleFactor, domain );
+      AccumulateStepIncrement( m_localSolution, scaleFactor );
 
+      secondLastResidual = lastResidual;
       lastResidual = residualNorm;
     }
 
+    m_nonlinearSolverParameters.m_totalNewtonIterations += numAttemptIterations;
+
     if( isConverged )
     {
       break; // out of outer loop
     }
     else
     {
+      m_nonlinearSolverParameters.m_wastedNewtonIterations += numAttemptIterations;
+      ++m_nonlinearSolverParameters.m_numTimeStepCuts;
+
       // cut timestep, go back to beginning of step and restart the Newton loop
       stepDt *= dtCutFactor;
       GEOSX_LOG_LEVEL_RANK_0 ( 1, "New dt = " <<  stepDt );
@@ -593,6 +892,8 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
     }
   }
 
+  RecordStepIncrement( stepDt, isConverged );
+
   // return the achieved timestep
   return stepDt;
 }
@@ -778,11 +1079,24 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
 //  std::cout<<rhs<<std::endl<<std::endl;
 //  }
 
-  LinearSolverParameters const & params = m_linearSolverParameters.get();
-
-  // TODO: We probably want to keep an instance of linear solver as a member of physics solver
-  //       so we can have constant access to last solve statistics, convergence history, etc.
-  //       This requires unifying "LAI interface" solvers with "native" Krylov solvers somehow.
+  // the adaptive tolerance of the Newton loop, if any, replaces the fixed tolerance for all iterative solvers
+  real64 const fixedTol = m_linearSolverParameters.get().krylov.relTolerance;
+  bool const useAdaptiveTol = m_krylovAdaptiveTol > 0.0 &&
+                              m_linearSolverParameters.get().solverType != LinearSolverParameters::SolverType::direct;
+  bool isCapped;
+  LinearSolverParameters const params = NextLinearSolverParameters( isCapped );
+
+  LinearSolverParameters::PrecondReuse const & reuse = params.precondReuse;
+
+  // The backend solvers set up their preconditioner for every solve and do not provide the
+  // single-reduction methods, so in those cases the preconditioner is created from the same
+  // parameters and applied through the "native" Krylov solvers instead
+  bool const nativeOnly = params.solverType == LinearSolverParameters::SolverType::pipecg ||
+                          params.solverType == LinearSolverParameters::SolverType::srgmres;
+  if( params.solverType != LinearSolverParameters::SolverType::direct && !m_precond && ( reuse.rebuildInterval > 1 || nativeOnly ) )
+  {
+    m_precond = LAInterface::createPreconditioner( params );
+  }
 
   if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
   {
@@ -792,10 +1106,53 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   }
   else
   {
-    m_precond->compute( matrix, dofManager );
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
-    solver->solve( rhs, solution );
-    m_linearSolverResult = solver->result();
+    // Decide whether the current preconditioner can serve this solve
+    bool const compatible = m_precond->ready() &&
+                            m_precond->numGlobalRows() == matrix.numGlobalRows() &&
+                            m_precondMatrix != nullptr;
+
+    Stopwatch watch;
+    if( m_precondReuse.canReuse( reuse, compatible ) )
+    {
+      m_precondReuse.recordReuse();
+    }
+    else
+    {
+      SetupPreconditioner( matrix, dofManager );
+    }
+    real64 setupTime = watch.elapsedTime();
+
+    // The solver holds references to operators, so only recreate it when those (or the method) change
+    if( !m_krylovSolver ||
+        m_krylovSolverType != params.solverType ||
+        m_krylovSolverMatrix != &matrix ||
+        m_krylovSolverPrecond != m_precond.get() )
+    {
+      m_krylovSolver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
+      m_krylovSolverType = params.solverType;
+      m_krylovSolverMatrix = &matrix;
+      m_krylovSolverPrecond = m_precond.get();
+    }
+    m_krylovSolver->setTolerance( params.krylov.relTolerance );
+    m_krylovSolver->setMaxIterations( params.krylov.maxIterations );
+    m_krylovSolver->solve( rhs, solution );
+
+    // A stale preconditioner that fails to converge gets one more chance after a full rebuild,
+    // unless the solve was only stopped by the iteration cap of a relaxed tolerance
+    if( m_precondReuse.age() > 0 && !m_krylovSolver->result().success() && !isCapped )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 1, "        Reused preconditioner failed, rebuilding and re-solving" );
+      watch.zero();
+      SetupPreconditioner( matrix, dofManager );
+      setupTime += watch.elapsedTime();
+      solution.zero();
+      m_krylovSolver->solve( rhs, solution );
+    }
+
+    m_linearSolverResult = m_krylovSolver->result();
+    m_linearSolverResult.setupTime = setupTime;
+    m_linearSolverResult.precondAge = m_precondReuse.age();
+    m_precondReuse.recordSolve( reuse, m_linearSolverResult.numIterations );
   }
 
   //  Keep for debugging comparisons
@@ -807,7 +1164,85 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
 //  ++count;
 
 
-  GEOSX_WARNING_IF( !m_linearSolverResult.success(), "Linear solution failed" );
+  if( params.solverType != LinearSolverParameters::SolverType::direct )
+  {
+    integer const numIterations = m_linearSolverResult.numIterations;
+    m_nonlinearSolverParameters.m_totalLinearIterations += numIterations;
+
+    // estimate the iterations a solve to the fixed tolerance would have taken at the observed convergence rate
+    real64 const reduction = m_linearSolverResult.residualReduction;
+    if( useAdaptiveTol && numIterations > 0 && reduction > 0.0 && reduction < 1.0 )
+    {
+      real64 const rate = std::pow( reduction, 1.0 / numIterations );
+      integer const fixedTolIterations = static_cast< integer >( std::ceil( std::log( fixedTol ) / std::log( rate ) ) );
+      m_nonlinearSolverParameters.m_savedLinearIterations += fixedTolIterations - numIterations;
+      GEOSX_LOG_LEVEL_RANK_0( 1, "        Adaptive linear tolerance " << params.krylov.relTolerance << ": " << numIterations
+                                                                      << " iterations, about " << fixedTolIterations
+                                                                      << " with the fixed tolerance " << fixedTol );
+    }
+  }
+
+  // a relaxed solve stopped by its iteration cap still provides a usable inexact Newton direction
+  GEOSX_WARNING_IF( !m_linearSolverResult.success() &&
+                    !( isCapped && m_linearSolverResult.status == LinearSolverResult::Status::NotConverged ),
+                    "Linear solution failed" );
+}
+
+void SolverBase::ComposeParallelMatrix()
+{
+  GEOSX_MARK_FUNCTION;
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  localIndex const blockSize = PointBlockSize( params, m_dofManager );
+
+  if( params.reuseMatrixPattern )
+  {
+    m_matrix.createOrUpdate( m_localMatrix.toViewConst(), blockSize, MPI_COMM_GEOSX );
+  }
+  else
+  {
+    m_matrix.create( m_localMatrix.toViewConst(), blockSize, MPI_COMM_GEOSX );
+  }
+}
+
+localIndex SolverBase::PointBlockSize( LinearSolverParameters const & params,
+                                       DofManager const & dofManager )
+{
+  // the direct solvers of the backends require scalar storage
+  if( !params.usePointBlocks || params.solverType == LinearSolverParameters::SolverType::direct || params.dofsPerNode <= 1 )
+  {
+    return 1;
+  }
+
+  // the DofManager only numbers the unknowns of a support point consecutively within a field
+  array1d< localIndex > const numComponents = dofManager.numComponentsPerField();
+  GEOSX_ERROR_IF( numComponents.size() != 1 || numComponents[0] != params.dofsPerNode,
+                  "usePointBlocks requires a single field with " << params.dofsPerNode << " components (dofsPerNode), "
+                                                                 << "but the linear system has " << numComponents.size()
+                                                                 << " field(s) with " << dofManager.numComponents() << " components in total" );
+  return params.dofsPerNode;
+}
+
+void SolverBase::SetupPreconditioner( ParallelMatrix const & matrix,
+                                      DofManager const & dofManager )
+{
+  LinearSolverParameters::PrecondReuse const & reuse = m_linearSolverParameters.get().precondReuse;
+
+  if( reuse.rebuildInterval > 1 )
+  {
+    // A frozen preconditioner outlives the system matrix, which is re-created or updated every
+    // nonlinear iteration, so it is computed from a private copy. The previous copy
+    // is released only after the new setup, since some backends reference it until then.
+    std::unique_ptr< ParallelMatrix > precondMatrix = std::make_unique< ParallelMatrix >( matrix );
+    m_precond->compute( *precondMatrix, dofManager );
+    m_precondMatrix = std::move( precondMatrix );
+  }
+  else
+  {
+    m_precond->compute( matrix, dofManager );
+    m_precondMatrix.reset();
+  }
+  m_precondReuse.recordSetup();
 }
 
 bool SolverBase::CheckSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
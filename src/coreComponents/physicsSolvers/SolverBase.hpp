@@ -19,7 +19,9 @@
 #include "common/DataTypes.hpp"
 #include "dataRepository/ExecutableGroup.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
+#include "linearAlgebra/utilities/PreconditionerReusePolicy.hpp"
 #include "linearAlgebra/DofManager.hpp"
 #include "managers/DomainPartition.hpp"
 #include "mesh/MeshBody.hpp"
@@ -66,6 +68,14 @@ public:
                         real64 const eventProgress,
                         dataRepository::Group * const domain ) override;
 
+  /**
+   * @brief Report the nonlinear and linear solver statistics accumulated over the run.
+   *
+   * Called for every solver at the end of the simulation, whether the solver was the target of an
+   * event or driven by a coupled solver.
+   */
+  void ReportSolverStatistics() const;
+
   /**
    * @brief Getter for system matrix
    * @return a reference to linear system matrix of this solver
@@ -162,6 +172,37 @@ public:
   void SetNextDtBasedOnNewtonIter( real64 const & currentDt,
                                    real64 & nextDt );
 
+  /**
+   * @brief Set the next time step with a PID controller on the change of the solution over the last step.
+   * @param [in]  currentDt the time step that was achieved during the last step
+   * @param [out] nextDt the time step requested for the next step
+   *
+   * The controller drives the ratio between the largest change of the primary variables and its
+   * target (see m_solutionChangeRatio) towards one, using the ratios of the last three accepted steps.
+   */
+  void SetNextDtBasedOnSolutionChange( real64 const & currentDt,
+                                       real64 & nextDt );
+
+
+  /**
+   * @brief Compute the weights of the increments of the last two steps in the extrapolated initial guess.
+   * @param [in] order the order of the extrapolation in time, 1 (linear) or 2 (quadratic)
+   * @param [in] dt the size of the new step
+   * @param [in] lastDt the size of the last step
+   * @param [in] secondLastDt the size of the second to last step, unused for a linear extrapolation
+   * @param [out] lastWeight the weight of the increment of the last step
+   * @param [out] secondLastWeight the weight of the increment of the second to last step
+   *
+   * The mean rates of change over the last steps are assigned to the middle of the steps. The linear
+   * extrapolation keeps the last rate, the quadratic extrapolation extrapolates the rates linearly to the
+   * middle of the new step, which is exact for a solution quadratic in time.
+   */
+  static void ComputeInitialGuessWeights( integer const order,
+                                          real64 const dt,
+                                          real64 const lastDt,
+                                          real64 const secondLastDt,
+                                          real64 & lastWeight,
+                                          real64 & secondLastWeight );
 
   /**
    * @brief Entry function for an explicit time integration step
@@ -513,6 +554,14 @@ public:
   real64 GetTimestepRequest()
   {return m_nextDt;};
 
+  /**
+   * @copydoc ExecutableGroup::IsTimestepRequestRankInvariant()
+   * @note The next timestep is selected from the Newton iterations and from globally reduced
+   *       solution changes. Solvers setting it from rank-local data must override this method.
+   */
+  virtual bool IsTimestepRequestRankInvariant() const override
+  { return true; }
+
   virtual Group * CreateChild( string const & childKey, string const & childName ) override;
 
   using CatalogInterface = dataRepository::CatalogInterface< SolverBase, std::string const &, Group * const >;
@@ -660,10 +709,83 @@ public:
 
 protected:
 
+  /**
+   * @brief Predict whether the Newton loop can reach its tolerance from the last residual reduction rates.
+   * @param secondLastResidual the residual norm two iterations ago
+   * @param lastResidual the residual norm at the previous iteration
+   * @param residualNorm the current residual norm
+   * @param newtonTol the tolerance of the Newton loop
+   * @param remainingIter the number of remaining iterations
+   * @return @p false if the tolerance is not expected to be reached in @p remainingIter iterations
+   *
+   * The order of convergence is estimated from the last two reduction rates as
+   * log( r_{k+1} / r_k ) / log( r_k / r_{k-1} ), bounded between 1 and 2. Convergence is only
+   * ruled out by a single rate greater than one if the previous rate was greater than one too.
+   */
+  static bool IsConvergenceExpected( real64 const secondLastResidual,
+                                     real64 const lastResidual,
+                                     real64 const residualNorm,
+                                     real64 const newtonTol,
+                                     integer const remainingIter );
+
   static real64 EisenstatWalker( real64 const newNewtonNorm,
                                  real64 const oldNewtonNorm,
                                  real64 const weakestTol );
 
+  /**
+   * @brief Set the adaptive tolerance of the next linear solve of a Newton loop, if requested.
+   * @param newNewtonNorm residual norm at the current Newton iteration
+   * @param oldNewtonNorm residual norm at the previous Newton iteration
+   */
+  void UpdateAdaptiveLinearTolerance( real64 const newNewtonNorm,
+                                      real64 const oldNewtonNorm );
+
+  /**
+   * @brief Apply an adaptive tolerance to the parameters of a linear solve.
+   * @param [in] adaptiveTol the adaptive tolerance, 0 to keep the fixed tolerance
+   * @param [inout] params the parameters of the solve
+   * @return @p true if the Krylov iterations of the solve are capped by
+   *         LinearSolverParameters::Krylov::adaptiveMaxIterations
+   *
+   * Direct solves have no tolerance to relax and keep their parameters. The iteration cap only
+   * applies when the adaptive tolerance is weaker than the fixed tolerance.
+   */
+  static bool ApplyAdaptiveTolerance( real64 const adaptiveTol,
+                                      LinearSolverParameters & params );
+
+  /**
+   * @brief Get the parameters of the next linear solve, with the adaptive tolerance of the Newton loop applied.
+   * @param [out] isCapped whether the Krylov iterations of the solve are capped by the adaptive max iterations
+   * @return the parameters of the next linear solve
+   *
+   * The adaptive tolerance is consumed, so that later solves use the fixed tolerance unless the Newton
+   * loop sets it again. Implementations of SolveSystem() not relying on SolverBase::SolveSystem() must
+   * get their parameters here.
+   */
+  LinearSolverParameters NextLinearSolverParameters( bool & isCapped );
+
+  /**
+   * @brief Compose the parallel LA matrix out of the local LA matrix.
+   *
+   * Unless disabled in the linear solver parameters, the parallel matrix is only re-created when
+   * the sparsity pattern of the local matrix has changed; otherwise, its values are updated in place.
+   * When requested, the matrix is stored by blocks of LinearSolverParameters::dofsPerNode unknowns.
+   */
+  void ComposeParallelMatrix();
+
+  /**
+   * @brief Get the block size of the parallel matrix of a linear system.
+   * @param params the linear solver parameters
+   * @param dofManager the DofManager of the linear system
+   * @return LinearSolverParameters::dofsPerNode if point blocks are requested for an iterative solver, 1 otherwise
+   *
+   * The point blocks must gather the unknowns of a support point, which the DofManager only numbers
+   * consecutively within a field. It is an error to request them for a system that does not consist
+   * of a single field with dofsPerNode components.
+   */
+  static localIndex PointBlockSize( LinearSolverParameters const & params,
+                                    DofManager const & dofManager );
+
 
   template< typename BASETYPE = constitutive::ConstitutiveBase, typename LOOKUP_TYPE >
   static BASETYPE const & GetConstitutiveModel( dataRepository::Group const & dataGroup, LOOKUP_TYPE const & key );
@@ -705,6 +827,9 @@ protected:
   real64 m_maxStableDt;
   real64 m_nextDt;
 
+  /// Ratio between the largest change of the primary variables over the last step and its target, negative if not measured
+  real64 m_solutionChangeRatio;
+
   /// name of the FV discretization object in the data repository
   string m_discretizationName;
 
@@ -721,23 +846,114 @@ protected:
   array1d< real64 > m_localRhs;
   array1d< real64 > m_localSolution;
 
-  /// Custom preconditioner for the "native" iterative solver
+  /// Custom preconditioner for the "native" iterative solver (created from the parameters if it has to be reused)
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Copy of the matrix the preconditioner was computed from (kept only while it may be reused frozen)
+  std::unique_ptr< ParallelMatrix > m_precondMatrix;
+
+  /// Persistent "native" iterative solver, kept across solves as long as operators/type are unchanged
+  std::unique_ptr< KrylovSolver< ParallelVector > > m_krylovSolver;
+
+  /// Reuse bookkeeping of the "native" preconditioner
+  PreconditionerReusePolicy m_precondReuse;
+
+  /// Solver type, operator and preconditioner the persistent iterative solver was created with
+  LinearSolverParameters::SolverType m_krylovSolverType;
+  ParallelMatrix const * m_krylovSolverMatrix;
+  PreconditionerBase< LAInterface > const * m_krylovSolverPrecond;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
   /// Result of the last linear solve
   LinearSolverResult m_linearSolverResult;
 
+  /// Adaptive (Eisenstat-Walker) tolerance of the next linear solve, 0 to use the fixed tolerance
+  real64 m_krylovAdaptiveTol;
+
   /// Nonlinear solver parameters
   NonlinearSolverParameters m_nonlinearSolverParameters;
 
+  /**
+   * @brief Apply an initial guess for the Newton loop extrapolated in time from the increments of the last steps.
+   * @param dt the time step
+   * @param domain the domain partition
+   *
+   * The guess is applied with ApplySystemSolution() and is checked by CheckInitialGuess() once the
+   * first Newton iteration has assembled the system. Also resets the increment of the current step.
+   * Solvers overriding NonlinearImplicitStep() call it whenever the Newton loop restarts from the
+   * state at the beginning of the step.
+   */
+  void ApplyExtrapolatedInitialGuess( real64 const & dt,
+                                      DomainPartition & domain );
+
+  /**
+   * @brief Check the extrapolated initial guess with the residual of the first Newton iteration.
+   * @param residualNorm the residual norm assembled at the first Newton iteration
+   * @param domain the domain partition
+   * @return @p false if the guess was rejected, in which case the state is reset to the beginning of
+   *         the step and the system must be assembled again
+   *
+   * The guess is rejected if the residual it yields is not smaller than the initial residual of the
+   * last converged step, which is recorded here when no guess is pending.
+   */
+  bool CheckInitialGuess( real64 const residualNorm,
+                          DomainPartition & domain );
+
+  /**
+   * @brief Add a Newton update applied to the fields to the increment of the current step.
+   * @param localSolution the update
+   * @param scale the scaling factor the update was applied with
+   */
+  void AccumulateStepIncrement( arrayView1d< real64 const > const & localSolution,
+                                real64 const scale );
+
+  /**
+   * @brief Store the increment of the current step for the extrapolation of the next initial guesses.
+   * @param dt the size of the step
+   * @param isConverged flag indicating whether the step converged, the stored increments are discarded otherwise
+   */
+  void RecordStepIncrement( real64 const & dt,
+                            bool const isConverged );
+
 private:
 
+  /**
+   * @brief Perform a full setup of the "native" preconditioner for a system matrix.
+   * @param matrix the system matrix
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   */
+  void SetupPreconditioner( ParallelMatrix const & matrix,
+                            DofManager const & dofManager );
+
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
 
+  /// Increments of the current step and of the last two converged steps, used to extrapolate the initial guess
+  array1d< real64 > m_stepIncrements[3];
+
+  /// Sizes of the steps of m_stepIncrements
+  real64 m_stepIncrementDt[3];
+
+  /// Index of the current step in m_stepIncrements, the last converged steps precede it cyclically
+  integer m_currentStepIncrement;
+
+  /// Number of converged step increments available for the extrapolation
+  integer m_numStepIncrements;
+
+  /// Rank offset of the DoF numbering the stored increments refer to
+  globalIndex m_stepIncrementRankOffset;
+
+  /// Whether an extrapolated initial guess is applied and not yet checked
+  bool m_isInitialGuessPending;
+
+  /// Residual norm at the first Newton iteration of the current step
+  real64 m_initialResidualNorm;
+
+  /// Residual norm at the first Newton iteration of the last converged step
+  real64 m_lastInitialResidualNorm;
+
 };
 
 template< typename BASETYPE, typename LOOKUP_TYPE >
@@ -56,7 +56,13 @@ CompositionalMultiphaseFlow::CompositionalMultiphaseFlow( const string & name,
   m_capPressureFlag( 0 ),
   m_maxCompFracChange( 1.0 ),
   m_minScalingFactor( 0.01 ),
-  m_allowCompDensChopping( 1 )
+  m_allowCompDensChopping( 1 ),
+  m_targetPhaseVolFractionChange( 0.0 ),
+  m_useFluidCache( 0 ),
+  m_fluidCacheTolerance( 1e-8 ),
+  m_fluidCacheTaylorUpdate( 0 ),
+  m_fluidCacheHits( 0 ),
+  m_fluidCacheMisses( 0 )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::temperatureString, &m_temperature )->
@@ -90,6 +96,30 @@ CompositionalMultiphaseFlow::CompositionalMultiphaseFlow( const string & name,
     setApplyDefaultValue( 1 )->
     setDescription( "Flag indicating whether local (cell-wise) chopping of negative compositions is allowed" );
 
+  this->registerWrapper( viewKeyStruct::targetPhaseVolFractionChangeString, &m_targetPhaseVolFractionChange )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Target (absolute) change in a phase volume fraction over a time step, used when the time step is selected "
+                    "from the solution change (see timeStepControl). A value of zero disables the saturation criterion." );
+
+  this->registerWrapper( viewKeyStruct::useFluidCacheString, &m_useFluidCache )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether the fluid update is skipped in cells whose pressure and composition "
+                    "did not change (within fluidCacheTolerance) since their last fluid update" );
+
+  this->registerWrapper( viewKeyStruct::fluidCacheToleranceString, &m_fluidCacheTolerance )->
+    setApplyDefaultValue( 1e-8 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum relative pressure change and absolute component fraction change for which "
+                    "cached fluid properties are reused" );
+
+  this->registerWrapper( viewKeyStruct::fluidCacheTaylorUpdateString, &m_fluidCacheTaylorUpdate )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether reused fluid properties are corrected with a first-order Taylor expansion "
+                    "around the cached state" );
+
   m_linearSolverParameters.get().mgr.strategy = "CompositionalMultiphaseFlow";
 
 }
@@ -104,6 +134,8 @@ void CompositionalMultiphaseFlow::PostProcessInput()
                          "The maximum absolute change in component fraction must smaller or equal to 1.0" );
   GEOSX_ERROR_IF_LT_MSG( m_maxCompFracChange, 0.0,
                          "The maximum absolute change in component fraction must larger or equal to 0.0" );
+  GEOSX_ERROR_IF_LT_MSG( m_fluidCacheTolerance, 0.0,
+                         "The fluid cache tolerance must be larger or equal to 0.0" );
 }
 
 void CompositionalMultiphaseFlow::RegisterDataOnMesh( Group * const MeshBodies )
@@ -154,6 +186,24 @@ void CompositionalMultiphaseFlow::RegisterDataOnMesh( Group * const MeshBodies )
       elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::phaseDensityOldString );
       elementSubRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::phaseComponentFractionOldString );
       elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::porosityOldString );
+
+      if( m_useFluidCache )
+      {
+        elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::fluidCachePressureString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+        elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::fluidCacheGlobalCompFractionString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+        elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::fluidCachePhaseFractionString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+        elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::fluidCachePhaseDensityString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+        elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::fluidCachePhaseViscosityString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+        elementSubRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::fluidCachePhaseComponentFractionString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+        elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::fluidCacheTotalDensityString )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+      }
     } );
   }
 }
@@ -240,6 +290,12 @@ void CompositionalMultiphaseFlow::InitializePreSubGroups( Group * const rootGrou
   m_numComponents = fluid0.numFluidComponents();
   m_numDofPerCell = m_numComponents + 1;
 
+  // the unknowns of each cell are numbered consecutively by the DofManager, so they form the point blocks
+  if( m_linearSolverParameters.get().usePointBlocks )
+  {
+    m_linearSolverParameters.get().dofsPerNode = m_numDofPerCell;
+  }
+
   // 2. Validate various models against each other (must have same phases and components)
   ValidateConstitutiveModels( cm );
 
@@ -282,10 +338,20 @@ void CompositionalMultiphaseFlow::ResizeFields( MeshLevel & meshLevel ) const
     subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionOldString ).resizeDimension< 1 >( NP );
     subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseDensityOldString ).resizeDimension< 1 >( NP );
     subRegion.getReference< array3d< real64 > >( viewKeyStruct::phaseComponentFractionOldString ).resizeDimension< 1, 2 >( NP, NC );
+
+    if( m_useFluidCache )
+    {
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::fluidCacheGlobalCompFractionString ).resizeDimension< 1 >( NC );
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::fluidCachePhaseFractionString ).resizeDimension< 1 >( NP );
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::fluidCachePhaseDensityString ).resizeDimension< 1 >( NP );
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::fluidCachePhaseViscosityString ).resizeDimension< 1 >( NP );
+      subRegion.getReference< array3d< real64 > >( viewKeyStruct::fluidCachePhaseComponentFractionString ).resizeDimension< 1, 2 >( NP, NC );
+    }
   } );
 }
 
-void CompositionalMultiphaseFlow::UpdateComponentFraction( Group & dataGroup ) const
+template< typename RANGE >
+void CompositionalMultiphaseFlow::UpdateComponentFraction( Group & dataGroup, RANGE const & range ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -306,15 +372,22 @@ void CompositionalMultiphaseFlow::UpdateComponentFraction( Group & dataGroup ) c
     dataGroup.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
 
   KernelLaunchSelector1< ComponentFractionKernel >( m_numComponents,
-                                                    dataGroup.size(),
+                                                    range,
                                                     compDens,
                                                     dCompDens,
                                                     compFrac,
                                                     dCompFrac_dCompDens );
 }
 
+void CompositionalMultiphaseFlow::UpdateComponentFraction( Group & dataGroup ) const
+{
+  UpdateComponentFraction( dataGroup, dataGroup.size() );
+}
+
+template< typename RANGE >
 void CompositionalMultiphaseFlow::UpdatePhaseVolumeFraction( Group & dataGroup,
-                                                             localIndex const targetIndex ) const
+                                                             localIndex const targetIndex,
+                                                             RANGE const & range ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -351,7 +424,7 @@ void CompositionalMultiphaseFlow::UpdatePhaseVolumeFraction( Group & dataGroup,
   arrayView4d< real64 const > const & dPhaseDens_dComp = fluid.dPhaseDensity_dGlobalCompFraction();
 
   KernelLaunchSelector2< PhaseVolumeFractionKernel >( m_numComponents, m_numPhases,
-                                                      dataGroup.size(),
+                                                      range,
                                                       compDens,
                                                       dCompDens,
                                                       dCompFrac_dCompDens,
@@ -366,7 +439,16 @@ void CompositionalMultiphaseFlow::UpdatePhaseVolumeFraction( Group & dataGroup,
                                                       dPhaseVolFrac_dComp );
 }
 
-void CompositionalMultiphaseFlow::UpdatePhaseMobility( Group & dataGroup, localIndex const targetIndex ) const
+void CompositionalMultiphaseFlow::UpdatePhaseVolumeFraction( Group & dataGroup,
+                                                             localIndex const targetIndex ) const
+{
+  UpdatePhaseVolumeFraction( dataGroup, targetIndex, dataGroup.size() );
+}
+
+template< typename RANGE >
+void CompositionalMultiphaseFlow::UpdatePhaseMobility( Group & dataGroup,
+                                                       localIndex const targetIndex,
+                                                       RANGE const & range ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -408,7 +490,7 @@ void CompositionalMultiphaseFlow::UpdatePhaseMobility( Group & dataGroup, localI
   arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac = relperm.dPhaseRelPerm_dPhaseVolFraction();
 
   KernelLaunchSelector2< PhaseMobilityKernel >( m_numComponents, m_numPhases,
-                                                dataGroup.size(),
+                                                range,
                                                 dCompFrac_dCompDens,
                                                 phaseDens,
                                                 dPhaseDens_dPres,
@@ -425,6 +507,11 @@ void CompositionalMultiphaseFlow::UpdatePhaseMobility( Group & dataGroup, localI
                                                 dPhaseMob_dComp );
 }
 
+void CompositionalMultiphaseFlow::UpdatePhaseMobility( Group & dataGroup, localIndex const targetIndex ) const
+{
+  UpdatePhaseMobility( dataGroup, targetIndex, dataGroup.size() );
+}
+
 void CompositionalMultiphaseFlow::UpdateFluidModel( Group & dataGroup, localIndex const targetIndex ) const
 {
   GEOSX_MARK_FUNCTION;
@@ -435,17 +522,158 @@ void CompositionalMultiphaseFlow::UpdateFluidModel( Group & dataGroup, localInde
 
   MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
 
+  if( !m_useFluidCache )
+  {
+    constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+    {
+      typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+      // MultiFluid models are not thread-safe or device-capable yet
+      FluidUpdateKernel::Launch< serialPolicy >( dataGroup.size(),
+                                                 fluidWrapper,
+                                                 pres,
+                                                 dPres,
+                                                 m_temperature,
+                                                 compFrac );
+    } );
+    return;
+  }
+
+  arrayView1d< real64 > const cachedPres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::fluidCachePressureString );
+  arrayView2d< real64 > const cachedCompFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::fluidCacheGlobalCompFractionString );
+  arrayView2d< real64 > const cachedPhaseFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::fluidCachePhaseFractionString );
+  arrayView2d< real64 > const cachedPhaseDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::fluidCachePhaseDensityString );
+  arrayView2d< real64 > const cachedPhaseVisc =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::fluidCachePhaseViscosityString );
+  arrayView3d< real64 > const cachedPhaseCompFrac =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::fluidCachePhaseComponentFractionString );
+  arrayView1d< real64 > const cachedTotalDens =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::fluidCacheTotalDensityString );
+
+  using keys = MultiFluidBase::viewKeyStruct;
+
+  arrayView3d< real64 > const phaseFrac = fluid.getReference< array3d< real64 > >( keys::phaseFractionString );
+  arrayView3d< real64 > const phaseDens = fluid.getReference< array3d< real64 > >( keys::phaseDensityString );
+  arrayView3d< real64 > const phaseVisc = fluid.getReference< array3d< real64 > >( keys::phaseViscosityString );
+  arrayView4d< real64 > const phaseCompFrac = fluid.getReference< array4d< real64 > >( keys::phaseCompFractionString );
+  arrayView2d< real64 > const totalDens = fluid.getReference< array2d< real64 > >( keys::totalDensityString );
+
+  // 1. Reuse the cached fluid state where possible and flag the elements that need a full update
+  array1d< integer > isStale( dataGroup.size() );
+  localIndex const numHits =
+    FluidCacheKernel::Lookup< serialPolicy >( dataGroup.size(),
+                                              m_fluidCacheTolerance,
+                                              m_fluidCacheTaylorUpdate,
+                                              pres,
+                                              dPres,
+                                              compFrac,
+                                              cachedPres,
+                                              cachedCompFrac,
+                                              cachedPhaseFrac,
+                                              cachedPhaseDens,
+                                              cachedPhaseVisc,
+                                              cachedPhaseCompFrac,
+                                              cachedTotalDens,
+                                              phaseFrac,
+                                              fluid.dPhaseFraction_dPressure(),
+                                              fluid.dPhaseFraction_dGlobalCompFraction(),
+                                              phaseDens,
+                                              fluid.dPhaseDensity_dPressure(),
+                                              fluid.dPhaseDensity_dGlobalCompFraction(),
+                                              phaseVisc,
+                                              fluid.dPhaseViscosity_dPressure(),
+                                              fluid.dPhaseViscosity_dGlobalCompFraction(),
+                                              phaseCompFrac,
+                                              fluid.dPhaseCompFraction_dPressure(),
+                                              fluid.dPhaseCompFraction_dGlobalCompFraction(),
+                                              totalDens,
+                                              fluid.dTotalDensity_dPressure(),
+                                              fluid.dTotalDensity_dGlobalCompFraction(),
+                                              isStale );
+
+  m_fluidCacheHits += numHits;
+  m_fluidCacheMisses += dataGroup.size() - numHits;
+
+  if( numHits == dataGroup.size() )
+  {
+    return;
+  }
+
+  SortedArray< localIndex > staleElems;
+  staleElems.reserve( dataGroup.size() - numHits );
+  for( localIndex ei = 0; ei < dataGroup.size(); ++ei )
+  {
+    if( isStale[ei] )
+    {
+      staleElems.insert( ei );
+    }
+  }
+
+  // 2. Run the full fluid update in the remaining elements
   constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
   {
     typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
     // MultiFluid models are not thread-safe or device-capable yet
-    FluidUpdateKernel::Launch< serialPolicy >( dataGroup.size(),
-                                               fluidWrapper,
-                                               pres,
-                                               dPres,
-                                               m_temperature,
-                                               compFrac );
+    if( numHits == 0 )
+    {
+      FluidUpdateKernel::Launch< serialPolicy >( dataGroup.size(),
+                                                 fluidWrapper,
+                                                 pres,
+                                                 dPres,
+                                                 m_temperature,
+                                                 compFrac );
+    }
+    else
+    {
+      FluidUpdateKernel::Launch< serialPolicy >( staleElems.toViewConst(),
+                                                 fluidWrapper,
+                                                 pres,
+                                                 dPres,
+                                                 m_temperature,
+                                                 compFrac );
+    }
+  } );
+
+  // 3. Store the new state of the updated elements in the cache
+  FluidCacheKernel::Store< serialPolicy >( staleElems.toViewConst(),
+                                           pres,
+                                           dPres,
+                                           compFrac,
+                                           phaseFrac,
+                                           phaseDens,
+                                           phaseVisc,
+                                           phaseCompFrac,
+                                           totalDens,
+                                           cachedPres,
+                                           cachedCompFrac,
+                                           cachedPhaseFrac,
+                                           cachedPhaseDens,
+                                           cachedPhaseVisc,
+                                           cachedPhaseCompFrac,
+                                           cachedTotalDens );
+}
+
+void CompositionalMultiphaseFlow::InvalidateFluidCache( Group & dataGroup,
+                                                        SortedArrayView< localIndex const > const & targetSet ) const
+{
+  if( !m_useFluidCache )
+  {
+    return;
+  }
+
+  arrayView1d< real64 > const cachedPres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::fluidCachePressureString );
+
+  // a huge cached pressure never matches the current one, which forces a full update next time
+  real64 const invalidPres = std::numeric_limits< real64 >::max();
+  forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    cachedPres[targetSet[a]] = invalidPres;
   } );
 }
 
@@ -461,7 +689,10 @@ void CompositionalMultiphaseFlow::UpdateSolidModel( Group & dataGroup, localInde
   solid.StateUpdateBatchPressure( pres, dPres );
 }
 
-void CompositionalMultiphaseFlow::UpdateRelPermModel( Group & dataGroup, localIndex const targetIndex ) const
+template< typename RANGE >
+void CompositionalMultiphaseFlow::UpdateRelPermModel( Group & dataGroup,
+                                                      localIndex const targetIndex,
+                                                      RANGE const & range ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -475,13 +706,21 @@ void CompositionalMultiphaseFlow::UpdateRelPermModel( Group & dataGroup, localIn
   {
     typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
 
-    RelativePermeabilityUpdateKernel::Launch< parallelDevicePolicy<> >( dataGroup.size(),
+    RelativePermeabilityUpdateKernel::Launch< parallelDevicePolicy<> >( range,
                                                                         relPermWrapper,
                                                                         phaseVolFrac );
   } );
 }
 
-void CompositionalMultiphaseFlow::UpdateCapPressureModel( Group & dataGroup, localIndex const targetIndex ) const
+void CompositionalMultiphaseFlow::UpdateRelPermModel( Group & dataGroup, localIndex const targetIndex ) const
+{
+  UpdateRelPermModel( dataGroup, targetIndex, dataGroup.size() );
+}
+
+template< typename RANGE >
+void CompositionalMultiphaseFlow::UpdateCapPressureModel( Group & dataGroup,
+                                                          localIndex const targetIndex,
+                                                          RANGE const & range ) const
 {
   if( m_capPressureFlag )
   {
@@ -495,13 +734,18 @@ void CompositionalMultiphaseFlow::UpdateCapPressureModel( Group & dataGroup, loc
     {
       typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
 
-      CapillaryPressureUpdateKernel::Launch< parallelDevicePolicy<> >( dataGroup.size(),
+      CapillaryPressureUpdateKernel::Launch< parallelDevicePolicy<> >( range,
                                                                        capPresWrapper,
                                                                        phaseVolFrac );
     } );
   }
 }
 
+void CompositionalMultiphaseFlow::UpdateCapPressureModel( Group & dataGroup, localIndex const targetIndex ) const
+{
+  UpdateCapPressureModel( dataGroup, targetIndex, dataGroup.size() );
+}
+
 void CompositionalMultiphaseFlow::UpdateState( Group & dataGroup, localIndex const targetIndex ) const
 {
   GEOSX_MARK_FUNCTION;
@@ -515,6 +759,42 @@ void CompositionalMultiphaseFlow::UpdateState( Group & dataGroup, localIndex con
   UpdateCapPressureModel( dataGroup, targetIndex );
 }
 
+void CompositionalMultiphaseFlow::UpdateGhostState( Group & dataGroup,
+                                                    localIndex const targetIndex,
+                                                    SortedArrayView< localIndex const > const & ghostSet ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  UpdateComponentFraction( dataGroup, ghostSet );
+
+  // the ghost cells bypass the fluid cache
+  arrayView1d< real64 const > const pres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+  arrayView1d< real64 const > const dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+  arrayView2d< real64 const > const compFrac = dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompFractionString );
+
+  MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    // MultiFluid models are not thread-safe or device-capable yet
+    FluidUpdateKernel::Launch< serialPolicy >( ghostSet,
+                                               fluidWrapper,
+                                               pres,
+                                               dPres,
+                                               m_temperature,
+                                               compFrac );
+  } );
+  InvalidateFluidCache( dataGroup, ghostSet );
+
+  UpdatePhaseVolumeFraction( dataGroup, targetIndex, ghostSet );
+  UpdateSolidModel( dataGroup, targetIndex );
+  UpdateRelPermModel( dataGroup, targetIndex, ghostSet );
+  UpdatePhaseMobility( dataGroup, targetIndex, ghostSet );
+  UpdateCapPressureModel( dataGroup, targetIndex, ghostSet );
+}
+
 void CompositionalMultiphaseFlow::InitializeFluidState( MeshLevel & mesh ) const
 {
   GEOSX_MARK_FUNCTION;
@@ -595,7 +875,9 @@ real64 CompositionalMultiphaseFlow::SolverStep( real64 const & time_n,
   ImplicitStepSetup( time_n, dt, domain );
 
   // currently the only method is implicit time integration
+  m_inOwnNonlinearSolve = true;
   dt_return = NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  m_inOwnNonlinearSolve = false;
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   ImplicitStepComplete( time_n, dt_return, domain );
@@ -700,11 +982,16 @@ void CompositionalMultiphaseFlow::AssembleSystem( real64 const GEOSX_UNUSED_PARA
                              localMatrix,
                              localRhs );
 
-  AssembleFluxTerms( dt,
-                     domain,
-                     dofManager,
-                     localMatrix,
-                     localRhs );
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  AssembleFluxTermsOverlapped( mesh, [&]()
+  {
+    AssembleFluxTerms( dt,
+                       domain,
+                       dofManager,
+                       localMatrix,
+                       localRhs );
+  } );
 
   AssembleVolumeBalanceTerms( domain,
                               dofManager,
@@ -846,6 +1133,8 @@ void CompositionalMultiphaseFlow::AssembleFluxTerms( real64 const dt,
   elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
   elemDofNumber.setName( getName() + "/accessors/" + dofKey );
 
+  CompiledStencilTPFA const & compiledStencil = getCompiledCellStencil( fluxApprox, mesh, dofManager, elemDofNumber );
+
   fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
   {
     KernelLaunchSelector1< FluxKernel >( m_numComponents,
@@ -874,7 +1163,10 @@ void CompositionalMultiphaseFlow::AssembleFluxTerms( real64 const dt,
                                          m_capPressureFlag,
                                          dt,
                                          localMatrix.toViewConstSizes(),
-                                         localRhs.toView() );
+                                         localRhs.toView(),
+                                         m_coloredAssembly,
+                                         compiledStencil,
+                                         m_fluxConnections );
   } );
 }
 
@@ -1121,6 +1413,7 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
                                                  m_temperature,
                                                  compFrac );
     } );
+    InvalidateFluidCache( *subRegion, targetSet );
 
     forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
@@ -1398,7 +1691,7 @@ void CompositionalMultiphaseFlow::ApplySystemSolution( DofManager const & dofMan
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaGlobalCompDensityString ) );
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
+  SynchronizeSolutionFields( fieldNames, mesh, domain, true );
 
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
@@ -1441,6 +1734,8 @@ void CompositionalMultiphaseFlow::ResetStateToBeginningOfStep( DomainPartition &
 {
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  CompleteSolutionSynchronization( mesh );
+
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
     arrayView1d< real64 > const & dPres =
@@ -1461,8 +1756,49 @@ void CompositionalMultiphaseFlow::ImplicitStepComplete( real64 const & GEOSX_UNU
 {
   localIndex const NC = m_numComponents;
 
+  if( m_useFluidCache )
+  {
+    localIndex const numHits = MpiWrapper::Sum( m_fluidCacheHits );
+    localIndex const numMisses = MpiWrapper::Sum( m_fluidCacheMisses );
+    GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": fluid cache hits = " << numHits << ", misses = " << numMisses );
+    m_fluidCacheHits = 0;
+    m_fluidCacheMisses = 0;
+  }
+
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  CompleteSolutionSynchronization( mesh );
+
+  // largest change of the primary variables relative to their targets, used by the time step control
+  real64 solutionChangeRatio = ComputePressureChangeRatio( mesh );
+  if( m_targetPhaseVolFractionChange > 0.0 )
+  {
+    localIndex const NP = m_numPhases;
+    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxPhaseVolFracChange( 0.0 );
+    forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+      arrayView2d< real64 const > const & phaseVolFrac =
+        subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionString );
+      arrayView2d< real64 const > const & phaseVolFracOld =
+        subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionOldString );
+
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        if( elemGhostRank[ei] < 0 )
+        {
+          for( localIndex ip = 0; ip < NP; ++ip )
+          {
+            maxPhaseVolFracChange.max( fabs( phaseVolFrac[ei][ip] - phaseVolFracOld[ei][ip] ) );
+          }
+        }
+      } );
+    } );
+    real64 const phaseVolFracChangeRatio = MpiWrapper::Max( maxPhaseVolFracChange.get() ) / m_targetPhaseVolFractionChange;
+    solutionChangeRatio = std::max( solutionChangeRatio, phaseVolFracChangeRatio );
+  }
+  m_solutionChangeRatio = solutionChangeRatio;
+
   forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
   {
     arrayView1d< real64 const > const & dPres =
@@ -288,6 +288,12 @@ public:
     static constexpr auto maxCompFracChangeString = "maxCompFractionChange";
     static constexpr auto allowLocalCompDensChoppingString = "allowLocalCompDensityChopping";
 
+    static constexpr auto useFluidCacheString = "useFluidCache";
+    static constexpr auto fluidCacheToleranceString = "fluidCacheTolerance";
+    static constexpr auto fluidCacheTaylorUpdateString = "fluidCacheTaylorUpdate";
+
+    static constexpr auto targetPhaseVolFractionChangeString = "targetPhaseVolFractionChange";
+
     static constexpr auto facePressureString  = "facePressure";
     static constexpr auto bcPressureString    = "bcPressure";
 
@@ -314,6 +320,15 @@ public:
     static constexpr auto phaseComponentFractionOldString  = "phaseComponentFractionOld";
     static constexpr auto porosityOldString                = "porosityOld";
 
+    // these are used to store the fluid state of the last full fluid update (if the fluid cache is used)
+    static constexpr auto fluidCachePressureString                = "fluidCachePressure";
+    static constexpr auto fluidCacheGlobalCompFractionString      = "fluidCacheGlobalCompFraction";
+    static constexpr auto fluidCachePhaseFractionString           = "fluidCachePhaseFraction";
+    static constexpr auto fluidCachePhaseDensityString            = "fluidCachePhaseDensity";
+    static constexpr auto fluidCachePhaseViscosityString          = "fluidCachePhaseViscosity";
+    static constexpr auto fluidCachePhaseComponentFractionString  = "fluidCachePhaseComponentFraction";
+    static constexpr auto fluidCacheTotalDensityString            = "fluidCacheTotalDensity";
+
     // these are allocated on faces for BC application until we can get constitutive models on faces
     static constexpr auto phaseViscosityString             = "phaseViscosity";
     static constexpr auto phaseRelativePermeabilityString  = "phaseRelativePermeability";
@@ -392,8 +407,33 @@ protected:
    */
   void ValidateConstitutiveModels( constitutive::ConstitutiveManager const & cm ) const;
 
+  virtual void UpdateGhostState( Group & dataGroup,
+                                 localIndex const targetIndex,
+                                 SortedArrayView< localIndex const > const & ghostSet ) const override;
+
 private:
 
+  /**
+   * @brief Implementations of the update functions over a range of elements
+   * @tparam RANGE the type of the range: the number of elements (all elements) or a set of element indices
+   */
+  ///@{
+  template< typename RANGE >
+  void UpdateComponentFraction( Group & dataGroup, RANGE const & range ) const;
+
+  template< typename RANGE >
+  void UpdatePhaseVolumeFraction( Group & dataGroup, localIndex const targetIndex, RANGE const & range ) const;
+
+  template< typename RANGE >
+  void UpdateRelPermModel( Group & dataGroup, localIndex const targetIndex, RANGE const & range ) const;
+
+  template< typename RANGE >
+  void UpdateCapPressureModel( Group & dataGroup, localIndex const targetIndex, RANGE const & range ) const;
+
+  template< typename RANGE >
+  void UpdatePhaseMobility( Group & dataGroup, localIndex const targetIndex, RANGE const & range ) const;
+  ///@}
+
   /**
    * @brief Resize the allocated multidimensional fields
    * @param domain the domain containing the mesh and fields
@@ -408,6 +448,15 @@ private:
    */
   void ResetViews( MeshLevel & mesh ) override;
 
+  /**
+   * @brief Mark the cached fluid state of some elements as invalid
+   * @param dataGroup group that contains the fields
+   * @param targetSet indices of the elements
+   *
+   * Must be called whenever the fluid properties of an element are computed outside of UpdateFluidModel().
+   */
+  void InvalidateFluidCache( Group & dataGroup, SortedArrayView< localIndex const > const & targetSet ) const;
+
   /// the max number of fluid phases
   localIndex m_numPhases;
 
@@ -438,6 +487,24 @@ private:
   /// flag indicating whether local (cell-wise) chopping of negative compositions is allowed
   integer m_allowCompDensChopping;
 
+  /// target (absolute) change in a phase volume fraction over a time step for the solution change time step control
+  real64 m_targetPhaseVolFractionChange;
+
+  /// flag indicating whether fluid properties of elements whose state barely changed are reused
+  integer m_useFluidCache;
+
+  /// relative pressure and absolute component fraction change below which the cached fluid state is reused
+  real64 m_fluidCacheTolerance;
+
+  /// flag indicating whether reused fluid properties are corrected with a first-order Taylor expansion
+  integer m_fluidCacheTaylorUpdate;
+
+  /// number of element fluid updates served from the cache since the last report
+  mutable localIndex m_fluidCacheHits;
+
+  /// number of element fluid updates that required a full fluid update since the last report
+  mutable localIndex m_fluidCacheMisses;
+
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_pressure;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_deltaPressure;
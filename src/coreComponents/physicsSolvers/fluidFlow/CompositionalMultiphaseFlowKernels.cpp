@@ -1032,7 +1032,10 @@ FluxKernel::
           integer const capPressureFlag,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
-          arrayView1d< real64 > const & localRhs )
+          arrayView1d< real64 > const & localRhs,
+          bool const coloredAssembly,
+          CompiledStencilTPFA const & compiledStencil,
+          CompiledStencilTPFA::Connections const connections )
 {
   typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
   typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
@@ -1043,7 +1046,21 @@ FluxKernel::
   localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
   localIndex constexpr NDOF = NC + 1;
 
-  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  // pre-resolved DoF numbers and local rows, avoiding the element-based indirection
+  bool const useCompiledStencil = compiledStencil.isCompiledFrom( stencil );
+  arrayView2d< globalIndex const > const & compiledDofNumbers = compiledStencil.getDofNumbers();
+  arrayView2d< localIndex const > const & compiledLocalRows = compiledStencil.getLocalRows();
+
+  // assemble only a subset of the connections, as resolved by the compiled stencil
+  if( connections == CompiledStencilTPFA::Connections::Interior && !useCompiledStencil )
+  {
+    // the subsets are not available: all connections are assembled with the boundary ones
+    return;
+  }
+  bool const selectConnections = useCompiledStencil && connections != CompiledStencilTPFA::Connections::All;
+  bool const selectInterior = connections == CompiledStencilTPFA::Connections::Interior;
+
+  auto assembleConnection = [=] GEOSX_HOST_DEVICE ( localIndex const iconn, bool const useAtomics )
   {
     // TODO: hack! for MPFA, etc. must obtain proper size from e.g. seri
     localIndex const stencilSize = MAX_STENCIL;
@@ -1083,7 +1100,9 @@ FluxKernel::
     globalIndex dofColIndices[ MAX_STENCIL * NDOF ];
     for( localIndex i = 0; i < stencilSize; ++i )
     {
-      globalIndex const offset = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      globalIndex const offset = useCompiledStencil
+                                 ? compiledDofNumbers( iconn, i )
+                                 : dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
 
       for( localIndex jdof = 0; jdof < NDOF; ++jdof )
       {
@@ -1096,24 +1115,85 @@ FluxKernel::
     // Add to residual/jacobian
     for( localIndex i = 0; i < NUM_ELEMS; ++i )
     {
-      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+      bool const isOwned = useCompiledStencil
+                           ? compiledLocalRows( iconn, i ) >= 0
+                           : ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0;
+      if( isOwned )
       {
-        globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-        localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+        localIndex const localRow = useCompiledStencil
+                                    ? compiledLocalRows( iconn, i )
+                                    : LvArray::integerConversion< localIndex >( dofColIndices[i * NDOF] - rankOffset );
         GEOSX_ASSERT_GE( localRow, 0 );
         GEOSX_ASSERT_GT( localMatrix.numRows(), localRow + NC );
 
         for( localIndex ic = 0; ic < NC; ++ic )
         {
-          RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
-                                                                            dofColIndices,
-                                                                            localFluxJacobian[i * NC + ic].dataIfContiguous(),
-                                                                            stencilSize * NDOF );
+          if( useAtomics )
+          {
+            RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
+            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
+                                                                              dofColIndices,
+                                                                              localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                                              stencilSize * NDOF );
+          }
+          else
+          {
+            localRhs[localRow + ic] += localFlux[i * NC + ic];
+            localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( localRow + ic,
+                                                                      dofColIndices,
+                                                                      localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                                      stencilSize * NDOF );
+          }
         }
       }
     }
-  } );
+  };
+
+  if( coloredAssembly && stencil.isColored() )
+  {
+    // connections of the same color never share a cell, hence never write to the same rows
+    arrayView1d< localIndex const > const & colorOffsets = stencil.getColorOffsets();
+    arrayView1d< localIndex const > const & coloredConnections = stencil.getColoredConnections();
+
+    for( localIndex color = 0; color < stencil.numColors(); ++color )
+    {
+      localIndex const colorBegin = colorOffsets[color];
+      forAll< parallelHostPolicy >( colorOffsets[color + 1] - colorBegin, [=] ( localIndex const k )
+      {
+        localIndex const iconn = coloredConnections[colorBegin + k];
+        if( selectConnections )
+        {
+          bool isInterior = true;
+          for( localIndex i = 0; i < NUM_ELEMS; ++i )
+          {
+            isInterior = isInterior && compiledLocalRows( iconn, i ) >= 0;
+          }
+          if( isInterior != selectInterior )
+          {
+            return;
+          }
+        }
+        assembleConnection( iconn, false );
+      } );
+    }
+  }
+  else if( selectConnections )
+  {
+    arrayView1d< localIndex const > const & selectedConnections = selectInterior
+                                                                  ? compiledStencil.getInteriorConnections()
+                                                                  : compiledStencil.getBoundaryConnections();
+    forAll< parallelDevicePolicy<> >( selectedConnections.size(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      assembleConnection( selectedConnections[k], true );
+    } );
+  }
+  else
+  {
+    forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      assembleConnection( iconn, true );
+    } );
+  }
 }
 
 #define INST_FluxKernel( NC, STENCIL_TYPE ) \
@@ -1144,7 +1224,10 @@ FluxKernel::
                                 integer const capPressureFlag, \
                                 real64 const dt, \
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix, \
-                                arrayView1d< real64 > const & localRhs )
+                                arrayView1d< real64 > const & localRhs, \
+                                bool const coloredAssembly, \
+                                CompiledStencilTPFA const & compiledStencil, \
+                                CompiledStencilTPFA::Connections const connections )
 
 INST_FluxKernel( 1, CellElementStencilTPFA );
 INST_FluxKernel( 2, CellElementStencilTPFA );
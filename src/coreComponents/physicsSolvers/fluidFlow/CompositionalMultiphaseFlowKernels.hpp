@@ -20,9 +20,12 @@
 #define GEOSX_PHYSICSSOLVERS_FINITEVOLUME_COMPOSITIONALMULTIPHASEFLOWKERNELS_HPP
 
 #include "common/DataTypes.hpp"
+#include "finiteVolume/CompiledStencilTPFA.hpp"
 #include "mesh/ElementRegionManager.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
+#include <cmath>
+
 namespace geosx
 {
 
@@ -194,12 +197,20 @@ struct FluidUpdateKernel
           real64 const temp,
           arrayView2d< real64 const > const & compFrac )
   {
-    forAll< POLICY >( size, [=] ( localIndex const k )
+    localIndex constexpr batchSize = FLUID_WRAPPER::BATCH_SIZE;
+    localIndex const numBatches = ( size + batchSize - 1 ) / batchSize;
+
+    forAll< POLICY >( numBatches, [=] ( localIndex const batch )
     {
-      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      localIndex const firstElem = batch * batchSize;
+      localIndex const numElems = LvArray::math::min( batchSize, size - firstElem );
+
+      stackArray1d< real64, batchSize > batchPres( numElems );
+      for( localIndex b = 0; b < numElems; ++b )
       {
-        fluidWrapper.Update( k, q, pres[k], temp, compFrac[k] );
+        batchPres[b] = pres[firstElem + b];
       }
+      fluidWrapper.BatchUpdate( firstElem, batchPres.toSliceConst(), temp, compFrac );
     } );
   }
 
@@ -212,12 +223,20 @@ struct FluidUpdateKernel
           real64 const temp,
           arrayView2d< real64 const > const & compFrac )
   {
-    forAll< POLICY >( size, [=] ( localIndex const k )
+    localIndex constexpr batchSize = FLUID_WRAPPER::BATCH_SIZE;
+    localIndex const numBatches = ( size + batchSize - 1 ) / batchSize;
+
+    forAll< POLICY >( numBatches, [=] ( localIndex const batch )
     {
-      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      localIndex const firstElem = batch * batchSize;
+      localIndex const numElems = LvArray::math::min( batchSize, size - firstElem );
+
+      stackArray1d< real64, batchSize > batchPres( numElems );
+      for( localIndex b = 0; b < numElems; ++b )
       {
-        fluidWrapper.Update( k, q, pres[k] + dPres[k], temp, compFrac[k] );
+        batchPres[b] = pres[firstElem + b] + dPres[firstElem + b];
       }
+      fluidWrapper.BatchUpdate( firstElem, batchPres.toSliceConst(), temp, compFrac );
     } );
   }
 
@@ -259,6 +278,157 @@ struct FluidUpdateKernel
   }
 };
 
+/******************************** FluidCacheKernel ********************************/
+
+/**
+ * @brief Kernels managing the per-element cache of fluid properties.
+ *
+ * The cache holds the pressure, composition and fluid property values of the last
+ * full fluid update in each element. An element hits the cache when its current
+ * pressure and composition are within a tolerance of the cached ones; its fluid
+ * properties are then either left as they are, or recomputed from the cached values
+ * with a first-order Taylor expansion using the stored derivatives.
+ */
+struct FluidCacheKernel
+{
+  template< typename POLICY >
+  static localIndex
+  Lookup( localIndex const size,
+          real64 const tolerance,
+          bool const taylorUpdate,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          arrayView2d< real64 const > const & compFrac,
+          arrayView1d< real64 const > const & cachedPres,
+          arrayView2d< real64 const > const & cachedCompFrac,
+          arrayView2d< real64 const > const & cachedPhaseFrac,
+          arrayView2d< real64 const > const & cachedPhaseDens,
+          arrayView2d< real64 const > const & cachedPhaseVisc,
+          arrayView3d< real64 const > const & cachedPhaseCompFrac,
+          arrayView1d< real64 const > const & cachedTotalDens,
+          arrayView3d< real64 > const & phaseFrac,
+          arrayView3d< real64 const > const & dPhaseFrac_dPres,
+          arrayView4d< real64 const > const & dPhaseFrac_dComp,
+          arrayView3d< real64 > const & phaseDens,
+          arrayView3d< real64 const > const & dPhaseDens_dPres,
+          arrayView4d< real64 const > const & dPhaseDens_dComp,
+          arrayView3d< real64 > const & phaseVisc,
+          arrayView3d< real64 const > const & dPhaseVisc_dPres,
+          arrayView4d< real64 const > const & dPhaseVisc_dComp,
+          arrayView4d< real64 > const & phaseCompFrac,
+          arrayView4d< real64 const > const & dPhaseCompFrac_dPres,
+          arrayView5d< real64 const > const & dPhaseCompFrac_dComp,
+          arrayView2d< real64 > const & totalDens,
+          arrayView2d< real64 const > const & dTotalDens_dPres,
+          arrayView3d< real64 const > const & dTotalDens_dComp,
+          arrayView1d< integer > const & isStale )
+  {
+    localIndex const NC = compFrac.size( 1 );
+    localIndex const NP = cachedPhaseFrac.size( 1 );
+
+    RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numHits( 0 );
+
+    forAll< POLICY >( size, [=] ( localIndex const k )
+    {
+      real64 const deltaP = pres[k] + dPres[k] - cachedPres[k];
+      bool isHit = std::fabs( deltaP ) <= tolerance * std::fabs( cachedPres[k] );
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        isHit = isHit && std::fabs( compFrac[k][ic] - cachedCompFrac[k][ic] ) <= tolerance;
+      }
+
+      isStale[k] = !isHit;
+      if( !isHit )
+      {
+        return;
+      }
+      numHits += 1;
+
+      if( !taylorUpdate )
+      {
+        return;
+      }
+
+      for( localIndex ip = 0; ip < NP; ++ip )
+      {
+        phaseFrac[k][0][ip] = cachedPhaseFrac[k][ip] + dPhaseFrac_dPres[k][0][ip] * deltaP;
+        phaseDens[k][0][ip] = cachedPhaseDens[k][ip] + dPhaseDens_dPres[k][0][ip] * deltaP;
+        phaseVisc[k][0][ip] = cachedPhaseVisc[k][ip] + dPhaseVisc_dPres[k][0][ip] * deltaP;
+        for( localIndex ic = 0; ic < NC; ++ic )
+        {
+          phaseCompFrac[k][0][ip][ic] = cachedPhaseCompFrac[k][ip][ic] + dPhaseCompFrac_dPres[k][0][ip][ic] * deltaP;
+        }
+
+        for( localIndex jc = 0; jc < NC; ++jc )
+        {
+          real64 const deltaZ = compFrac[k][jc] - cachedCompFrac[k][jc];
+          phaseFrac[k][0][ip] += dPhaseFrac_dComp[k][0][ip][jc] * deltaZ;
+          phaseDens[k][0][ip] += dPhaseDens_dComp[k][0][ip][jc] * deltaZ;
+          phaseVisc[k][0][ip] += dPhaseVisc_dComp[k][0][ip][jc] * deltaZ;
+          for( localIndex ic = 0; ic < NC; ++ic )
+          {
+            phaseCompFrac[k][0][ip][ic] += dPhaseCompFrac_dComp[k][0][ip][ic][jc] * deltaZ;
+          }
+        }
+      }
+
+      totalDens[k][0] = cachedTotalDens[k] + dTotalDens_dPres[k][0] * deltaP;
+      for( localIndex jc = 0; jc < NC; ++jc )
+      {
+        totalDens[k][0] += dTotalDens_dComp[k][0][jc] * ( compFrac[k][jc] - cachedCompFrac[k][jc] );
+      }
+    } );
+
+    return numHits.get();
+  }
+
+  template< typename POLICY >
+  static void
+  Store( SortedArrayView< localIndex const > const & targetSet,
+         arrayView1d< real64 const > const & pres,
+         arrayView1d< real64 const > const & dPres,
+         arrayView2d< real64 const > const & compFrac,
+         arrayView3d< real64 const > const & phaseFrac,
+         arrayView3d< real64 const > const & phaseDens,
+         arrayView3d< real64 const > const & phaseVisc,
+         arrayView4d< real64 const > const & phaseCompFrac,
+         arrayView2d< real64 const > const & totalDens,
+         arrayView1d< real64 > const & cachedPres,
+         arrayView2d< real64 > const & cachedCompFrac,
+         arrayView2d< real64 > const & cachedPhaseFrac,
+         arrayView2d< real64 > const & cachedPhaseDens,
+         arrayView2d< real64 > const & cachedPhaseVisc,
+         arrayView3d< real64 > const & cachedPhaseCompFrac,
+         arrayView1d< real64 > const & cachedTotalDens )
+  {
+    localIndex const NC = compFrac.size( 1 );
+    localIndex const NP = cachedPhaseFrac.size( 1 );
+
+    forAll< POLICY >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const k = targetSet[a];
+
+      cachedPres[k] = pres[k] + dPres[k];
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        cachedCompFrac[k][ic] = compFrac[k][ic];
+      }
+
+      for( localIndex ip = 0; ip < NP; ++ip )
+      {
+        cachedPhaseFrac[k][ip] = phaseFrac[k][0][ip];
+        cachedPhaseDens[k][ip] = phaseDens[k][0][ip];
+        cachedPhaseVisc[k][ip] = phaseVisc[k][0][ip];
+        for( localIndex ic = 0; ic < NC; ++ic )
+        {
+          cachedPhaseCompFrac[k][ip][ic] = phaseCompFrac[k][0][ip][ic];
+        }
+      }
+      cachedTotalDens[k] = totalDens[k][0];
+    } );
+  }
+};
+
 /******************************** RelativePermeabilityUpdateKernel ********************************/
 
 struct RelativePermeabilityUpdateKernel
@@ -469,7 +639,10 @@ struct FluxKernel
           integer const capPressureFlag,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
-          arrayView1d< real64 > const & localRhs );
+          arrayView1d< real64 > const & localRhs,
+          bool const coloredAssembly,
+          CompiledStencilTPFA const & compiledStencil,
+          CompiledStencilTPFA::Connections const connections );
 };
 
 /******************************** VolumeBalanceKernel ********************************/
@@ -22,6 +22,8 @@
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/NumericalMethodsManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "mpiCommunications/SyncPlan.hpp"
 
 namespace geosx
 {
@@ -39,6 +41,17 @@ FlowSolverBase::FlowSolverBase( std::string const & name,
   m_numDofPerCell( 0 ),
   m_derivativeFluxResidual_dAperture(),
   m_fluxEstimate(),
+  m_coloredAssembly( 0 ),
+  m_useCompiledStencil( 0 ),
+  m_compiledCellStencil(),
+  m_solutionSyncPlan(),
+  m_targetGhostSets(),
+  m_targetGhostSetsVersion( -1 ),
+  m_overlapHaloExchange( 0 ),
+  m_targetPressureChange( 0.0 ),
+  m_inOwnNonlinearSolve( false ),
+  m_solutionSyncPending( false ),
+  m_fluxConnections( CompiledStencilTPFA::Connections::All ),
   m_elemGhostRank(),
   m_volume(),
   m_gravCoef(),
@@ -73,6 +86,34 @@ FlowSolverBase::FlowSolverBase( std::string const & name,
     setDescription( "Coefficient to move between harmonic mean (1.0) and arithmetic mean (0.0) for the "
                     "calculation of permeability between elements." );
 
+  this->registerWrapper( viewKeyStruct::coloredAssemblyString, &m_coloredAssembly )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether the flux terms are assembled color by color without atomics. "
+                    "The cell stencil connections are colored so that no two connections of the same color share a cell, "
+                    "the fracture connections are still assembled with atomics. "
+                    "Only beneficial on host (OpenMP) execution." );
+
+  this->registerWrapper( viewKeyStruct::compiledStencilString, &m_useCompiledStencil )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether the DoF numbers and local rows of the cell stencil connections are "
+                    "resolved once per DoF numbering and reused by the flux kernels." );
+
+  this->registerWrapper( viewKeyStruct::overlapHaloExchangeString, &m_overlapHaloExchange )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether the ghost exchange of the Newton update is overlapped with the assembly "
+                    "of the flux terms between locally owned cells. Only used when the solver is not coupled." );
+
+  this->registerWrapper( viewKeyStruct::targetPressureChangeString, &m_targetPressureChange )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Target (absolute) pressure change over a time step, used when the time step is selected from the "
+                    "solution change (see timeStepControl). A value of zero disables the pressure criterion." );
+
+  m_compiledCellStencil.setName( getName() + "/compiledCellStencil" );
+
 }
 
 void FlowSolverBase::RegisterDataOnMesh( Group * const MeshBodies )
@@ -180,6 +221,12 @@ void FlowSolverBase::InitializePreSubGroups( Group * const rootGroup )
   {
     stencilTargetRegions.emplace_back( targetRegion );
   }
+
+  // the stencils are only colored for the solvers assembling color by color
+  if( m_coloredAssembly )
+  {
+    fluxApprox.requestColoring();
+  }
 }
 
 void FlowSolverBase::InitializePostInitialConditions_PreSubGroups( Group * const rootGroup )
@@ -232,6 +279,136 @@ void FlowSolverBase::PrecomputeData( MeshLevel & mesh )
 
 FlowSolverBase::~FlowSolverBase() = default;
 
+void FlowSolverBase::SynchronizeSolutionFields( std::map< string, string_array > const & fieldNames,
+                                                MeshLevel & mesh,
+                                                DomainPartition & domain,
+                                                bool const allowOverlap )
+{
+  // the buffers of a pending synchronization cannot be reused before it completes
+  CompleteSolutionSynchronization( mesh );
+
+  if( !m_solutionSyncPlan || !m_solutionSyncPlan->matches( fieldNames, mesh, true ) )
+  {
+    m_solutionSyncPlan = std::make_unique< SyncPlan >( fieldNames, mesh, domain.getNeighbors(), true );
+  }
+
+  // the ghost sets only change with the ghost lists, which also trigger a rebuild of the plan
+  if( m_targetGhostSetsVersion != mesh.ghostingVersion() )
+  {
+    ElementRegionManager const & elemManager = *mesh.getElemManager();
+    m_targetGhostSets.clear();
+    m_targetGhostSets.resize( elemManager.numRegions() );
+    forTargetSubRegionsComplete( mesh, [&]( localIndex const,
+                                            localIndex const er,
+                                            localIndex const esr,
+                                            ElementRegionBase const & region,
+                                            ElementSubRegionBase const & subRegion )
+    {
+      m_targetGhostSets[er].resize( region.numSubRegions() );
+      arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+      SortedArray< localIndex > & ghostSet = m_targetGhostSets[er][esr];
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        if( ghostRank[ei] >= 0 )
+        {
+          ghostSet.insert( ei );
+        }
+      }
+    } );
+    m_targetGhostSetsVersion = mesh.ghostingVersion();
+  }
+
+  if( allowOverlap && m_overlapHaloExchange && m_inOwnNonlinearSolve )
+  {
+    // completed by the next flux assembly (see AssembleFluxTermsOverlapped)
+    m_solutionSyncPlan->start();
+    m_solutionSyncPending = true;
+  }
+  else
+  {
+    m_solutionSyncPlan->execute();
+  }
+}
+
+void FlowSolverBase::CompleteSolutionSynchronization( MeshLevel & mesh )
+{
+  if( !m_solutionSyncPending )
+  {
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  m_solutionSyncPlan->finish();
+  m_solutionSyncPending = false;
+
+  forTargetSubRegionsComplete( mesh, [&]( localIndex const targetIndex,
+                                          localIndex const er,
+                                          localIndex const esr,
+                                          ElementRegionBase &,
+                                          ElementSubRegionBase & subRegion )
+  {
+    SortedArray< localIndex > const & ghostSet = m_targetGhostSets[er][esr];
+    if( !ghostSet.empty() )
+    {
+      UpdateGhostState( subRegion, targetIndex, ghostSet.toViewConst() );
+    }
+  } );
+}
+
+void FlowSolverBase::UpdateGhostState( Group & GEOSX_UNUSED_PARAM( dataGroup ),
+                                       localIndex const GEOSX_UNUSED_PARAM( targetIndex ),
+                                       SortedArrayView< localIndex const > const & GEOSX_UNUSED_PARAM( ghostSet ) ) const
+{
+  GEOSX_ERROR( getName() << ": overlapped synchronization is not supported by this solver" );
+}
+
+real64 FlowSolverBase::ComputePressureChangeRatio( MeshLevel const & mesh ) const
+{
+  if( m_targetPressureChange <= 0.0 )
+  {
+    return -1.0;
+  }
+
+  RAJA::ReduceMax< parallelDeviceReduce, real64 > maxPresChange( 0.0 );
+  forTargetSubRegions( mesh, [&]( localIndex const,
+                                  ElementSubRegionBase const & subRegion )
+  {
+    arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+    arrayView1d< real64 const > const & dPres = subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( elemGhostRank[ei] < 0 )
+      {
+        maxPresChange.max( fabs( dPres[ei] ) );
+      }
+    } );
+  } );
+
+  return MpiWrapper::Max( maxPresChange.get() ) / m_targetPressureChange;
+}
+
+CompiledStencilTPFA const &
+FlowSolverBase::getCompiledCellStencil( FluxApproximationBase const & fluxApprox,
+                                        MeshLevel const & mesh,
+                                        DofManager const & dofManager,
+                                        ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const & dofNumber ) const
+{
+  // the overlapped synchronization relies on the connection subsets of the compiled stencil
+  if( m_useCompiledStencil || m_overlapHaloExchange )
+  {
+    fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+    {
+      m_compiledCellStencil.update( stencil,
+                                    dofNumber,
+                                    m_elemGhostRank,
+                                    dofManager );
+    } );
+  }
+  return m_compiledCellStencil;
+}
+
 void FlowSolverBase::ResetViews( MeshLevel & mesh )
 {
   ElementRegionManager const & elemManager = *mesh.getElemManager();
@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FINITEVOLUME_FLOWSOLVERBASE_HPP_
 #define GEOSX_PHYSICSSOLVERS_FINITEVOLUME_FLOWSOLVERBASE_HPP_
 
+#include "finiteVolume/CompiledStencilTPFA.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 namespace geosx
@@ -30,6 +31,8 @@ class Group;
 }
 class FieldSpecificationBase;
 class DomainPartition;
+class FluxApproximationBase;
+class SyncPlan;
 
 /**
  * @class FlowSolverBase
@@ -106,6 +109,10 @@ public:
 
     static constexpr auto inputFluxEstimateString  = "inputFluxEstimate";
     static constexpr auto meanPermCoeffString  = "meanPermCoeff";
+    static constexpr auto coloredAssemblyString  = "useColoredAssembly";
+    static constexpr auto compiledStencilString  = "useCompiledStencil";
+    static constexpr auto overlapHaloExchangeString  = "overlapHaloExchange";
+    static constexpr auto targetPressureChangeString  = "targetPressureChange";
   } viewKeysFlowSolverBase;
 
   struct groupKeyStruct : SolverBase::groupKeyStruct
@@ -144,6 +151,87 @@ protected:
 
   void PrecomputeData( MeshLevel & mesh );
 
+  /**
+   * @brief Get the cell stencil with pre-resolved DoF numbers, compiling it if needed.
+   * @param fluxApprox the flux approximation holding the cell stencil
+   * @param mesh the mesh level containing the stencil
+   * @param dofManager degree-of-freedom manager providing the numbering
+   * @param dofNumber the DoF numbers of the cells
+   * @return the compiled stencil; it is empty if the option is disabled
+   */
+  CompiledStencilTPFA const &
+  getCompiledCellStencil( FluxApproximationBase const & fluxApprox,
+                          MeshLevel const & mesh,
+                          DofManager const & dofManager,
+                          ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const & dofNumber ) const;
+
+  /**
+   * @brief Synchronize the Newton update fields with a cached synchronization plan.
+   * @param fieldNames names of the fields to synchronize, keyed by object type
+   * @param mesh the mesh level holding the fields
+   * @param domain the domain partition providing the neighbors
+   *
+   * The plan is built on first use and rebuilt if the set of fields changes.
+   */
+  void SynchronizeSolutionFields( std::map< string, string_array > const & fieldNames,
+                                  MeshLevel & mesh,
+                                  DomainPartition & domain,
+                                  bool const allowOverlap = false );
+
+  /**
+   * @brief Complete a pending synchronization of the Newton update fields.
+   * @param mesh the mesh level holding the fields
+   *
+   * Waits for the ghost values and recomputes the dependent quantities of the ghost
+   * cells with UpdateGhostState(). Does nothing if no synchronization is pending.
+   */
+  void CompleteSolutionSynchronization( MeshLevel & mesh );
+
+  /**
+   * @brief Recompute the dependent quantities of the ghost cells of a subregion.
+   * @param dataGroup the subregion storing the required fields
+   * @param targetIndex the index of the subregion in the target regions
+   * @param ghostSet the ghost cells of the subregion
+   *
+   * Must be overridden by solvers calling SynchronizeSolutionFields() with overlap allowed.
+   */
+  virtual void UpdateGhostState( Group & dataGroup,
+                                 localIndex const targetIndex,
+                                 SortedArrayView< localIndex const > const & ghostSet ) const;
+
+  /**
+   * @brief Compute the largest pressure change of the step over the owned cells, relative to targetPressureChange.
+   * @param mesh the mesh level holding the fields
+   * @return the ratio, or -1 if no target pressure change is set
+   *
+   * Must be called before the pressure increments are applied at the end of the step.
+   */
+  real64 ComputePressureChangeRatio( MeshLevel const & mesh ) const;
+
+  /**
+   * @brief Assemble the flux terms, overlapping a pending synchronization with the interior connections.
+   * @param mesh the mesh level holding the fields
+   * @param assembleFluxTerms callable assembling the flux terms of the connections in m_fluxConnections
+   *
+   * If a synchronization is pending, the connections between owned cells are assembled first,
+   * then the synchronization is completed and the connections involving ghost cells are assembled.
+   */
+  template< typename LAMBDA >
+  void AssembleFluxTermsOverlapped( MeshLevel & mesh, LAMBDA && assembleFluxTerms )
+  {
+    if( !m_solutionSyncPending )
+    {
+      assembleFluxTerms();
+      return;
+    }
+    m_fluxConnections = CompiledStencilTPFA::Connections::Interior;
+    assembleFluxTerms();
+    CompleteSolutionSynchronization( mesh );
+    m_fluxConnections = CompiledStencilTPFA::Connections::Boundary;
+    assembleFluxTerms();
+    m_fluxConnections = CompiledStencilTPFA::Connections::All;
+  }
+
   virtual void PostProcessInput() override;
 
   virtual void InitializePreSubGroups( Group * const rootGroup ) override;
@@ -171,6 +259,40 @@ protected:
 
   real64 m_meanPermCoeff;
 
+  /// flag to assemble the flux terms color by color without atomics (host only)
+  integer m_coloredAssembly;
+
+  /// flag to assemble the flux terms using the compiled cell stencil
+  integer m_useCompiledStencil;
+
+  /// cell stencil with pre-resolved DoF numbers and local rows, compiled on first use in the (const) flux
+  /// assembly for the DoF manager actually assembling, and rebuilt when the stencil or the numbering version changes
+  mutable CompiledStencilTPFA m_compiledCellStencil;
+
+  /// cached plan for the synchronization of Newton update fields
+  std::unique_ptr< SyncPlan > m_solutionSyncPlan;
+
+  /// ghost cells of the target subregions (indexed by region and subregion), built along with the synchronization plan
+  array1d< array1d< SortedArray< localIndex > > > m_targetGhostSets;
+
+  /// ghosting version of the mesh when the ghost sets were built
+  localIndex m_targetGhostSetsVersion;
+
+  /// flag to overlap the synchronization of Newton update fields with the interior flux assembly
+  integer m_overlapHaloExchange;
+
+  /// target pressure change over a time step for the solution change time step control
+  real64 m_targetPressureChange;
+
+  /// flag set while the solver drives its own Newton loop (i.e. is not coupled)
+  bool m_inOwnNonlinearSolve;
+
+  /// flag indicating that a synchronization of Newton update fields has been started but not completed
+  bool m_solutionSyncPending;
+
+  /// the subset of cell stencil connections assembled by the flux kernels
+  CompiledStencilTPFA::Connections m_fluxConnections;
+
   /// views into constant data fields
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_elemGhostRank;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > >  m_volume;
@@ -82,6 +82,9 @@ ProppantTransport::ProppantTransport( const std::string & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Flag that enables/disables proppant-packing update" );
 
+  // the proppant flux kernels do not implement the colored assembly
+  this->getWrapper< integer >( viewKeyStruct::coloredAssemblyString )->
+    setInputFlag( InputFlags::FALSE );
 }
 
 void ProppantTransport::PostProcessInput()
@@ -213,6 +213,43 @@ void SinglePhaseBase::UpdateState( Group & dataGroup, localIndex const targetInd
   UpdateMobility( dataGroup, targetIndex );
 }
 
+void SinglePhaseBase::UpdateGhostState( Group & dataGroup,
+                                        localIndex const targetIndex,
+                                        SortedArrayView< localIndex const > const & ghostSet ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const & pres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+  arrayView1d< real64 const > const & dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+  SingleFluidBase & fluid = GetConstitutiveModel< SingleFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    FluidUpdateKernel::Launch( ghostSet, fluidWrapper, pres, dPres );
+  } );
+
+  // the solid update is a cheap batch update, not worth restricting to the ghost cells
+  UpdateSolidModel( dataGroup, targetIndex );
+
+  arrayView1d< real64 > const & mob =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::mobilityString );
+
+  arrayView1d< real64 > const & dMob_dPres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::dMobility_dPressureString );
+
+  FluidPropViews fluidProps = getFluidProperties( fluid );
+
+  SinglePhaseBaseKernels::MobilityKernel::Launch< parallelDevicePolicy<> >( ghostSet,
+                                                                            fluidProps.dens,
+                                                                            fluidProps.dDens_dPres,
+                                                                            fluidProps.visc,
+                                                                            fluidProps.dVisc_dPres,
+                                                                            mob,
+                                                                            dMob_dPres );
+}
+
 void SinglePhaseBase::InitializePostInitialConditions_PreSubGroups( Group * const rootGroup )
 {
   GEOSX_MARK_FUNCTION;
@@ -301,7 +338,9 @@ real64 SinglePhaseBase::SolverStep( real64 const & time_n,
   ImplicitStepSetup( time_n, dt, domain );
 
   // currently the only method is implicit time integration
+  m_inOwnNonlinearSolve = true;
   dt_return = NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  m_inOwnNonlinearSolve = false;
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   ImplicitStepComplete( time_n, dt_return, domain );
@@ -371,6 +410,10 @@ void SinglePhaseBase::ImplicitStepComplete( real64 const & GEOSX_UNUSED_PARAM( t
 
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  CompleteSolutionSynchronization( mesh );
+
+  m_solutionChangeRatio = ComputePressureChangeRatio( mesh );
+
   forTargetSubRegions( mesh, [&]( localIndex const,
                                   ElementSubRegionBase & subRegion )
   {
@@ -437,13 +480,17 @@ void SinglePhaseBase::AssembleSystem( real64 const time_n,
                                                                 localRhs );
   }
 
-  AssembleFluxTerms( time_n,
-                     dt,
-                     domain,
-                     dofManager,
-                     localMatrix,
-                     localRhs );
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  AssembleFluxTermsOverlapped( mesh, [&]()
+  {
+    AssembleFluxTerms( time_n,
+                       dt,
+                       domain,
+                       dofManager,
+                       localMatrix,
+                       localRhs );
+  } );
 }
 
 template< bool ISPORO, typename POLICY >
@@ -752,6 +799,8 @@ void SinglePhaseBase::ResetStateToBeginningOfStep( DomainPartition & domain )
 {
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  CompleteSolutionSynchronization( mesh );
+
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex,
                                   ElementSubRegionBase & subRegion )
   {
@@ -310,6 +310,10 @@ protected:
    */
   void UpdateMobility( Group & dataGroup, localIndex const targetIndex ) const;
 
+  virtual void UpdateGhostState( Group & dataGroup,
+                                 localIndex const targetIndex,
+                                 SortedArrayView< localIndex const > const & ghostSet ) const override;
+
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_pressure;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_deltaPressure;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_deltaVolume;
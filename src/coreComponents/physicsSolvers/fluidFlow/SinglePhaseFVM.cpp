@@ -194,7 +194,9 @@ void SinglePhaseFVM< BASE >::ApplySystemSolution( DofManager const & dofManager,
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
 
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
+  // the ghost state of the proppant solver cannot be recomputed separately (see UpdateGhostState)
+  bool const allowOverlap = std::is_same< BASE, SinglePhaseBase >::value;
+  this->SynchronizeSolutionFields( fieldNames, mesh, domain, allowOverlap );
 
   forTargetSubRegions( mesh, [&] ( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
@@ -233,6 +235,8 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
   elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
   elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
 
+  CompiledStencilTPFA const & compiledStencil = this->getCompiledCellStencil( fluxApprox, mesh, dofManager, elemDofNumber );
+
   fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
   {
     FluxKernel::Launch( stencil,
@@ -258,7 +262,10 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
 #endif
                         localMatrix,
                         localRhs,
-                        m_derivativeFluxResidual_dAperture->toViewConstSizes() );
+                        m_derivativeFluxResidual_dAperture->toViewConstSizes(),
+                        m_coloredAssembly,
+                        compiledStencil,
+                        m_fluxConnections );
   } );
 }
 
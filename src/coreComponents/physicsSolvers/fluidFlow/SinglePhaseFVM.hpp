@@ -73,6 +73,8 @@ public:
   using BASE::m_numDofPerCell;
   using BASE::m_derivativeFluxResidual_dAperture;
   using BASE::m_fluxEstimate;
+  using BASE::m_coloredAssembly;
+  using BASE::m_fluxConnections;
   using BASE::m_elemGhostRank;
   using BASE::m_volume;
   using BASE::m_gravCoef;
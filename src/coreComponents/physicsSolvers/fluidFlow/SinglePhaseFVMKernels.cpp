@@ -382,7 +382,10 @@ void FluxKernel::
 #endif
                                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                     arrayView1d< real64 > const & localRhs,
-                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ) )
+                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ),
+                                    bool const coloredAssembly,
+                                    CompiledStencilTPFA const & compiledStencil,
+                                    CompiledStencilTPFA::Connections const connections )
 {
   constexpr localIndex maxNumFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
   constexpr localIndex numFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
@@ -394,7 +397,21 @@ void FluxKernel::
   typename CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
   typename CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
 
-  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  // pre-resolved DoF numbers and local rows, avoiding the element-based indirection
+  bool const useCompiledStencil = compiledStencil.isCompiledFrom( stencil );
+  arrayView2d< globalIndex const > const & compiledDofNumbers = compiledStencil.getDofNumbers();
+  arrayView2d< localIndex const > const & compiledLocalRows = compiledStencil.getLocalRows();
+
+  // assemble only a subset of the connections, as resolved by the compiled stencil
+  if( connections == CompiledStencilTPFA::Connections::Interior && !useCompiledStencil )
+  {
+    // the subsets are not available: all connections are assembled with the boundary ones
+    return;
+  }
+  bool const selectConnections = useCompiledStencil && connections != CompiledStencilTPFA::Connections::All;
+  bool const selectInterior = connections == CompiledStencilTPFA::Connections::Interior;
+
+  auto assembleConnection = [=] GEOSX_HOST_DEVICE ( localIndex const iconn, bool const useAtomics )
   {
     // working arrays
     stackArray1d< globalIndex, maxNumFluxElems > dofColIndices( stencilSize );
@@ -420,26 +437,89 @@ void FluxKernel::
     // extract DOF numbers
     for( localIndex i = 0; i < stencilSize; ++i )
     {
-      dofColIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      dofColIndices[i] = useCompiledStencil
+                         ? compiledDofNumbers( iconn, i )
+                         : dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
     }
 
     for( localIndex i = 0; i < numFluxElems; ++i )
     {
-      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+      bool const isOwned = useCompiledStencil
+                           ? compiledLocalRows( iconn, i ) >= 0
+                           : ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0;
+      if( isOwned )
       {
-        globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-        localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+        localIndex const localRow = useCompiledStencil
+                                    ? compiledLocalRows( iconn, i )
+                                    : LvArray::integerConversion< localIndex >( dofColIndices[i] - rankOffset );
         GEOSX_ASSERT_GE( localRow, 0 );
         GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
 
-        RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
-        localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                          dofColIndices.data(),
-                                                                          localFluxJacobian[i].dataIfContiguous(),
-                                                                          stencilSize );
+        if( useAtomics )
+        {
+          RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
+          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                            dofColIndices.data(),
+                                                                            localFluxJacobian[i].dataIfContiguous(),
+                                                                            stencilSize );
+        }
+        else
+        {
+          localRhs[localRow] += localFlux[i];
+          localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( localRow,
+                                                                    dofColIndices.data(),
+                                                                    localFluxJacobian[i].dataIfContiguous(),
+                                                                    stencilSize );
+        }
       }
     }
-  } );
+  };
+
+  if( coloredAssembly && stencil.isColored() )
+  {
+    // connections of the same color never share a cell, hence never write to the same row
+    arrayView1d< localIndex const > const & colorOffsets = stencil.getColorOffsets();
+    arrayView1d< localIndex const > const & coloredConnections = stencil.getColoredConnections();
+
+    for( localIndex color = 0; color < stencil.numColors(); ++color )
+    {
+      localIndex const colorBegin = colorOffsets[color];
+      forAll< parallelHostPolicy >( colorOffsets[color + 1] - colorBegin, [=] ( localIndex const k )
+      {
+        localIndex const iconn = coloredConnections[colorBegin + k];
+        if( selectConnections )
+        {
+          bool isInterior = true;
+          for( localIndex i = 0; i < numFluxElems; ++i )
+          {
+            isInterior = isInterior && compiledLocalRows( iconn, i ) >= 0;
+          }
+          if( isInterior != selectInterior )
+          {
+            return;
+          }
+        }
+        assembleConnection( iconn, false );
+      } );
+    }
+  }
+  else if( selectConnections )
+  {
+    arrayView1d< localIndex const > const & selectedConnections = selectInterior
+                                                                  ? compiledStencil.getInteriorConnections()
+                                                                  : compiledStencil.getBoundaryConnections();
+    forAll< parallelDevicePolicy<> >( selectedConnections.size(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      assembleConnection( selectedConnections[k], true );
+    } );
+  }
+  else
+  {
+    forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      assembleConnection( iconn, true );
+    } );
+  }
 }
 
 template<>
@@ -467,8 +547,17 @@ void FluxKernel::
 #endif
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                 arrayView1d< real64 > const & localRhs,
-                                CRSMatrixView< real64, localIndex const > const & dR_dAper )
+                                CRSMatrixView< real64, localIndex const > const & dR_dAper,
+                                bool const GEOSX_UNUSED_PARAM( coloredAssembly ),
+                                CompiledStencilTPFA const & GEOSX_UNUSED_PARAM( compiledStencil ),
+                                CompiledStencilTPFA::Connections const connections )
 {
+  if( connections == CompiledStencilTPFA::Connections::Interior )
+  {
+    // fracture connections are not split: they are all assembled with the boundary ones
+    return;
+  }
+
   constexpr localIndex maxNumFluxElems = FaceElementStencil::NUM_POINT_IN_FLUX;
   constexpr localIndex maxStencilSize = FaceElementStencil::MAX_STENCIL_SIZE;
 
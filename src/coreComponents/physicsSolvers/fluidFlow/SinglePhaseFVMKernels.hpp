@@ -21,6 +21,7 @@
 
 #include "common/DataTypes.hpp"
 #include "finiteVolume/BoundaryStencil.hpp"
+#include "finiteVolume/CompiledStencilTPFA.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
@@ -149,6 +150,11 @@ struct FluxKernel
    * @param[in] dMob_dPres The derivative of mobility wrt pressure in each element
    * @param[out] jacobian The linear system matrix
    * @param[out] residual The linear system residual
+   * @param[in] coloredAssembly flag to assemble color by color on host without atomics,
+   *            if the stencil provides a connection coloring
+   * @param[in] compiledStencil pre-resolved DoF numbers and local rows, used if compiled from @p stencil
+   * @param[in] connections the subset of connections to assemble, all connections being assembled
+   *            with the boundary ones if the subsets are not available (see CompiledStencilTPFA)
    */
   template< typename STENCIL_TYPE >
   static void
@@ -175,7 +181,10 @@ struct FluxKernel
 #endif
             CRSMatrixView< real64, globalIndex const > const & localMatrix,
             arrayView1d< real64 > const & localRhs,
-            CRSMatrixView< real64, localIndex const > const & dR_dAper );
+            CRSMatrixView< real64, localIndex const > const & dR_dAper,
+            bool const coloredAssembly,
+            CompiledStencilTPFA const & compiledStencil,
+            CompiledStencilTPFA::Connections const connections );
 
 
   /**
@@ -43,6 +43,10 @@ SinglePhaseHybridFVM::SinglePhaseHybridFVM( const std::string & name,
 
   // one cell-centered dof per cell
   m_numDofPerCell = 1;
+
+  // the hybrid flux kernels do not implement the colored assembly
+  this->getWrapper< integer >( viewKeyStruct::coloredAssemblyString )->
+    setInputFlag( InputFlags::FALSE );
 }
 
 
@@ -1332,7 +1332,9 @@ void HydrofractureSolver::SolveSystem( DofManager const & GEOSX_UNUSED_PARAM( do
   //    BiCGstab sometimes shows better parallel performance.
   //    false is probably better.
 
-  LinearSolverParameters const & linParams = m_linearSolverParameters.get();
+  // the adaptive tolerance of the Newton loop, if any, replaces the fixed tolerance of this solve only
+  bool isCapped;
+  LinearSolverParameters const linParams = NextLinearSolverParameters( isCapped );
 
   const bool use_diagonal_prec = true;
   const bool use_bicgstab      = (linParams.solverType == LinearSolverParameters::SolverType::bicgstab);
@@ -1608,9 +1610,10 @@ void HydrofractureSolver::SolveSystem( DofManager const & GEOSX_UNUSED_PARAM( do
     /* TODO: replace with SolverBase status output */
 
     integer numKrylovIter = status.extraParameters->get< int >( "Iteration Count" );
+    m_nonlinearSolverParameters.m_totalLinearIterations += numKrylovIter;
     if( getLogLevel()>=2 )
     {
-      GEOSX_LOG_RANK_0( "\t\tLinear Solver | Iter = " << numKrylovIter <<
+      GEOSX_LOG_RANK_0( "\t\tLinear Solver | Iter = " << numKrylovIter << ( isCapped ? " (capped)" : "" ) <<
                         " | TargetReduction " << linParams.krylov.relTolerance <<
                         " | AuxTime " << auxTime <<
                         " | SetupTime " << setupTime <<
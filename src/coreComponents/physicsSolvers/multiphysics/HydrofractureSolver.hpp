@@ -114,6 +114,10 @@ public:
   virtual void SetNextDt( real64 const & currentDt,
                           real64 & nextDt ) override;
 
+  /// The timestep follows the request of the surface generator, which is rank-local
+  virtual bool IsTimestepRequestRankInvariant() const override
+  { return false; }
+
 
   virtual real64 ExplicitStep( real64 const & time_n,
                                real64 const & dt,
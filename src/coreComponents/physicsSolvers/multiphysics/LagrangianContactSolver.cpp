@@ -541,6 +541,11 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
       ComputeFractureStateStatistics( domain, numStick, numSlip, numOpen, true );
     }
 
+    if( m_nonlinearSolverParameters.m_initialGuessOrder > 0 )
+    {
+      ApplyExtrapolatedInitialGuess( stepDt, domain );
+    }
+
     integer & activeSetIter = m_activeSetIter;
     for( activeSetIter = 0; activeSetIter < m_activeSetMaxIter; ++activeSetIter )
     {
@@ -565,39 +570,44 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
           std::cout<<output<<std::endl;
         }
 
-        // zero out matrix/rhs before assembly
-        m_localMatrix.setValues< parallelHostPolicy >( 0.0 );
-        m_localRhs.setValues< parallelHostPolicy >( 0.0 );
-
-        // call assemble to fill the matrix and the rhs
-        AssembleSystem( time_n,
-                        stepDt,
-                        domain,
-                        m_dofManager,
-                        m_localMatrix.toViewConstSizes(),
-                        m_localRhs.toView() );
-
-        // apply boundary conditions to system
-        ApplyBoundaryConditions( time_n,
-                                 stepDt,
-                                 domain,
-                                 m_dofManager,
-                                 m_localMatrix.toViewConstSizes(),
-                                 m_localRhs.toView() );
-
-        // TODO: maybe add scale function here?
-        // Scale()
-
         real64 residualNorm;
-        // get residual norm
-        if( computeResidual )
+        // the system is assembled again from the previous state if the extrapolated initial guess is rejected
+        do
         {
-          residualNorm = CalculateResidualNorm( domain, m_dofManager, m_localRhs.toViewConst() );
-        }
-        else
-        {
-          residualNorm = lastResidual;
+          // zero out matrix/rhs before assembly
+          m_localMatrix.setValues< parallelHostPolicy >( 0.0 );
+          m_localRhs.setValues< parallelHostPolicy >( 0.0 );
+
+          // call assemble to fill the matrix and the rhs
+          AssembleSystem( time_n,
+                          stepDt,
+                          domain,
+                          m_dofManager,
+                          m_localMatrix.toViewConstSizes(),
+                          m_localRhs.toView() );
+
+          // apply boundary conditions to system
+          ApplyBoundaryConditions( time_n,
+                                   stepDt,
+                                   domain,
+                                   m_dofManager,
+                                   m_localMatrix.toViewConstSizes(),
+                                   m_localRhs.toView() );
+
+          // TODO: maybe add scale function here?
+          // Scale()
+
+          // get residual norm
+          if( computeResidual )
+          {
+            residualNorm = CalculateResidualNorm( domain, m_dofManager, m_localRhs.toViewConst() );
+          }
+          else
+          {
+            residualNorm = lastResidual;
+          }
         }
+        while( newtonIter == 0 && !CheckInitialGuess( residualNorm, domain ) );
 
         if( getLogLevel() >= 1 && logger::internal::rank==0 )
         {
@@ -622,14 +632,10 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
         }
 
         // if using adaptive Krylov tolerance scheme, update tolerance.
-        LinearSolverParameters::Krylov & krylovParams = m_linearSolverParameters.get().krylov;
-        if( krylovParams.useAdaptiveTol )
-        {
-          krylovParams.relTolerance = EisenstatWalker( residualNorm, lastResidual, krylovParams.weakestTol );
-        }
+        UpdateAdaptiveLinearTolerance( residualNorm, lastResidual );
 
         // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-        m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+        ComposeParallelMatrix();
         m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
         m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
@@ -682,6 +688,7 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
         {
           // apply the system solution to the fields/variables
           ApplySystemSolution( m_dofManager, m_localSolution.toViewConst(), scaleFactor, domain );
+          AccumulateStepIncrement( m_localSolution.toViewConst(), scaleFactor );
           // Need to compute the residual norm
           computeResidual = true;
         }
@@ -730,6 +737,10 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
         useElasticStep = false;
         ResetStateToBeginningOfStep( domain );
         SetFractureStateForElasticStep( domain );
+        if( m_nonlinearSolverParameters.m_initialGuessOrder > 0 )
+        {
+          ApplyExtrapolatedInitialGuess( stepDt, domain );
+        }
       }
       else
       {
@@ -763,6 +774,8 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
     }
   }
 
+  RecordStepIncrement( stepDt, isNewtonConverged && isActiveSetConverged );
+
   if( !isActiveSetConverged )
   {
     GEOSX_ERROR( "Active set did not reached a solution. Terminating..." );
@@ -803,6 +816,7 @@ bool LagrangianContactSolver::LineSearch( real64 const & time_n,
   real64 residualNorm0 = lastResidual;
 
   ApplySystemSolution( dofManager, localSolution, scaleFactor, domain );
+  AccumulateStepIncrement( localSolution, scaleFactor );
 
   // re-assemble system
   localMatrix.setValues< parallelHostPolicy >( 0.0 );
@@ -844,6 +858,7 @@ bool LagrangianContactSolver::LineSearch( real64 const & time_n,
     }
 
     ApplySystemSolution( dofManager, localSolution, deltaLocalScaleFactor, domain );
+    AccumulateStepIncrement( localSolution, deltaLocalScaleFactor );
     lamm = lamc;
     lamc = localScaleFactor;
 
@@ -0,0 +1,602 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsEmbeddedFracturesKernels.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEMBEDDEDFRACTURESKERNELS_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEMBEDDEDFRACTURESKERNELS_HPP_
+
+#include "finiteElement/kernelInterface/ImplicitKernelBase.hpp"
+#include "mesh/EmbeddedSurfaceSubRegion.hpp"
+
+namespace geosx
+{
+
+namespace SolidMechanicsEmbeddedFracturesKernels
+{
+
+/**
+ * @brief Implements the assembly of the coupling between the displacement and the
+ *        displacement jump of the embedded fractures.
+ * @copydoc geosx::finiteElement::ImplicitKernelBase
+ *
+ * ### EFEM Description
+ * Assembles the Kwu, Kuw and Kww blocks and the jump residual of the embedded finite
+ * element method, for the cells of @p SUBREGION_TYPE cut by an embedded surface element.
+ * The displacement/displacement block is assembled by the solid mechanics solver.
+ *
+ * The element index passed to the kernel functions is the index of the embedded surface
+ * element, the cut cell is found through the embedded surface to cell map. All the
+ * element operators are compile-time sized stack arrays.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class EFEM :
+  public finiteElement::ImplicitKernelBase< SUBREGION_TYPE,
+                                            CONSTITUTIVE_TYPE,
+                                            FE_TYPE,
+                                            3,
+                                            3 >
+{
+public:
+  /// Alias for the base class;
+  using Base = finiteElement::ImplicitKernelBase< SUBREGION_TYPE,
+                                                  CONSTITUTIVE_TYPE,
+                                                  FE_TYPE,
+                                                  3,
+                                                  3 >;
+
+  /// Number of nodes per element
+  static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
+
+  /// Number of displacement dofs per element
+  static constexpr int numUdofs = numNodesPerElem * 3;
+
+  /// Number of displacement jump dofs per embedded surface element
+  static constexpr int numWdofs = 3;
+
+  using Base::m_dofNumber;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
+   * @param embeddedSurfSubRegion the subregion of embedded surface elements
+   * @param dispDofNumber the displacement dof numbers
+   * @param jumpDofNumber the displacement jump dof numbers
+   * @param dispJump the displacement jump
+   * @param contactStiffness the penalty stiffness of the contact condition
+   */
+  EFEM( NodeManager const & nodeManager,
+        EdgeManager const & edgeManager,
+        FaceManager const & faceManager,
+        SUBREGION_TYPE const & elementSubRegion,
+        FE_TYPE const & finiteElementSpace,
+        CONSTITUTIVE_TYPE * const inputConstitutiveType,
+        EmbeddedSurfaceSubRegion const & embeddedSurfSubRegion,
+        arrayView1d< globalIndex const > const & dispDofNumber,
+        arrayView1d< globalIndex const > const & jumpDofNumber,
+        arrayView1d< R1Tensor const > const & dispJump,
+        globalIndex const rankOffset,
+        CRSMatrixView< real64, globalIndex const > const & inputMatrix,
+        arrayView1d< real64 > const & inputRhs,
+        real64 const contactStiffness ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          dispDofNumber,
+          rankOffset,
+          inputMatrix,
+          inputRhs ),
+    m_X( nodeManager.referencePosition() ),
+    m_disp( nodeManager.totalDisplacement() ),
+    m_dNdX( elementSubRegion.dNdX() ),
+    m_detJ( elementSubRegion.detJ() ),
+    m_elementVolume( elementSubRegion.getElementVolume() ),
+    m_jumpDofNumber( jumpDofNumber ),
+    m_dispJump( dispJump ),
+    m_surfaceToCell( embeddedSurfSubRegion.getSurfaceToCellList() ),
+    m_surfaceCenter( embeddedSurfSubRegion.getElementCenter() ),
+    m_surfaceArea( embeddedSurfSubRegion.getElementArea() ),
+    m_normalVector( embeddedSurfSubRegion.getNormalVector().toViewConst() ),
+    m_tangentVector1( embeddedSurfSubRegion.getTangentVector1().toViewConst() ),
+    m_tangentVector2( embeddedSurfSubRegion.getTangentVector2().toViewConst() ),
+    m_contactStiffness( contactStiffness )
+  {
+    GEOSX_ERROR_IF_NE( embeddedSurfSubRegion.numOfJumpEnrichments(), numWdofs );
+
+    // collect the locally owned embedded surface elements cutting a cell of this subregion
+    localIndex const regionIndex = elementSubRegion.getParent()->getParent()->getIndexInParent();
+    localIndex const subRegionIndex = elementSubRegion.getIndexInParent();
+    arrayView1d< localIndex const > const & surfaceToRegion = embeddedSurfSubRegion.getSurfaceToRegionList();
+    arrayView1d< localIndex const > const & surfaceToSubRegion = embeddedSurfSubRegion.getSurfaceToSubRegionList();
+    arrayView1d< integer const > const & surfaceGhostRank = embeddedSurfSubRegion.ghostRank();
+    for( localIndex k = 0; k < embeddedSurfSubRegion.size(); ++k )
+    {
+      if( surfaceGhostRank[k] < 0 && surfaceToRegion[k] == regionIndex && surfaceToSubRegion[k] == subRegionIndex )
+      {
+        m_fracturedElems.emplace_back( k );
+      }
+    }
+  }
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::StackVariables
+   *
+   * The base local residual holds the displacement residual. Adds the jump dofs, the
+   * coupling blocks, the jump residual and the element operators constant over the element.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            jumpRowDofIndex{ 0 },
+            jumpColDofIndex{ 0 },
+            localJumpResidual{ 0.0 },
+            localKww{ {0.0} },
+            localKwu{ {0.0} },
+            localKuw{ {0.0} },
+            uLocal{ 0.0 },
+            wLocal{ 0.0 },
+            heaviside{ 0.0 },
+            constitutiveStiffness{ {0.0} },
+            eqMatrixD{ {0.0} }
+    {}
+
+    /// Row indices of the jump dofs
+    globalIndex jumpRowDofIndex[numWdofs];
+
+    /// Column indices of the jump dofs
+    globalIndex jumpColDofIndex[numWdofs];
+
+    /// Residual of the jump equations
+    real64 localJumpResidual[numWdofs];
+
+    /// Jump/jump block
+    real64 localKww[numWdofs][numWdofs];
+
+    /// Jump/displacement block
+    real64 localKwu[numWdofs][numUdofs];
+
+    /// Displacement/jump block
+    real64 localKuw[numUdofs][numWdofs];
+
+    /// Nodal displacements of the cut cell
+    real64 uLocal[numUdofs];
+
+    /// Displacement jump of the embedded surface element
+    real64 wLocal[numWdofs];
+
+    /// Heaviside function of the nodes of the cut cell
+    real64 heaviside[numNodesPerElem];
+
+    /// Elastic stiffness of the cut cell
+    real64 constitutiveStiffness[6][6];
+
+    /// Product of the equilibrium operator and the elastic stiffness
+    real64 eqMatrixD[numWdofs][6];
+  };
+  //*****************************************************************************
+
+  /**
+   * @brief Launch the kernel over the embedded surface elements cutting the subregion.
+   * @tparam POLICY the host policy to use for the launch
+   * @tparam KERNEL_TYPE the type of kernel to execute
+   * @param numElems the number of elements of the subregion, unused
+   * @param kernelComponent the kernel
+   * @return the maximum contribution to the displacement residual
+   * @note The kernel holds host data and is captured by reference, only host policies can be used.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+    GEOSX_UNUSED_VAR( numElems );
+
+    arrayView1d< localIndex const > const & fracturedElems = kernelComponent.m_fracturedElems.toViewConst();
+
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
+    forAll< POLICY >( fracturedElems.size(),
+                      [=, &kernelComponent] ( localIndex const i )
+    {
+      localIndex const k = fracturedElems[i];
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+      for( integer q=0; q<Base::numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointJacobianContribution( k, q, stack );
+      }
+      maxResidual.max( kernelComponent.complete( k, stack ) );
+    } );
+    return maxResidual.get();
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::setup
+   *
+   * Gathers the dofs and values of the displacement and the jump, the Heaviside function
+   * of the nodes and the product of the equilibrium operator with the elastic stiffness.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    localIndex const cellIndex = m_surfaceToCell[k];
+
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( cellIndex, a );
+
+      real64 distance = 0.0;
+      for( int i=0; i<3; ++i )
+      {
+        stack.localRowDofIndex[a*3+i] = m_dofNumber[localNodeIndex]+i;
+        stack.localColDofIndex[a*3+i] = m_dofNumber[localNodeIndex]+i;
+        stack.uLocal[a*3+i] = m_disp[localNodeIndex][i];
+        distance += ( m_X[localNodeIndex][i] - m_surfaceCenter[k][i] ) * m_normalVector[k][i];
+      }
+      stack.heaviside[a] = distance > 0 ? 1 : 0;
+    }
+
+    for( int i=0; i<numWdofs; ++i )
+    {
+      stack.jumpRowDofIndex[i] = m_jumpDofNumber[k]+i;
+      stack.jumpColDofIndex[i] = m_jumpDofNumber[k]+i;
+      stack.wLocal[i] = m_dispJump[k][i];
+    }
+
+    real64 eqMatrix[numWdofs][6];
+    computeEquilibriumOperator( k, m_surfaceArea[k] / m_elementVolume[cellIndex], eqMatrix );
+
+    m_constitutiveUpdate.GetStiffness( cellIndex, 0, stack.constitutiveStiffness );
+    LvArray::tensorOps::AikBkj< numWdofs, 6, 6 >( stack.eqMatrixD, eqMatrix, stack.constitutiveStiffness );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointJacobianContribution
+   *
+   * Adds the quadrature point contributions EDC, EDB and B^T DC to the Kww, Kwu and Kuw blocks.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointJacobianContribution( localIndex const k,
+                                            localIndex const q,
+                                            StackVariables & stack ) const
+  {
+    localIndex const cellIndex = m_surfaceToCell[k];
+    real64 const detJ = m_detJ( cellIndex, q );
+
+    // m = -sum( dNdX(a) * H(a) )
+    real64 mVec[3] = { 0.0, 0.0, 0.0 };
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      for( int i=0; i<3; ++i )
+      {
+        mVec[i] -= m_dNdX( cellIndex, q, a, i ) * stack.heaviside[a];
+      }
+    }
+
+    real64 compMatrix[6][numWdofs];
+    computeCompatibilityOperator( k, mVec, compMatrix );
+
+    real64 strainMatrix[6][numUdofs];
+    computeStrainOperator( cellIndex, q, strainMatrix );
+
+    real64 matDC[6][numWdofs];
+    real64 Kww_gauss[numWdofs][numWdofs];
+    real64 Kwu_gauss[numWdofs][numUdofs];
+    real64 Kuw_gauss[numUdofs][numWdofs];
+
+    LvArray::tensorOps::AikBkj< 6, numWdofs, 6 >( matDC, stack.constitutiveStiffness, compMatrix );
+    LvArray::tensorOps::AikBkj< numWdofs, numWdofs, 6 >( Kww_gauss, stack.eqMatrixD, compMatrix );
+    LvArray::tensorOps::AikBkj< numWdofs, numUdofs, 6 >( Kwu_gauss, stack.eqMatrixD, strainMatrix );
+    LvArray::tensorOps::AkiBkj< numUdofs, numWdofs, 6 >( Kuw_gauss, strainMatrix, matDC );
+
+    for( int i=0; i<numWdofs; ++i )
+    {
+      for( int j=0; j<numWdofs; ++j )
+      {
+        stack.localKww[i][j] -= Kww_gauss[i][j] * detJ;
+      }
+      for( int j=0; j<numUdofs; ++j )
+      {
+        stack.localKwu[i][j] -= Kwu_gauss[i][j] * detJ;
+        stack.localKuw[j][i] -= Kuw_gauss[j][i] * detJ;
+      }
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   *
+   * Adds the contact contribution, computes the residuals and assembles the coupling blocks,
+   * the jump/jump block and the residuals into the global system.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+
+    real64 tractionVec[numWdofs];
+    real64 dTdw[numWdofs][numWdofs];
+    computeTraction( stack.wLocal, tractionVec, dTdw );
+
+    for( int i=0; i<numWdofs; ++i )
+    {
+      for( int j=0; j<numWdofs; ++j )
+      {
+        stack.localKww[i][j] -= dTdw[i][j];
+      }
+    }
+
+    // R1 = Kww w + Kwu u + t
+    LvArray::tensorOps::AijBj< numWdofs, numWdofs >( stack.localJumpResidual, stack.localKww, stack.wLocal );
+    LvArray::tensorOps::plusAijBj< numWdofs, numUdofs >( stack.localJumpResidual, stack.localKwu, stack.uLocal );
+    LvArray::tensorOps::add< numWdofs >( stack.localJumpResidual, tractionVec );
+
+    // R0 = Kuw w
+    LvArray::tensorOps::AijBj< numUdofs, numWdofs >( stack.localResidual, stack.localKuw, stack.wLocal );
+
+    real64 maxForce = 0;
+
+    for( int i=0; i<numUdofs; ++i )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[i] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+
+      m_matrix.template addToRowBinarySearchUnsorted< parallelHostAtomic >( dof,
+                                                                            stack.jumpColDofIndex,
+                                                                            stack.localKuw[i],
+                                                                            numWdofs );
+
+      RAJA::atomicAdd< parallelHostAtomic >( &m_rhs[dof], stack.localResidual[i] );
+      maxForce = fmax( maxForce, fabs( stack.localResidual[i] ) );
+    }
+
+    for( int i=0; i<numWdofs; ++i )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.jumpRowDofIndex[i] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+
+      m_matrix.template addToRowBinarySearchUnsorted< parallelHostAtomic >( dof,
+                                                                            stack.jumpColDofIndex,
+                                                                            stack.localKww[i],
+                                                                            numWdofs );
+
+      m_matrix.template addToRowBinarySearchUnsorted< parallelHostAtomic >( dof,
+                                                                            stack.localColDofIndex,
+                                                                            stack.localKwu[i],
+                                                                            numUdofs );
+
+      RAJA::atomicAdd< parallelHostAtomic >( &m_rhs[dof], stack.localJumpResidual[i] );
+    }
+
+    return maxForce;
+  }
+
+protected:
+
+  /**
+   * @brief Compute the equilibrium operator of an embedded surface element.
+   * @param k the embedded surface element index
+   * @param hInv the ratio of the surface area to the cut cell volume
+   * @param eqMatrix the equilibrium operator
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void computeEquilibriumOperator( localIndex const k,
+                                   real64 const hInv,
+                                   real64 (& eqMatrix)[numWdofs][6] ) const
+  {
+    real64 nDn[3][3], t1DnSym[3][3], t2DnSym[3][3];
+
+    // n dyadic n
+    LvArray::tensorOps::AiBj< 3, 3 >( nDn, m_normalVector[k], m_normalVector[k] );
+
+    // sym(n dyadic t1) and sym (n dyadic t2)
+    LvArray::tensorOps::AiBj< 3, 3 >( t1DnSym, m_normalVector[k], m_tangentVector1[k] );
+    LvArray::tensorOps::plusAiBj< 3, 3 >( t1DnSym, m_tangentVector1[k], m_normalVector[k] );
+    LvArray::tensorOps::scale< 3, 3 >( t1DnSym, 0.5 );
+
+    LvArray::tensorOps::AiBj< 3, 3 >( t2DnSym, m_normalVector[k], m_tangentVector2[k] );
+    LvArray::tensorOps::plusAiBj< 3, 3 >( t2DnSym, m_tangentVector2[k], m_normalVector[k] );
+    LvArray::tensorOps::scale< 3, 3 >( t2DnSym, 0.5 );
+
+    LvArray::tensorOps::fill< numWdofs, 6 >( eqMatrix, 0 );
+    for( int i=0; i < 3; ++i )
+    {
+      for( int j=0; j < 3; ++j )
+      {
+        int const voigtIndex = ( i == j ) ? 1 : 6 - i - j;
+        eqMatrix[0][voigtIndex] += nDn[i][j];
+        eqMatrix[1][voigtIndex] += t1DnSym[i][j];
+        eqMatrix[2][voigtIndex] += t2DnSym[i][j];
+      }
+    }
+    LvArray::tensorOps::scale< numWdofs, 6 >( eqMatrix, -hInv );
+  }
+
+  /**
+   * @brief Compute the compatibility operator of an embedded surface element at a quadrature point.
+   * @param k the embedded surface element index
+   * @param mVec the sum of the shape function derivatives weighted by the Heaviside function
+   * @param compMatrix the compatibility operator
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void computeCompatibilityOperator( localIndex const k,
+                                     real64 const (&mVec)[3],
+                                     real64 (& compMatrix)[6][numWdofs] ) const
+  {
+    real64 nDmSym[3][3], t1DmSym[3][3], t2DmSym[3][3];
+
+    // sym(n dyadic m)
+    LvArray::tensorOps::AiBj< 3, 3 >( nDmSym, mVec, m_normalVector[k] );
+    LvArray::tensorOps::plusAiBj< 3, 3 >( nDmSym, m_normalVector[k], mVec );
+    LvArray::tensorOps::scale< 3, 3 >( nDmSym, 0.5 );
+
+    // sym(m dyadic t1) and sym (m dyadic t2)
+    LvArray::tensorOps::AiBj< 3, 3 >( t1DmSym, mVec, m_tangentVector1[k] );
+    LvArray::tensorOps::plusAiBj< 3, 3 >( t1DmSym, m_tangentVector1[k], mVec );
+    LvArray::tensorOps::scale< 3, 3 >( t1DmSym, 0.5 );
+
+    LvArray::tensorOps::AiBj< 3, 3 >( t2DmSym, mVec, m_tangentVector2[k] );
+    LvArray::tensorOps::plusAiBj< 3, 3 >( t2DmSym, m_tangentVector2[k], mVec );
+    LvArray::tensorOps::scale< 3, 3 >( t2DmSym, 0.5 );
+
+    LvArray::tensorOps::fill< 6, numWdofs >( compMatrix, 0 );
+    for( int i=0; i < 3; ++i )
+    {
+      for( int j=0; j < 3; ++j )
+      {
+        int const voigtIndex = ( i == j ) ? 1 : 6 - i - j;
+        compMatrix[voigtIndex][0] += nDmSym[i][j];
+        compMatrix[voigtIndex][1] += t1DmSym[i][j];
+        compMatrix[voigtIndex][2] += t2DmSym[i][j];
+      }
+    }
+  }
+
+  /**
+   * @brief Compute the strain operator (B) of the cut cell at a quadrature point.
+   * @param cellIndex the cut cell index
+   * @param q the quadrature point index
+   * @param strainMatrix the strain operator
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void computeStrainOperator( localIndex const cellIndex,
+                              localIndex const q,
+                              real64 (& strainMatrix)[6][numUdofs] ) const
+  {
+    LvArray::tensorOps::fill< 6, numUdofs >( strainMatrix, 0 );
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      strainMatrix[0][a*3 + 0] = m_dNdX( cellIndex, q, a, 0 );
+      strainMatrix[1][a*3 + 1] = m_dNdX( cellIndex, q, a, 1 );
+      strainMatrix[2][a*3 + 2] = m_dNdX( cellIndex, q, a, 2 );
+
+      strainMatrix[3][a*3 + 1] = m_dNdX( cellIndex, q, a, 2 );
+      strainMatrix[3][a*3 + 2] = m_dNdX( cellIndex, q, a, 1 );
+
+      strainMatrix[4][a*3 + 0] = m_dNdX( cellIndex, q, a, 2 );
+      strainMatrix[4][a*3 + 2] = m_dNdX( cellIndex, q, a, 0 );
+
+      strainMatrix[5][a*3 + 0] = m_dNdX( cellIndex, q, a, 1 );
+      strainMatrix[5][a*3 + 1] = m_dNdX( cellIndex, q, a, 0 );
+    }
+  }
+
+  /**
+   * @brief Compute the traction on the fracture and its derivative with respect to the jump.
+   * @param dispJump the displacement jump
+   * @param tractionVector the traction
+   * @param dTdw the derivative of the traction with respect to the jump
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void computeTraction( real64 const (&dispJump)[numWdofs],
+                        real64 (& tractionVector)[numWdofs],
+                        real64 (& dTdw)[numWdofs][numWdofs] ) const
+  {
+    LvArray::tensorOps::fill< numWdofs, numWdofs >( dTdw, 0 );
+    tractionVector[1] = 0.0;
+    tractionVector[2] = 0.0;
+
+    // check if fracture is open
+    if( dispJump[0] >= 0 )
+    {
+      tractionVector[0] = 1e5;
+    }
+    else
+    {
+      // Contact through penalty condition.
+      tractionVector[0] = m_contactStiffness * dispJump[0];
+    }
+  }
+
+  /// The reference position of the nodes.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The rank-global displacement array.
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const m_disp;
+
+  /// The shape function derivative for each quadrature point.
+  arrayView4d< real64 const > const m_dNdX;
+
+  /// The parent->physical jacobian determinant for each quadrature point.
+  arrayView2d< real64 const > const m_detJ;
+
+  /// The volume of the cells.
+  arrayView1d< real64 const > const m_elementVolume;
+
+  /// The dof numbers of the displacement jump.
+  arrayView1d< globalIndex const > const m_jumpDofNumber;
+
+  /// The displacement jump.
+  arrayView1d< R1Tensor const > const m_dispJump;
+
+  /// The embedded surface element to cut cell map.
+  arrayView1d< localIndex const > const m_surfaceToCell;
+
+  /// The center of the embedded surface elements.
+  arrayView2d< real64 const > const m_surfaceCenter;
+
+  /// The area of the embedded surface elements.
+  arrayView1d< real64 const > const m_surfaceArea;
+
+  /// The normal vector of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_normalVector;
+
+  /// The first tangent vector of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_tangentVector1;
+
+  /// The second tangent vector of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_tangentVector2;
+
+  /// The penalty stiffness of the contact condition.
+  real64 const m_contactStiffness;
+
+  /// The embedded surface elements assembled by the kernel.
+  array1d< localIndex > m_fracturedElems;
+};
+
+} // namespace SolidMechanicsEmbeddedFracturesKernels
+
+} // namespace geosx
+
+#endif /* GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEMBEDDEDFRACTURESKERNELS_HPP_ */
@@ -0,0 +1,505 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/contact/ContactRelationBase.hpp"
+#include "constitutive/solid/LinearElasticIsotropic.hpp"
+#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mesh/EmbeddedSurfaceSubRegion.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsEmbeddedFractures.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::constitutive;
+
+namespace
+{
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+  "    <SolidMechanicsEmbeddedFractures name=\"mechSolve\"\n"
+  "                                     targetRegions=\"{Region1, Fracture}\"\n"
+  "                                     solidSolverName=\"matrixSolver\"\n"
+  "                                     contactRelationName=\"fractureContact\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"direct\"/>\n"
+  "    </SolidMechanicsEmbeddedFractures>\n"
+  "    <SolidMechanicsLagrangianSSLE name=\"matrixSolver\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{Region1}\"\n"
+  "                                  solidMaterialNames=\"{rock}\"/>\n"
+  "    <EmbeddedSurfaceGenerator name=\"SurfaceGenerator\"\n"
+  "                              solidMaterialNames=\"{rock}\"\n"
+  "                              targetRegions=\"{Region1, Fracture}\"\n"
+  "                              fractureRegion=\"Fracture\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 3}\"\n"
+  "                  yCoords=\"{0, 3}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{3}\"\n"
+  "                  ny=\"{3}\"\n"
+  "                  nz=\"{1}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <BoundedPlane name=\"FracturePlane\"\n"
+  "                  normal=\"0, 1, 0\"\n"
+  "                  origin=\"1.5, 1.3, 0.5\"\n"
+  "                  lengthVector=\"1, 0, 0\"\n"
+  "                  widthVector=\"0, 0, 1\"\n"
+  "                  dimensions=\"{2.9, 4}\"/>\n"
+  "  </Geometry>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{rock}\"/>\n"
+  "    <EmbeddedSurfaceElementRegion name=\"Fracture\" materialList=\"{rock}\" defaultAperture=\"1e-3\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <LinearElasticIsotropic name=\"rock\"\n"
+  "                            defaultDensity=\"2700\"\n"
+  "                            defaultBulkModulus=\"5.5556e9\"\n"
+  "                            defaultShearModulus=\"4.16667e9\"/>\n"
+  "    <Contact name=\"fractureContact\" penaltyStiffness=\"1.0e9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>";
+
+void setupProblemFromXML( ProblemManager & problemManager, char const * const xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput, strlen( xmlInput ) );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  int const mpiSize = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  Group * commandLine = problemManager.GetGroup< Group >( problemManager.groupKeys.commandLine );
+  commandLine->registerWrapper< integer >( problemManager.viewKeys.xPartitionsOverride.Key() )->
+    setApplyDefaultValue( mpiSize );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition & domain = *problemManager.getDomainPartition();
+
+  ConstitutiveManager & constitutiveManager = *domain.getConstitutiveManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( constitutiveManager.getName().c_str() );
+  constitutiveManager.ProcessInputFileRecursive( topLevelNode );
+
+  MeshManager & meshManager = *problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager.GenerateMeshLevels( &domain );
+
+  ElementRegionManager & elementManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  topLevelNode = xmlProblemNode.child( elementManager.getName().c_str() );
+  elementManager.ProcessInputFileRecursive( topLevelNode );
+
+  problemManager.ProblemSetup();
+}
+
+/**
+ * @brief Voigt index of a component of a symmetric second order tensor, in the ordering of the operators.
+ */
+int voigtIndex( int const i, int const j )
+{
+  return ( i == j ) ? 1 : 6 - i - j;
+}
+
+/**
+ * @brief Previous implementation of the equilibrium operator.
+ */
+void assembleEquilibriumOperator( array2d< real64 > & eqMatrix,
+                                  EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion,
+                                  localIndex const k,
+                                  real64 const hInv )
+{
+  R1Tensor const nVec  = embeddedSurfaceSubRegion.getNormalVector( k );
+  R1Tensor const tVec1 = embeddedSurfaceSubRegion.getTangentVector1( k );
+  R1Tensor const tVec2 = embeddedSurfaceSubRegion.getTangentVector2( k );
+
+  BlasLapackLA::matrixScale( 0, eqMatrix );
+
+  for( int i=0; i < 3; ++i )
+  {
+    for( int j=0; j < 3; ++j )
+    {
+      eqMatrix( 0, voigtIndex( i, j ) ) += nVec[i] * nVec[j];
+      eqMatrix( 1, voigtIndex( i, j ) ) += 0.5 * ( nVec[i] * tVec1[j] + tVec1[i] * nVec[j] );
+      eqMatrix( 2, voigtIndex( i, j ) ) += 0.5 * ( nVec[i] * tVec2[j] + tVec2[i] * nVec[j] );
+    }
+  }
+  BlasLapackLA::matrixScale( -hInv, eqMatrix );
+}
+
+/**
+ * @brief Previous implementation of the compatibility operator.
+ */
+void assembleCompatibilityOperator( array2d< real64 > & compMatrix,
+                                    EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion,
+                                    localIndex const k,
+                                    localIndex const q,
+                                    CellBlock::NodeMapType const & elemsToNodes,
+                                    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord,
+                                    localIndex const cellIndex,
+                                    arrayView4d< real64 const > const & dNdX )
+{
+  R1Tensor const nVec  = embeddedSurfaceSubRegion.getNormalVector( k );
+  R1Tensor const tVec1 = embeddedSurfaceSubRegion.getTangentVector1( k );
+  R1Tensor const tVec2 = embeddedSurfaceSubRegion.getTangentVector2( k );
+
+  real64 mVec[3] = { 0.0, 0.0, 0.0 };
+  for( localIndex a=0; a<elemsToNodes.size( 1 ); ++a )
+  {
+    real64 const heavisideFun = embeddedSurfaceSubRegion.ComputeHeavisideFunction( nodesCoord[ elemsToNodes[cellIndex][a] ], k );
+    for( int i=0; i<3; ++i )
+    {
+      mVec[i] -= dNdX( cellIndex, q, a, i ) * heavisideFun;
+    }
+  }
+
+  BlasLapackLA::matrixScale( 0, compMatrix );
+
+  for( int i=0; i < 3; ++i )
+  {
+    for( int j=0; j < 3; ++j )
+    {
+      compMatrix( voigtIndex( i, j ), 0 ) += 0.5 * ( mVec[i] * nVec[j] + nVec[i] * mVec[j] );
+      compMatrix( voigtIndex( i, j ), 1 ) += 0.5 * ( mVec[i] * tVec1[j] + tVec1[i] * mVec[j] );
+      compMatrix( voigtIndex( i, j ), 2 ) += 0.5 * ( mVec[i] * tVec2[j] + tVec2[i] * mVec[j] );
+    }
+  }
+}
+
+/**
+ * @brief Previous implementation of the strain operator.
+ */
+void assembleStrainOperator( array2d< real64 > & strainMatrix,
+                             localIndex const cellIndex,
+                             localIndex const q,
+                             localIndex const numNodesPerElement,
+                             arrayView4d< real64 const > const & dNdX )
+{
+  strainMatrix.setValues< serialPolicy >( 0 );
+  for( localIndex a=0; a<numNodesPerElement; ++a )
+  {
+    strainMatrix( 0, a*3 + 0 ) = dNdX( cellIndex, q, a, 0 );
+    strainMatrix( 1, a*3 + 1 ) = dNdX( cellIndex, q, a, 1 );
+    strainMatrix( 2, a*3 + 2 ) = dNdX( cellIndex, q, a, 2 );
+
+    strainMatrix( 3, a*3 + 1 ) = dNdX( cellIndex, q, a, 2 );
+    strainMatrix( 3, a*3 + 2 ) = dNdX( cellIndex, q, a, 1 );
+
+    strainMatrix( 4, a*3 + 0 ) = dNdX( cellIndex, q, a, 2 );
+    strainMatrix( 4, a*3 + 2 ) = dNdX( cellIndex, q, a, 0 );
+
+    strainMatrix( 5, a*3 + 0 ) = dNdX( cellIndex, q, a, 1 );
+    strainMatrix( 5, a*3 + 1 ) = dNdX( cellIndex, q, a, 0 );
+  }
+}
+
+/**
+ * @brief Previous assembly of the Kwu, Kuw and Kww blocks and of the coupling residuals,
+ *        with heap-allocated element operators and BLAS products.
+ */
+void assembleCouplingReference( DomainPartition & domain,
+                                DofManager const & dofManager,
+                                SolidMechanicsLagrangianFEM const & solidSolver,
+                                real64 const contactStiffness,
+                                CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                arrayView1d< real64 > const & localRhs )
+{
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & disp = nodeManager.totalDisplacement();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord = nodeManager.referencePosition();
+
+  string const dofKey = dofManager.getKey( keys::TotalDisplacement );
+  string const jumpDofKey = dofManager.getKey( SolidMechanicsEmbeddedFractures::viewKeyStruct::dispJumpString );
+  arrayView1d< globalIndex const > const & dispDofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
+  globalIndex const rankOffset = dofManager.rankOffset();
+
+  elemManager.forElementSubRegions< EmbeddedSurfaceSubRegion >( [&]( EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion )
+  {
+    arrayView1d< localIndex const > const & surfaceToRegion = embeddedSurfaceSubRegion.getSurfaceToRegionList();
+    arrayView1d< localIndex const > const & surfaceToSubRegion = embeddedSurfaceSubRegion.getSurfaceToSubRegionList();
+    arrayView1d< localIndex const > const & surfaceToCell = embeddedSurfaceSubRegion.getSurfaceToCellList();
+    arrayView1d< globalIndex const > const & jumpDofNumber =
+      embeddedSurfaceSubRegion.getReference< array1d< globalIndex > >( jumpDofKey );
+    arrayView1d< R1Tensor const > const & dispJump =
+      embeddedSurfaceSubRegion.getReference< array1d< R1Tensor > >( SolidMechanicsEmbeddedFractures::viewKeyStruct::dispJumpString );
+    arrayView1d< real64 const > const & surfaceArea = embeddedSurfaceSubRegion.getElementArea();
+    arrayView1d< integer const > const & ghostRank = embeddedSurfaceSubRegion.ghostRank();
+
+    for( localIndex k=0; k<embeddedSurfaceSubRegion.size(); ++k )
+    {
+      if( ghostRank[k] >= 0 )
+      {
+        continue;
+      }
+
+      CellElementSubRegion const & cellSubRegion =
+        *elemManager.GetRegion( surfaceToRegion[k] )->GetSubRegion< CellElementSubRegion >( surfaceToSubRegion[k] );
+      CellBlock::NodeMapType const & elemsToNodes = cellSubRegion.nodeList();
+      localIndex const cellIndex = surfaceToCell[k];
+      localIndex const numNodesPerElement = elemsToNodes.size( 1 );
+      localIndex const nUdof = numNodesPerElement * 3;
+      arrayView4d< real64 const > const & dNdX = cellSubRegion.dNdX();
+      arrayView2d< real64 const > const & detJ = cellSubRegion.detJ();
+
+      array1d< globalIndex > dispEqnRowIndices( nUdof ), dispColIndices( nUdof );
+      array1d< globalIndex > jumpEqnRowIndices( 3 ), jumpColIndices( 3 );
+      array1d< real64 > u( nUdof ), w( 3 ), R0( nUdof ), R1( 3 );
+      array2d< real64 > Kwu_elem( 3, nUdof ), Kuw_elem( nUdof, 3 ), Kww_elem( 3, 3 );
+      array2d< real64 > Kwu_gauss( 3, nUdof ), Kuw_gauss( nUdof, 3 ), Kww_gauss( 3, 3 );
+      array2d< real64 > eqMatrix( 3, 6 ), compMatrix( 6, 3 ), strainMatrix( 6, nUdof );
+      array2d< real64 > matBD( nUdof, 6 ), matED( 3, 6 ), dMatrix( 6, 6 );
+      Kwu_elem.setValues< serialPolicy >( 0 );
+      Kuw_elem.setValues< serialPolicy >( 0 );
+      Kww_elem.setValues< serialPolicy >( 0 );
+
+      LinearElasticIsotropic const * const solid =
+        cellSubRegion.getConstitutiveModel< LinearElasticIsotropic >( solidSolver.solidMaterialNames()[0] );
+      solid->createKernelUpdates().GetStiffness( cellIndex, dMatrix );
+
+      real64 const hInv = surfaceArea[k] / cellSubRegion.getElementVolume()[cellIndex];
+      assembleEquilibriumOperator( eqMatrix, embeddedSurfaceSubRegion, k, hInv );
+
+      for( localIndex a=0; a<numNodesPerElement; ++a )
+      {
+        localIndex const nodeIndex = elemsToNodes[cellIndex][a];
+        for( int i=0; i<3; ++i )
+        {
+          dispEqnRowIndices[a*3+i] = dispDofNumber[nodeIndex] + i - rankOffset;
+          dispColIndices[a*3+i] = dispDofNumber[nodeIndex] + i;
+          u[a*3+i] = disp[nodeIndex][i];
+        }
+      }
+      for( int i=0; i<3; ++i )
+      {
+        jumpEqnRowIndices[i] = jumpDofNumber[k] + i - rankOffset;
+        jumpColIndices[i] = jumpDofNumber[k] + i;
+        w[i] = dispJump[k][i];
+      }
+
+      BlasLapackLA::matrixMatrixMultiply( eqMatrix, dMatrix, matED );
+
+      array1d< real64 > tractionVec( 3 );
+      array2d< real64 > dTdw( 3, 3 );
+      tractionVec.setValues< serialPolicy >( 0 );
+      dTdw.setValues< serialPolicy >( 0 );
+      tractionVec[0] = w[0] >= 0 ? 1e5 : contactStiffness * w[0];
+
+      for( localIndex q=0; q<detJ.size( 1 ); ++q )
+      {
+        assembleCompatibilityOperator( compMatrix, embeddedSurfaceSubRegion, k, q, elemsToNodes, nodesCoord, cellIndex, dNdX );
+        assembleStrainOperator( strainMatrix, cellIndex, q, numNodesPerElement, dNdX );
+
+        BlasLapackLA::matrixTMatrixMultiply( strainMatrix, dMatrix, matBD );
+        BlasLapackLA::matrixMatrixMultiply( matED, compMatrix, Kww_gauss );
+        BlasLapackLA::matrixMatrixMultiply( matED, strainMatrix, Kwu_gauss );
+        BlasLapackLA::matrixMatrixMultiply( matBD, compMatrix, Kuw_gauss );
+
+        BlasLapackLA::matrixScale( detJ[cellIndex][q], Kwu_gauss );
+        BlasLapackLA::matrixScale( detJ[cellIndex][q], Kuw_gauss );
+        BlasLapackLA::matrixScale( detJ[cellIndex][q], Kww_gauss );
+
+        BlasLapackLA::matrixMatrixAdd( Kww_gauss, Kww_elem, -1 );
+        BlasLapackLA::matrixMatrixAdd( Kwu_gauss, Kwu_elem, -1 );
+        BlasLapackLA::matrixMatrixAdd( Kuw_gauss, Kuw_elem, -1 );
+      }
+
+      BlasLapackLA::matrixMatrixAdd( dTdw, Kww_elem, -1 );
+
+      BlasLapackLA::matrixVectorMultiply( Kww_elem, w, R1 );
+      BlasLapackLA::matrixVectorMultiply( Kwu_elem, u, R1, 1, 1 );
+      BlasLapackLA::matrixVectorMultiply( Kuw_elem, w, R0 );
+      BlasLapackLA::vectorVectorAdd( tractionVec, R1, 1 );
+
+      for( localIndex i=0; i<nUdof; ++i )
+      {
+        if( dispEqnRowIndices[i] >= 0 && dispEqnRowIndices[i] < localMatrix.numRows() )
+        {
+          localRhs[dispEqnRowIndices[i]] += R0[i];
+          localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( dispEqnRowIndices[i], jumpColIndices.data(), Kuw_elem[i], 3 );
+        }
+      }
+      for( localIndex i=0; i<3; ++i )
+      {
+        if( jumpEqnRowIndices[i] >= 0 && jumpEqnRowIndices[i] < localMatrix.numRows() )
+        {
+          localRhs[jumpEqnRowIndices[i]] += R1[i];
+          localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( jumpEqnRowIndices[i], jumpColIndices.data(), Kww_elem[i], 3 );
+          localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( jumpEqnRowIndices[i], dispColIndices.data(), Kwu_elem[i], nUdof );
+        }
+      }
+    }
+  } );
+}
+
+}
+
+class SolidMechanicsEmbeddedFracturesTest : public ::testing::Test
+{
+public:
+
+  SolidMechanicsEmbeddedFracturesTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    solver = problemManager->GetPhysicsSolverManager().GetGroup< SolidMechanicsEmbeddedFractures >( "mechSolve" );
+    solidSolver = problemManager->GetPhysicsSolverManager().GetGroup< SolidMechanicsLagrangianFEM >( "matrixSolver" );
+
+    DomainPartition & domain = *problemManager->getDomainPartition();
+    solver->ImplicitStepSetup( time, dt, domain );
+    solver->SetupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 10.0;
+
+  std::unique_ptr< ProblemManager > problemManager;
+  SolidMechanicsEmbeddedFractures * solver;
+  SolidMechanicsLagrangianFEM * solidSolver;
+};
+
+real64 constexpr SolidMechanicsEmbeddedFracturesTest::time;
+real64 constexpr SolidMechanicsEmbeddedFracturesTest::dt;
+
+TEST_F( SolidMechanicsEmbeddedFracturesTest, assemblyMatchesReference )
+{
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodeManager = *mesh.getNodeManager();
+
+  // a non-trivial displacement, and a jump alternating between open and closed fracture elements
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & disp = nodeManager.totalDisplacement();
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      disp[a][i] = 1e-4 * ( i + 1 ) * X[a][( i + 1 ) % 3] - 2e-5 * X[a][i];
+    }
+  }
+
+  localIndex numEmbeddedElems = 0;
+  mesh.getElemManager()->forElementSubRegions< EmbeddedSurfaceSubRegion >( [&]( EmbeddedSurfaceSubRegion & subRegion )
+  {
+    arrayView1d< R1Tensor > const & dispJump =
+      subRegion.getReference< array1d< R1Tensor > >( SolidMechanicsEmbeddedFractures::viewKeyStruct::dispJumpString );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      dispJump[k][0] = ( k % 2 == 0 ) ? 2e-4 : -1e-4;
+      dispJump[k][1] = 3e-5 * ( k + 1 );
+      dispJump[k][2] = -5e-5;
+    }
+    numEmbeddedElems += subRegion.size();
+  } );
+  ASSERT_GT( numEmbeddedElems, 1 );
+
+  ContactRelationBase const & contact =
+    *domain.getConstitutiveManager()->GetGroup< ContactRelationBase >( "fractureContact" );
+
+  // assembly through the kernel
+  CRSMatrix< real64, globalIndex > & localMatrix = solver->getLocalMatrix();
+  array1d< real64 > & localRhs = solver->getLocalRhs();
+  localMatrix.setValues< serialPolicy >( 0.0 );
+  localRhs.setValues< serialPolicy >( 0.0 );
+  solver->AssembleSystem( time, dt, domain, solver->getDofManager(), localMatrix.toViewConstSizes(), localRhs.toView() );
+
+  // previous assembly, on top of the same displacement block
+  CRSMatrix< real64, globalIndex > referenceMatrix( localMatrix );
+  array1d< real64 > referenceRhs( localRhs.size() );
+  referenceMatrix.setValues< serialPolicy >( 0.0 );
+  solidSolver->AssembleSystem( time, dt, domain, solver->getDofManager(), referenceMatrix.toViewConstSizes(), referenceRhs.toView() );
+  assembleCouplingReference( domain,
+                             solver->getDofManager(),
+                             *solidSolver,
+                             contact.stiffness(),
+                             referenceMatrix.toViewConstSizes(),
+                             referenceRhs.toView() );
+
+  real64 const relTol = 1e-12;
+
+  real64 matrixScale = 0.0;
+  for( localIndex row = 0; row < referenceMatrix.numRows(); ++row )
+  {
+    arraySlice1d< real64 const > const entries = referenceMatrix.getEntries( row );
+    for( localIndex j = 0; j < referenceMatrix.numNonZeros( row ); ++j )
+    {
+      matrixScale = std::max( matrixScale, std::abs( entries[j] ) );
+    }
+  }
+  for( localIndex row = 0; row < referenceMatrix.numRows(); ++row )
+  {
+    ASSERT_EQ( localMatrix.numNonZeros( row ), referenceMatrix.numNonZeros( row ) );
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+    arraySlice1d< globalIndex const > const referenceColumns = referenceMatrix.getColumns( row );
+    arraySlice1d< real64 const > const entries = localMatrix.getEntries( row );
+    arraySlice1d< real64 const > const referenceEntries = referenceMatrix.getEntries( row );
+    for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+    {
+      ASSERT_EQ( columns[j], referenceColumns[j] );
+      EXPECT_NEAR( entries[j], referenceEntries[j], relTol * matrixScale ) << "row " << row << ", column " << columns[j];
+    }
+  }
+
+  real64 rhsScale = 0.0;
+  for( localIndex row = 0; row < referenceRhs.size(); ++row )
+  {
+    rhsScale = std::max( rhsScale, std::abs( referenceRhs[row] ) );
+  }
+  ASSERT_GT( rhsScale, 0.0 );
+  for( localIndex row = 0; row < referenceRhs.size(); ++row )
+  {
+    EXPECT_NEAR( localRhs[row], referenceRhs[row], relTol * rhsScale ) << "row " << row;
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
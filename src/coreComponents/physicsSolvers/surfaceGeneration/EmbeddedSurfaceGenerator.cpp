@@ -110,47 +110,51 @@ void EmbeddedSurfaceGenerator::InitializePostSubGroups( Group * const problemMan
     integer isPositive, isNegative;
     R1Tensor distVec;
 
-    elemManager->forElementSubRegionsComplete< CellElementSubRegion >(
-      [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
+    // Only the elements whose bounding box intersects the fracture can be cut by it
+    R1Tensor fractureMin, fractureMax;
+    fracture.GetBoundingBox( fractureMin, fractureMax );
+
+    elemManager->forCellElementsIntersecting( *nodeManager, fractureMin, fractureMax,
+                                              [&]( localIndex const er, localIndex const esr, localIndex const cellIndex )
     {
+      CellElementSubRegion const & subRegion =
+        *elemManager->GetRegion( er )->GetSubRegion< CellElementSubRegion >( esr );
       CellElementSubRegion::NodeMapType::ViewTypeConst const & cellToNodes = subRegion.nodeList();
       FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
-      for( localIndex cellIndex =0; cellIndex<subRegion.size(); cellIndex++ )
+
+      isPositive = 0;
+      isNegative = 0;
+      for( localIndex kn =0; kn<subRegion.numNodesPerElement(); kn++ )
       {
-        isPositive = 0;
-        isNegative = 0;
-        for( localIndex kn =0; kn<subRegion.numNodesPerElement(); kn++ )
+        nodeIndex = cellToNodes[cellIndex][kn];
+        distVec  = nodesCoord[nodeIndex];
+        distVec -= planeCenter;
+        // check if the dot product is zero
+        if( Dot( distVec, normalVector ) > 0 )
         {
-          nodeIndex = cellToNodes[cellIndex][kn];
-          distVec  = nodesCoord[nodeIndex];
-          distVec -= planeCenter;
-          // check if the dot product is zero
-          if( Dot( distVec, normalVector ) > 0 )
-          {
-            isPositive = 1;
-          }
-          else if( Dot( distVec, normalVector ) < 0 )
-          {
-            isNegative = 1;
-          }
-        } // end loop over nodes
-        if( isPositive * isNegative == 1 )
+          isPositive = 1;
+        }
+        else if( Dot( distVec, normalVector ) < 0 )
         {
+          isNegative = 1;
+        }
+      } // end loop over nodes
+      if( isPositive * isNegative == 1 )
+      {
 
-          bool added = embeddedSurfaceSubRegion->AddNewEmbeddedSurface( cellIndex,
-                                                                        er,
-                                                                        esr,
-                                                                        *nodeManager,
-                                                                        *edgeManager,
-                                                                        cellToEdges,
-                                                                        &fracture );
-          if( added )
-          {
-            GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
-          }
+        bool added = embeddedSurfaceSubRegion->AddNewEmbeddedSurface( cellIndex,
+                                                                      er,
+                                                                      esr,
+                                                                      *nodeManager,
+                                                                      *edgeManager,
+                                                                      cellToEdges,
+                                                                      &fracture );
+        if( added )
+        {
+          GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
         }
-      } // end loop over cells
-    } );// end loop over subregions
+      }
+    } );// end loop over candidate cells
   } );// end loop over thick planes
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const & cellElemGhostRank =
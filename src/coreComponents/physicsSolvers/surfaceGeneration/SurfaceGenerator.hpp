@@ -91,6 +91,13 @@ public:
                              integer const cycleNumber,
                              DomainPartition & domain ) override;
 
+  /**
+   * @copydoc ExecutableGroup::IsTimestepRequestRankInvariant()
+   * @note The rupture rate limiting the timestep is computed from the local fracture front.
+   */
+  virtual bool IsTimestepRequestRankInvariant() const override
+  { return false; }
+
   /**@}*/
 
 
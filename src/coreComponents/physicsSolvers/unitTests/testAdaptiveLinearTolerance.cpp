@@ -0,0 +1,156 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+namespace
+{
+
+/**
+ * @brief Solver exposing the adaptive tolerance of the linear solves.
+ */
+class AdaptiveToleranceSolver : public SolverBase
+{
+public:
+
+  AdaptiveToleranceSolver():
+    SolverBase( "solver", nullptr )
+  {}
+
+  using SolverBase::EisenstatWalker;
+  using SolverBase::ApplyAdaptiveTolerance;
+  using SolverBase::UpdateAdaptiveLinearTolerance;
+  using SolverBase::NextLinearSolverParameters;
+
+  LinearSolverParameters & linearParameters()
+  {
+    return m_linearSolverParameters.get();
+  }
+};
+
+/// Parameters of an iterative solve to the fixed tolerance 1e-6 in at most 200 iterations
+LinearSolverParameters iterativeParameters()
+{
+  LinearSolverParameters params;
+  params.solverType = LinearSolverParameters::SolverType::gmres;
+  params.krylov.relTolerance = 1e-6;
+  params.krylov.maxIterations = 200;
+  params.krylov.adaptiveMaxIterations = 20;
+  return params;
+}
+
+}
+
+TEST( AdaptiveLinearTolerance, forcingTerm )
+{
+  // quadratic in the residual reduction
+  EXPECT_NEAR( AdaptiveToleranceSolver::EisenstatWalker( 1e-3, 1e-2, 1e-1 ), 0.9 * 1e-2, 1e-15 );
+
+  // safeguarded by the square of the previous residual
+  EXPECT_NEAR( AdaptiveToleranceSolver::EisenstatWalker( 1e-6, 1e-2, 1e-1 ), 0.9 * 1e-4, 1e-15 );
+
+  // a growing residual gives the weakest tolerance
+  EXPECT_DOUBLE_EQ( AdaptiveToleranceSolver::EisenstatWalker( 2e-2, 1e-2, 1e-3 ), 1e-3 );
+
+  // bounded by the strongest tolerance
+  EXPECT_DOUBLE_EQ( AdaptiveToleranceSolver::EisenstatWalker( 1e-12, 1e-6, 1e-3 ), 1e-8 );
+}
+
+TEST( AdaptiveLinearTolerance, weakerToleranceIsCapped )
+{
+  LinearSolverParameters params = iterativeParameters();
+  EXPECT_TRUE( AdaptiveToleranceSolver::ApplyAdaptiveTolerance( 1e-3, params ) );
+  EXPECT_DOUBLE_EQ( params.krylov.relTolerance, 1e-3 );
+  EXPECT_EQ( params.krylov.maxIterations, 20 );
+
+  // the cap never raises the iteration limit
+  params = iterativeParameters();
+  params.krylov.adaptiveMaxIterations = 500;
+  EXPECT_TRUE( AdaptiveToleranceSolver::ApplyAdaptiveTolerance( 1e-3, params ) );
+  EXPECT_EQ( params.krylov.maxIterations, 200 );
+
+  // no cap requested
+  params = iterativeParameters();
+  params.krylov.adaptiveMaxIterations = 0;
+  EXPECT_FALSE( AdaptiveToleranceSolver::ApplyAdaptiveTolerance( 1e-3, params ) );
+  EXPECT_DOUBLE_EQ( params.krylov.relTolerance, 1e-3 );
+  EXPECT_EQ( params.krylov.maxIterations, 200 );
+}
+
+TEST( AdaptiveLinearTolerance, strongerToleranceIsNotCapped )
+{
+  LinearSolverParameters params = iterativeParameters();
+  EXPECT_FALSE( AdaptiveToleranceSolver::ApplyAdaptiveTolerance( 1e-8, params ) );
+  EXPECT_DOUBLE_EQ( params.krylov.relTolerance, 1e-8 );
+  EXPECT_EQ( params.krylov.maxIterations, 200 );
+}
+
+TEST( AdaptiveLinearTolerance, parametersKeptWithoutAdaptiveTolerance )
+{
+  // no adaptive tolerance set by the Newton loop
+  LinearSolverParameters params = iterativeParameters();
+  EXPECT_FALSE( AdaptiveToleranceSolver::ApplyAdaptiveTolerance( 0.0, params ) );
+  EXPECT_DOUBLE_EQ( params.krylov.relTolerance, 1e-6 );
+  EXPECT_EQ( params.krylov.maxIterations, 200 );
+
+  // direct solves have no tolerance to relax
+  params.solverType = LinearSolverParameters::SolverType::direct;
+  EXPECT_FALSE( AdaptiveToleranceSolver::ApplyAdaptiveTolerance( 1e-3, params ) );
+  EXPECT_DOUBLE_EQ( params.krylov.relTolerance, 1e-6 );
+  EXPECT_EQ( params.krylov.maxIterations, 200 );
+}
+
+TEST( AdaptiveLinearTolerance, toleranceAppliesToNextSolveOnly )
+{
+  AdaptiveToleranceSolver solver;
+  solver.linearParameters() = iterativeParameters();
+  bool isCapped;
+
+  // not requested
+  solver.UpdateAdaptiveLinearTolerance( 1e-3, 1e-2 );
+  EXPECT_DOUBLE_EQ( solver.NextLinearSolverParameters( isCapped ).krylov.relTolerance, 1e-6 );
+  EXPECT_FALSE( isCapped );
+
+  solver.linearParameters().krylov.useAdaptiveTol = true;
+  solver.linearParameters().krylov.weakestTol = 1e-1;
+  solver.UpdateAdaptiveLinearTolerance( 1e-3, 1e-2 );
+  LinearSolverParameters const params = solver.NextLinearSolverParameters( isCapped );
+  EXPECT_NEAR( params.krylov.relTolerance, 0.9 * 1e-2, 1e-15 );
+  EXPECT_EQ( params.krylov.maxIterations, 20 );
+  EXPECT_TRUE( isCapped );
+
+  // the input parameters are unchanged and the next solve uses the fixed tolerance again
+  EXPECT_DOUBLE_EQ( solver.linearParameters().krylov.relTolerance, 1e-6 );
+  LinearSolverParameters const nextParams = solver.NextLinearSolverParameters( isCapped );
+  EXPECT_DOUBLE_EQ( nextParams.krylov.relTolerance, 1e-6 );
+  EXPECT_EQ( nextParams.krylov.maxIterations, 200 );
+  EXPECT_FALSE( isCapped );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,77 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+namespace
+{
+
+/**
+ * @brief Solver exposing the prediction of the convergence of the Newton loop.
+ */
+class PredictingSolver : public SolverBase
+{
+public:
+  using SolverBase::IsConvergenceExpected;
+};
+
+}
+
+TEST( ConvergencePrediction, quadraticConvergence )
+{
+  // rates 1e-1 then 1e-2: quadratic convergence, the next residuals are predicted at 1e-8 and 1e-16
+  EXPECT_TRUE( PredictingSolver::IsConvergenceExpected( 1e-1, 1e-2, 1e-4, 1e-10, 2 ) );
+  EXPECT_FALSE( PredictingSolver::IsConvergenceExpected( 1e-1, 1e-2, 1e-4, 1e-10, 1 ) );
+}
+
+TEST( ConvergencePrediction, linearConvergence )
+{
+  // constant rate 0.9: 0.81 * 0.9^n reaches 1e-6 after 130 iterations
+  EXPECT_FALSE( PredictingSolver::IsConvergenceExpected( 1.0, 0.9, 0.81, 1e-6, 5 ) );
+  EXPECT_TRUE( PredictingSolver::IsConvergenceExpected( 1.0, 0.9, 0.81, 1e-6, 130 ) );
+}
+
+TEST( ConvergencePrediction, slowerConvergenceIsAssumedLinear )
+{
+  // the rate grows from 0.1 to 0.5, it is assumed to stay at 0.5: 5e-3 * 0.5^n reaches 1e-6 after 13 iterations
+  EXPECT_FALSE( PredictingSolver::IsConvergenceExpected( 1e-1, 1e-2, 5e-3, 1e-6, 12 ) );
+  EXPECT_TRUE( PredictingSolver::IsConvergenceExpected( 1e-1, 1e-2, 5e-3, 1e-6, 13 ) );
+}
+
+TEST( ConvergencePrediction, growingResidual )
+{
+  // a single increase of the residual does not rule out convergence
+  EXPECT_TRUE( PredictingSolver::IsConvergenceExpected( 1.0, 0.5, 0.6, 1e-6, 1 ) );
+  EXPECT_TRUE( PredictingSolver::IsConvergenceExpected( 1.0, 1.2, 0.6, 1e-6, 1 ) );
+
+  // two consecutive increases do
+  EXPECT_FALSE( PredictingSolver::IsConvergenceExpected( 1.0, 1.1, 1.2, 1e-6, 10 ) );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,94 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+
+using namespace geosx;
+
+namespace
+{
+
+/// Steps of varying sizes ending at the beginning of the new step, t = 3.5
+constexpr real64 secondLastDt = 1.5;
+constexpr real64 lastDt = 0.5;
+constexpr real64 time_n = 3.5;
+
+/**
+ * @brief Compute the extrapolated increment over the new step of a solution known at the last step ends.
+ * @param order the order of the extrapolation
+ * @param dt the size of the new step
+ * @param solution the solution as a function of time
+ * @return the extrapolated increment
+ */
+real64 extrapolatedIncrement( integer const order,
+                              real64 const dt,
+                              std::function< real64 ( real64 ) > const & solution )
+{
+  real64 const lastIncrement = solution( time_n ) - solution( time_n - lastDt );
+  real64 const secondLastIncrement = solution( time_n - lastDt ) - solution( time_n - lastDt - secondLastDt );
+
+  real64 lastWeight, secondLastWeight;
+  SolverBase::ComputeInitialGuessWeights( order, dt, lastDt, secondLastDt, lastWeight, secondLastWeight );
+  return lastWeight * lastIncrement + secondLastWeight * secondLastIncrement;
+}
+
+}
+
+TEST( InitialGuessExtrapolation, linearIsExactForLinearSolution )
+{
+  auto const solution = []( real64 const t ) { return 2.0 - 3.0 * t; };
+  for( real64 const dt : { 0.25, 0.5, 2.0 } )
+  {
+    EXPECT_NEAR( extrapolatedIncrement( 1, dt, solution ), solution( time_n + dt ) - solution( time_n ), 1e-12 );
+  }
+}
+
+TEST( InitialGuessExtrapolation, linearIgnoresSecondLastStep )
+{
+  real64 lastWeight, secondLastWeight;
+  SolverBase::ComputeInitialGuessWeights( 1, 2.0, lastDt, secondLastDt, lastWeight, secondLastWeight );
+  EXPECT_DOUBLE_EQ( lastWeight, 2.0 / lastDt );
+  EXPECT_DOUBLE_EQ( secondLastWeight, 0.0 );
+}
+
+TEST( InitialGuessExtrapolation, quadraticIsExactForQuadraticSolution )
+{
+  auto const solution = []( real64 const t ) { return 1.0 + 0.5 * t - 0.75 * t * t; };
+  for( real64 const dt : { 0.25, 0.5, 2.0 } )
+  {
+    EXPECT_NEAR( extrapolatedIncrement( 2, dt, solution ), solution( time_n + dt ) - solution( time_n ), 1e-12 );
+  }
+
+  // the linear extrapolation misses the change of rate
+  real64 const dt = 0.5;
+  EXPECT_GT( std::abs( extrapolatedIncrement( 1, dt, solution ) - ( solution( time_n + dt ) - solution( time_n ) ) ), 0.1 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,166 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+const char IGNORE_OUTPUT[] = ".*";
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 2}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{2}\""
+  "                  ny=\"{1}\""
+  "                  nz=\"{1}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+void setupProblemFromXML( ProblemManager & problemManager, char const * const xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( xmlInput, strlen( xmlInput ) );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition * domain = problemManager.getDomainPartition();
+  MeshManager * meshManager = problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager->GenerateMeshLevels( domain );
+
+  ElementRegionManager * elementManager = domain->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager->getName().c_str() );
+  elementManager->ProcessInputFileRecursive( topLevelNode );
+  elementManager->PostProcessInputRecursive();
+
+  problemManager.ProblemSetup();
+}
+
+/**
+ * @brief Solver exposing the block size of its parallel matrix.
+ */
+class PointBlockSolver : public SolverBase
+{
+public:
+  using SolverBase::PointBlockSize;
+};
+
+/// Parameters requesting point blocks of three unknowns for an iterative solver
+LinearSolverParameters pointBlockParameters()
+{
+  LinearSolverParameters params;
+  params.solverType = LinearSolverParameters::SolverType::gmres;
+  params.usePointBlocks = true;
+  params.dofsPerNode = 3;
+  return params;
+}
+
+}
+
+class PointBlockSizeTest : public ::testing::Test
+{
+public:
+
+  PointBlockSizeTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) ),
+    dofManager( "test" )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+  }
+
+  std::unique_ptr< ProblemManager > const problemManager;
+  DofManager dofManager;
+};
+
+TEST_F( PointBlockSizeTest, singleField )
+{
+  dofManager.addField( "displacement", DofManager::Location::Node, 3 );
+  dofManager.reorderByRank();
+
+  LinearSolverParameters params = pointBlockParameters();
+  EXPECT_EQ( PointBlockSolver::PointBlockSize( params, dofManager ), 3 );
+
+  // the direct solvers use scalar storage
+  params.solverType = LinearSolverParameters::SolverType::direct;
+  EXPECT_EQ( PointBlockSolver::PointBlockSize( params, dofManager ), 1 );
+
+  // not requested
+  params = pointBlockParameters();
+  params.usePointBlocks = false;
+  EXPECT_EQ( PointBlockSolver::PointBlockSize( params, dofManager ), 1 );
+
+  // the blocks do not match the components of the field
+  params = pointBlockParameters();
+  params.dofsPerNode = 2;
+  EXPECT_DEATH_IF_SUPPORTED( PointBlockSolver::PointBlockSize( params, dofManager ), IGNORE_OUTPUT );
+}
+
+TEST_F( PointBlockSizeTest, mixedFields )
+{
+  // the unknowns of a node and of an element are not numbered consecutively
+  dofManager.addField( "displacement", DofManager::Location::Node, 3 );
+  dofManager.addField( "pressure", DofManager::Location::Elem, 1 );
+  dofManager.reorderByRank();
+
+  LinearSolverParameters params = pointBlockParameters();
+  EXPECT_DEATH_IF_SUPPORTED( PointBlockSolver::PointBlockSize( params, dofManager ), IGNORE_OUTPUT );
+
+  // scalar storage is always valid
+  params.usePointBlocks = false;
+  EXPECT_EQ( PointBlockSolver::PointBlockSize( params, dofManager ), 1 );
+  params = pointBlockParameters();
+  params.solverType = LinearSolverParameters::SolverType::direct;
+  EXPECT_EQ( PointBlockSolver::PointBlockSize( params, dofManager ), 1 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,156 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace geosx;
+
+namespace
+{
+
+/// Gains of the PID controller of SolverBase::SetNextDtBasedOnSolutionChange
+constexpr real64 kP = 0.075;
+constexpr real64 kI = 0.175;
+constexpr real64 kD = 0.01;
+
+/**
+ * @brief Solver exposing the state used by the time step control.
+ */
+class TimeStepControlSolver : public SolverBase
+{
+public:
+
+  TimeStepControlSolver():
+    SolverBase( "solver", nullptr )
+  {}
+
+  void setSolutionChangeRatio( real64 const ratio )
+  {
+    m_solutionChangeRatio = ratio;
+  }
+
+  real64 solutionChangeRatio() const
+  {
+    return m_solutionChangeRatio;
+  }
+
+  NonlinearSolverParameters & nonlinearParameters()
+  {
+    return m_nonlinearSolverParameters;
+  }
+};
+
+}
+
+class TimeStepControlTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    solver.nonlinearParameters().m_timeStepControl = NonlinearSolverParameters::TimeStepControl::SolutionChange;
+    solver.nonlinearParameters().m_numNewtonIterations = 0;
+  }
+
+  /// Select the next time step after a step of size dt that measured a solution change ratio
+  real64 nextDt( real64 const dt, real64 const ratio )
+  {
+    real64 next = 0.0;
+    solver.setSolutionChangeRatio( ratio );
+    solver.SetNextDt( dt, next );
+    return next;
+  }
+
+  TimeStepControlSolver solver;
+};
+
+TEST_F( TimeStepControlTest, firstStepIntegralTerm )
+{
+  // without history only the integral term acts
+  EXPECT_DOUBLE_EQ( nextDt( 10.0, 1.0 ), 10.0 );
+  EXPECT_DOUBLE_EQ( solver.solutionChangeRatio(), -1.0 );
+}
+
+TEST_F( TimeStepControlTest, halfTargetChange )
+{
+  EXPECT_DOUBLE_EQ( nextDt( 10.0, 0.5 ), 10.0 * std::pow( 2.0, kI ) );
+}
+
+TEST_F( TimeStepControlTest, historyTerms )
+{
+  real64 const dt0 = nextDt( 10.0, 0.5 );
+  real64 const dt1 = nextDt( dt0, 0.8 );
+  real64 const expected1 = dt0 * std::pow( 0.5 / 0.8, kP )
+                           * std::pow( 1.0 / 0.8, kI )
+                           * std::pow( 0.5 * 0.5 / ( 0.8 * 0.5 ), kD );
+  EXPECT_DOUBLE_EQ( dt1, expected1 );
+
+  real64 const dt2 = nextDt( dt1, 1.2 );
+  real64 const expected2 = dt1 * std::pow( 0.8 / 1.2, kP )
+                           * std::pow( 1.0 / 1.2, kI )
+                           * std::pow( 0.8 * 0.8 / ( 1.2 * 0.5 ), kD );
+  EXPECT_DOUBLE_EQ( dt2, expected2 );
+}
+
+TEST_F( TimeStepControlTest, factorBounds )
+{
+  // a solution that barely changes lets the time step double at most
+  EXPECT_DOUBLE_EQ( nextDt( 10.0, 0.0 ), 20.0 );
+
+  // a very large change cuts the time step by five at most
+  TimeStepControlSolver otherSolver;
+  otherSolver.nonlinearParameters().m_timeStepControl = NonlinearSolverParameters::TimeStepControl::SolutionChange;
+  otherSolver.nonlinearParameters().m_numNewtonIterations = 0;
+  otherSolver.setSolutionChangeRatio( 1e6 );
+  real64 next = 0.0;
+  otherSolver.SetNextDt( 10.0, next );
+  EXPECT_DOUBLE_EQ( next, 2.0 );
+}
+
+TEST_F( TimeStepControlTest, newtonIterationsCap )
+{
+  // a difficult convergence halves the time step at least, whatever the solution change
+  NonlinearSolverParameters & params = solver.nonlinearParameters();
+  params.m_numNewtonIterations = params.dtCutIterLimit() + 1;
+  EXPECT_DOUBLE_EQ( nextDt( 10.0, 0.5 ), 5.0 );
+}
+
+TEST_F( TimeStepControlTest, fallbackToNewtonIterations )
+{
+  // the ratio is consumed by each selection, a step that does not measure it uses the Newton iterations
+  nextDt( 10.0, 0.5 );
+  real64 next = 0.0;
+  solver.SetNextDt( 10.0, next );
+  EXPECT_DOUBLE_EQ( next, 20.0 );
+
+  // the Newton iteration control ignores the solution change
+  solver.nonlinearParameters().m_timeStepControl = NonlinearSolverParameters::TimeStepControl::NewtonIterations;
+  EXPECT_DOUBLE_EQ( nextDt( 10.0, 10.0 ), 20.0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}